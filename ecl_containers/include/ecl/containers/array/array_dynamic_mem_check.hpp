@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <cstdlib>
 #include <cstdio>
+#include <utility>
 #include <ecl/config/macros.hpp>
 #include <ecl/utilities/blueprints.hpp>
 #include "../definitions.hpp"
@@ -36,7 +37,7 @@ namespace ecl {
 ** Forward Declarations
 *****************************************************************************/
 
-template <typename Type> class Array<Type,DynamicStorage>;
+template <typename Type, typename Allocator> class Array<Type,DynamicStorage,Allocator>;
 
 namespace blueprints {
 
@@ -58,8 +59,8 @@ template <typename Type, size_t N> class ArrayFormatter;
  *
  * @sa @ref ecl::Array "Array".
  */
-template<typename Type>
-class ECL_PUBLIC BluePrintFactory< Array<Type,DynamicStorage> > {
+template<typename Type, typename Allocator>
+class ECL_PUBLIC BluePrintFactory< Array<Type,DynamicStorage,Allocator> > {
     public:
         /**
          * @brief Generates a constant array of the specified size.
@@ -108,6 +109,12 @@ class ECL_PUBLIC BluePrintFactory< Array<Type,DynamicStorage> > {
  *
  * Every other facility that is available with fixed size arrays is also available with this class.
  *
+ * <b>Memory Checks:</b>
+ *
+ * This is the memory checking (ECL_MEM_CHECK_ARRAYS) version. To keep the guard
+ * sections tight around the elements, it ignores the allocator (storage is malloc'd
+ * along with the guards), every resize reallocates and reserve() is only a hint.
+ *
  * <b>Error Handling</b>
  *
  * Arrays will throw exceptions whenever an operation performs an out of range operation.
@@ -121,11 +128,12 @@ class ECL_PUBLIC BluePrintFactory< Array<Type,DynamicStorage> > {
  * @endcode
  *
  * @tparam Type : the type of the element stored in the array.
+ * @tparam Allocator : ignored by the memory checking version.
  *
  * @sa @ref ecl::Array "Array".
  **/
-template<typename Type>
-class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Type,DynamicStorage> >  {
+template<typename Type, typename Allocator>
+class ECL_PUBLIC Array<Type,DynamicStorage,Allocator> : public BluePrintFactory< Array<Type,DynamicStorage,Allocator> >  {
     public:
         /*********************
         ** Typedefs
@@ -139,10 +147,11 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
         typedef std::ptrdiff_t difference_type;
         typedef std::reverse_iterator<iterator> reverse_iterator; /**< Array's reverse iterator type. **/
         typedef std::reverse_iterator<const_iterator> const_reverse_iterator;  /**< Array's constant reverse iterator type. **/
+        typedef Allocator      allocator_type; /**< Array's storage allocator type. **/
         typedef formatters::ArrayFormatter<Type,DynamicStorage> Formatter; /**< @brief Formatter for this class. **/
 
         /** @brief Generates blueprints for this class. **/
-        typedef BluePrintFactory< Array<Type,DynamicStorage> > Factory;
+        typedef BluePrintFactory< Array<Type,DynamicStorage,Allocator> > Factory;
 
         /*********************
         ** Constructors
@@ -153,6 +162,12 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
          * Does not reserve any storage for the array. Just creates the container object.
          */
         explicit Array() : buffer_size(0), underrun(NULL), buffer(NULL), overrun(NULL) {}
+        /**
+         * @brief Does not reserve any storage, the allocator is unused by this version.
+         *
+         * @param allocator : allocator (unused).
+         */
+        explicit Array(const Allocator &allocator) : buffer_size(0), underrun(NULL), buffer(NULL), overrun(NULL), storage_allocator(allocator) {}
         /**
          * @brief Reserves storage for the array.
          *
@@ -160,12 +175,14 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
          * The values are left uninitialised.
          *
          * @param reserve_size : the number of elements to be allocated to the container.
+         * @param allocator : allocator (unused).
          */
-        explicit Array(const unsigned int reserve_size) :
+        explicit Array(const unsigned int reserve_size, const Allocator &allocator = Allocator()) :
         		buffer_size(reserve_size),
         		underrun(NULL),
         		buffer(NULL),
-        		overrun(NULL)
+        		overrun(NULL),
+        		storage_allocator(allocator)
 			{
         	underrun = (char*) malloc(buffer_size*sizeof(Type)+bufferUnderrunLength()+bufferOverrunLength());
         	ecl_assert_throw(underrun != NULL, StandardException(LOC,MemoryError,"Failed to allocate memory to the dynamic array."));
@@ -184,12 +201,32 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
          *
          * @param array : the array to copy from.
          */
-        Array(const Array<Type,DynamicStorage>& array) : buffer_size(0), underrun(NULL), buffer(NULL), overrun(NULL) {
+        Array(const Array<Type,DynamicStorage,Allocator>& array) : Factory(), buffer_size(0), underrun(NULL), buffer(NULL), overrun(NULL), storage_allocator(array.storage_allocator) {
         	if ( array.size() != 0 ) {
 				resize(array.size()); // not really optimal as we do a fill in resize and then copy here, but its debug version anyway.
 				std::copy(array.begin(),array.end(),begin());
         	}
         }
+        /**
+         * @brief Move constructor.
+         *
+         * Takes over the other array's storage (guards and all), leaving it empty.
+         *
+         * @param array : the array to move from.
+         */
+        Array(Array<Type,DynamicStorage,Allocator>&& array) noexcept :
+            Factory(),
+            buffer_size(array.buffer_size),
+            underrun(array.underrun),
+            buffer(array.buffer),
+            overrun(array.overrun),
+            storage_allocator(std::move(array.storage_allocator))
+        {
+            array.buffer_size = 0;
+            array.underrun = NULL;
+            array.buffer = NULL;
+            array.overrun = NULL;
+        }
         /**
          * @brief Blueprint constructor.
          *
@@ -254,13 +291,25 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
             return containers::BoundedListInitialiser<value_type,iterator,DynamicStorage>(value,buffer,buffer_size);
         }
 
-        void operator=(const Array<Type,DynamicStorage>& array) {
+        Array<Type,DynamicStorage,Allocator>& operator=(const Array<Type,DynamicStorage,Allocator>& array) {
+        	if ( &array == this ) {
+        		return *this;
+        	}
         	if ( array.size() == 0 ) {
         		clear();
         	} else {
 				resize(array.size()); // not really optimal as we do a fill in resize and then copy here, but its debug version anyway.
 				std::copy(array.begin(),array.end(),begin());
         	}
+        	return *this;
+        }
+
+        Array<Type,DynamicStorage,Allocator>& operator=(Array<Type,DynamicStorage,Allocator>&& array) noexcept {
+        	if ( &array != this ) {
+        		clear();
+        		swap(array);
+        	}
+        	return *this;
         }
 
         /*********************
@@ -405,10 +454,10 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
          *
          * @exception : StandardException : throws if the indices provided are out of range [debug mode only].
          */
-        Stencil< Array<Type,DynamicStorage> > stencil(const unsigned int& start_index, const unsigned int& n) {
+        Stencil< Array<Type,DynamicStorage,Allocator> > stencil(const unsigned int& start_index, const unsigned int& n) {
         	ecl_assert_throw(start_index < size(), StandardException(LOC, OutOfRangeError, "Start index provided is larger than the underlying array size."));
         	ecl_assert_throw(start_index+n <= size(), StandardException(LOC, OutOfRangeError, "Finish index provided is larger than the underlying array size."));
-        	return Stencil< Array<Type,DynamicStorage> >(*this, begin()+start_index, begin()+start_index+n);
+        	return Stencil< Array<Type,DynamicStorage,Allocator> >(*this, begin()+start_index, begin()+start_index+n);
         }
         /**
          * Accesses elements in the array, returning references to the requested element. This
@@ -484,6 +533,18 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
          * @return size_type : the size of the array.
          */
         size_type size() const { return buffer_size; }
+        /**
+         * @brief The capacity, always the size here (guards sit right after the elements).
+         *
+         * @return size_type : the capacity of the array.
+         */
+        size_type capacity() const { return buffer_size; }
+        /**
+         * @brief The allocator (unused by the memory checking version).
+         *
+         * @return Allocator : a copy of the allocator.
+         */
+        allocator_type get_allocator() const { return storage_allocator; }
 
         /**
          * @brief Resize the array, clearing whatever was in there before.
@@ -522,6 +583,26 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
         	}
             buffer_size = 0;
         }
+        /**
+         * @brief Only a hint in the memory checking version.
+         */
+        void reserve( size_t /* n */ ) {}
+        /**
+         * @brief Nothing to release in the memory checking version.
+         */
+        void shrink_to_fit() {}
+        /**
+         * @brief Swap the contents of two arrays.
+         *
+         * @param array : the array to swap with.
+         */
+        void swap(Array<Type,DynamicStorage,Allocator>& array) {
+            std::swap(buffer_size, array.buffer_size);
+            std::swap(underrun, array.underrun);
+            std::swap(buffer, array.buffer);
+            std::swap(overrun, array.overrun);
+            std::swap(storage_allocator, array.storage_allocator);
+        }
 
         /*********************
         ** Streaming
@@ -533,8 +614,8 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
          * @param array : the array to be inserted.
          * @return OutputStream : continue streaming with the updated output stream.
          */
-        template <typename OutputStream, typename ElementType>
-        friend OutputStream& operator<<(OutputStream &ostream , const Array<ElementType,DynamicStorage> &array);
+        template <typename OutputStream, typename ElementType, typename ElementAllocator>
+        friend OutputStream& operator<<(OutputStream &ostream , const Array<ElementType,DynamicStorage,ElementAllocator> &array);
 
         /******************************************
 		** Buffer under/overrun checks
@@ -562,6 +643,7 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
         char *underrun;
         Type *buffer;
         char *overrun;
+        Allocator storage_allocator;
 };
 
 /*****************************************************************************
@@ -573,8 +655,8 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
  * Initialise the under and overrun sections with a magic char. This is later
  * checked to see if its been disturbed.
  */
-template<typename Type>
-void Array<Type,DynamicStorage>::initialiseMagicSections() {
+template<typename Type, typename Allocator>
+void Array<Type,DynamicStorage,Allocator>::initialiseMagicSections() {
 
 	// Should check that buffer != NULL here, but this isn't user API so just have to guarantee it internally.
 	for ( unsigned int i = 0; i < bufferUnderrunLength(); ++i ) {
@@ -592,8 +674,8 @@ void Array<Type,DynamicStorage>::initialiseMagicSections() {
  * an under/overrun has occurred.
  * @return bool : true if a buffer underrun is detected, false otherwise.
  */
-template<typename Type>
-bool Array<Type,DynamicStorage>::bufferUnderRun() {
+template<typename Type, typename Allocator>
+bool Array<Type,DynamicStorage,Allocator>::bufferUnderRun() {
 	if ( underrun != NULL ) {
 		for ( unsigned int i = 0; i < bufferUnderrunLength(); ++i ) {
 			if ( *(underrun+i) != magicChar() ) {
@@ -612,8 +694,8 @@ bool Array<Type,DynamicStorage>::bufferUnderRun() {
  *
  * @return bool : true if a buffer overrun is detected, false otherwise.
  */
-template<typename Type>
-bool Array<Type,DynamicStorage>::bufferOverRun() {
+template<typename Type, typename Allocator>
+bool Array<Type,DynamicStorage,Allocator>::bufferOverRun() {
 
 	if ( overrun != NULL ) {
 		for ( unsigned int i = 0; i < bufferOverrunLength(); ++i ) {
@@ -634,8 +716,8 @@ bool Array<Type,DynamicStorage>::bufferOverRun() {
  *
  * @return bool : true if a buffer overflow is detected, false otherwise.
  */
-template<typename Type>
-bool Array<Type,DynamicStorage>::bufferOverFlow() {
+template<typename Type, typename Allocator>
+bool Array<Type,DynamicStorage,Allocator>::bufferOverFlow() {
 	return ( bufferOverRun() || bufferUnderRun() );
 }
 
@@ -644,8 +726,8 @@ bool Array<Type,DynamicStorage>::bufferOverFlow() {
 ** Implementation [Array]
 *****************************************************************************/
 
-template <typename OutputStream, typename ElementType>
-OutputStream& operator<<(OutputStream &ostream , const Array<ElementType,DynamicStorage> &array) {
+template <typename OutputStream, typename ElementType, typename ElementAllocator>
+OutputStream& operator<<(OutputStream &ostream , const Array<ElementType,DynamicStorage,ElementAllocator> &array) {
 
     ostream << "[ ";
     for(size_t i = 0; i < array.buffer_size; ++i )
@@ -727,9 +809,10 @@ class ConstantDynamicArray: public ArrayBluePrint< ConstantDynamicArray<Type> >
          * Fill all elements of an existing array with a constant value.
          * Note that this clears whatever was initially in the array.
          *
-         * @param array : the array to fill.
+         * @param array : the array to fill (any allocator).
          */
-        void apply(base_type& array) const {
+        template <typename DynamicArray>
+        void apply(DynamicArray& array) const {
             array.resize(reserve_size);
             std::fill_n(array.begin(),reserve_size,val);
         }
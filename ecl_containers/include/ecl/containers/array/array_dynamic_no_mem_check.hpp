@@ -17,6 +17,9 @@
 *****************************************************************************/
 
 #include <algorithm>
+#include <memory>
+#include <new>
+#include <utility>
 #include <ecl/config/macros.hpp>
 #include <ecl/utilities/blueprints.hpp>
 #include "../definitions.hpp"
@@ -34,7 +37,7 @@ namespace ecl {
 ** Forward Declarations
 *****************************************************************************/
 
-template <typename Type> class Array<Type,DynamicStorage>;
+template <typename Type, typename Allocator> class Array<Type,DynamicStorage,Allocator>;
 
 namespace blueprints {
 
@@ -59,8 +62,8 @@ template <typename Type, size_t N> class ArrayFormatter;
  *
  * @sa @ref ecl::Array "Array".
  */
-template<typename Type>
-class ECL_PUBLIC BluePrintFactory< Array<Type,DynamicStorage> > {
+template<typename Type, typename Allocator>
+class ECL_PUBLIC BluePrintFactory< Array<Type,DynamicStorage,Allocator> > {
     public:
         /**
          * @brief Generates a constant array of the specified size.
@@ -109,6 +112,25 @@ class ECL_PUBLIC BluePrintFactory< Array<Type,DynamicStorage> > {
  *
  * Every other facility that is available with fixed size arrays is also available with this class.
  *
+ * <b>Storage:</b>
+ *
+ * Storage comes from the allocator, by default 64 byte (cache line) aligned so
+ * that vectorised loops and Eigen maps over the array can use aligned loads. Plug
+ * in your own (any standard allocator, e.g. a pool or arena) via the last template
+ * parameter.
+ *
+ * Resizing within the capacity reuses the storage, so shrinking (and growing
+ * back) doesn't touch the heap. Use reserve() up front if the size will vary.
+ * Arrays can also be moved, which hands over the storage rather than copying it.
+ *
+ * @code
+ * Array<double> samples;
+ * samples.reserve(1024);
+ * samples.resize(n);                                  // no allocation while n <= 1024
+ * Array<double> trajectory = generate();              // moved, not copied
+ * Array<double,DynamicStorage,PoolAllocator<double> > pooled(100);
+ * @endcode
+ *
  * <b>Error Handling</b>
  *
  * Arrays will throw exceptions whenever an operation performs an out of range operation.
@@ -122,11 +144,12 @@ class ECL_PUBLIC BluePrintFactory< Array<Type,DynamicStorage> > {
  * @endcode
  *
  * @tparam Type : the type of the element stored in the array.
+ * @tparam Allocator : provides the storage (elements are constructed in place by the array).
  *
- * @sa @ref ecl::Array "Array".
+ * @sa @ref ecl::Array "Array", @ref ecl::AlignedAllocator "AlignedAllocator".
  **/
-template<typename Type>
-class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Type,DynamicStorage> >  {
+template<typename Type, typename Allocator>
+class ECL_PUBLIC Array<Type,DynamicStorage,Allocator> : public BluePrintFactory< Array<Type,DynamicStorage,Allocator> >  {
     public:
         /*********************
         ** Typedefs
@@ -140,10 +163,11 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
         typedef std::ptrdiff_t difference_type;
         typedef std::reverse_iterator<iterator> reverse_iterator; /**< Array's reverse iterator type. **/
         typedef std::reverse_iterator<const_iterator> const_reverse_iterator;  /**< Array's constant reverse iterator type. **/
+        typedef Allocator      allocator_type; /**< Array's storage allocator type. **/
         typedef formatters::ArrayFormatter<Type,DynamicStorage> Formatter; /**< @brief Formatter for this class. **/
 
         /** @brief Generates blueprints for this class. **/
-        typedef BluePrintFactory< Array<Type,DynamicStorage> > Factory;
+        typedef BluePrintFactory< Array<Type,DynamicStorage,Allocator> > Factory;
 
         /*********************
         ** Constructors
@@ -153,7 +177,13 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
          *
          * Does not reserve any storage for the array. Just creates the container object.
          */
-        explicit Array() : buffer_size(0), buffer(NULL) {}
+        explicit Array() : buffer_size(0), buffer_capacity(0), buffer(NULL) {}
+        /**
+         * @brief Does not reserve any storage, but takes a copy of the allocator to use.
+         *
+         * @param allocator : allocator that will provide the storage.
+         */
+        explicit Array(const Allocator &allocator) : buffer_size(0), buffer_capacity(0), buffer(NULL), storage_allocator(allocator) {}
         /**
          * @brief Reserves storage for the array.
          *
@@ -161,9 +191,17 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
          * The values are left uninitialised.
          *
          * @param reserve_size : the number of elements to be allocated to the container.
+         * @param allocator : allocator that will provide the storage.
          */
-        explicit Array(const unsigned int reserve_size) : buffer_size(reserve_size), buffer(NULL) {
-			buffer = new Type[reserve_size];
+        explicit Array(const unsigned int reserve_size, const Allocator &allocator = Allocator()) :
+            buffer_size(0),
+            buffer_capacity(0),
+            buffer(NULL),
+            storage_allocator(allocator)
+        {
+            buffer = allocate(reserve_size);
+            buffer_size = reserve_size;
+            buffer_capacity = reserve_size;
         };
         /**
          * @brief Copy constructor.
@@ -172,16 +210,36 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
          *
          * @param array : the array to copy from.
          */
-        Array(const Array<Type,DynamicStorage>& array) :
+        Array(const Array<Type,DynamicStorage,Allocator>& array) :
         	Factory(),
         	buffer_size(0),
-        	buffer(NULL)
+        	buffer_capacity(0),
+        	buffer(NULL),
+        	storage_allocator(std::allocator_traits<Allocator>::select_on_container_copy_construction(array.storage_allocator))
 		{
         	if ( array.size() != 0 ) {
 				resize(array.size());
 				std::copy(array.begin(),array.end(),begin());
         	}
         }
+        /**
+         * @brief Move constructor.
+         *
+         * Takes over the other array's storage (and allocator), leaving it empty.
+         *
+         * @param array : the array to move from.
+         */
+        Array(Array<Type,DynamicStorage,Allocator>&& array) noexcept :
+            Factory(),
+            buffer_size(array.buffer_size),
+            buffer_capacity(array.buffer_capacity),
+            buffer(array.buffer),
+            storage_allocator(std::move(array.storage_allocator))
+        {
+            array.buffer_size = 0;
+            array.buffer_capacity = 0;
+            array.buffer = NULL;
+        }
         /**
          * @brief Blueprint constructor.
          *
@@ -203,7 +261,7 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
          * @param blueprint : the blue print to use to generate this instance.
          */
         template<typename T>
-        Array(const blueprints::ArrayBluePrint< T > &blueprint) : buffer_size(0), buffer(NULL) {
+        Array(const blueprints::ArrayBluePrint< T > &blueprint) : buffer_size(0), buffer_capacity(0), buffer(NULL) {
             // Note we're using a partially specialised parent interface here otherwise the
             // constructor that reserves sizes as well as the comma initialiser won't
             // conveniently convert types correctly
@@ -217,9 +275,7 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
          * It cleans up the memory that was used on the heap.
          **/
         ~Array() {
-            if ( buffer != NULL ) {
-                delete[] buffer;
-            }
+            release();
         }
         /*********************
         ** Assignment
@@ -241,13 +297,46 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
             return containers::BoundedListInitialiser<value_type,iterator,DynamicStorage>(value,buffer,buffer_size);
         }
 
-        void operator=(const Array<Type,DynamicStorage>& array) {
+        /**
+         * @brief Copy the contents of another array.
+         *
+         * Reuses the storage if it is large enough.
+         *
+         * @param array : the array to copy from.
+         * @return Array : this array.
+         */
+        Array<Type,DynamicStorage,Allocator>& operator=(const Array<Type,DynamicStorage,Allocator>& array) {
+        	if ( &array == this ) {
+        		return *this;
+        	}
         	if ( array.size() == 0 ) {
         		clear();
         	} else {
 				resize(array.size());
 				std::copy(array.begin(),array.end(),begin());
         	}
+        	return *this;
+        }
+        /**
+         * @brief Take over the storage (and allocator) of another array.
+         *
+         * Releases this array's storage and leaves the other array empty.
+         *
+         * @param array : the array to move from.
+         * @return Array : this array.
+         */
+        Array<Type,DynamicStorage,Allocator>& operator=(Array<Type,DynamicStorage,Allocator>&& array) noexcept {
+        	if ( &array != this ) {
+        		release();
+        		buffer_size = array.buffer_size;
+        		buffer_capacity = array.buffer_capacity;
+        		buffer = array.buffer;
+        		storage_allocator = std::move(array.storage_allocator);
+        		array.buffer_size = 0;
+        		array.buffer_capacity = 0;
+        		array.buffer = NULL;
+        	}
+        	return *this;
         }
 
         /*********************
@@ -392,10 +481,10 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
          *
          * @exception : StandardException : throws if the indices provided are out of range [debug mode only].
          */
-        Stencil< Array<Type,DynamicStorage> > stencil(const unsigned int& start_index, const unsigned int& n) {
+        Stencil< Array<Type,DynamicStorage,Allocator> > stencil(const unsigned int& start_index, const unsigned int& n) {
         	ecl_assert_throw(start_index < size(), StandardException(LOC, OutOfRangeError, "Start index provided is larger than the underlying array size."));
         	ecl_assert_throw(start_index+n <= size(), StandardException(LOC, OutOfRangeError, "Finish index provided is larger than the underlying array size."));
-        	return Stencil< Array<Type,DynamicStorage> >(*this, begin()+start_index, begin()+start_index+n);
+        	return Stencil< Array<Type,DynamicStorage,Allocator> >(*this, begin()+start_index, begin()+start_index+n);
         }
         /**
          * Accesses elements in the array, returning references to the requested element. This
@@ -471,33 +560,76 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
          * @return size_type : the size of the array.
          */
         size_type size() const { return buffer_size; }
+        /**
+         * @brief The number of elements the storage can hold without reallocating.
+         *
+         * @return size_type : the capacity of the array.
+         */
+        size_type capacity() const { return buffer_capacity; }
+        /**
+         * @brief The allocator providing the storage.
+         *
+         * @return Allocator : a copy of the allocator.
+         */
+        allocator_type get_allocator() const { return storage_allocator; }
 
         /**
          * @brief Resize the array, clearing whatever was in there before.
          *
-         * This resizes the array. Take care with this as it will clear whatever was
-         * previously stored in the buffer. All values are uninitialised after clearing.
+         * Within the capacity this just changes the size and keeps the leading
+         * elements. Beyond it, take care as the storage is reallocated and whatever
+         * was previously stored in the buffer is lost. All values are uninitialised
+         * after reallocating.
          *
          * @param n : the new size to be allocated for the array.
          */
         void resize( size_t n ) {
-            if ( buffer != NULL ) {
-                delete[] buffer;
+            if ( ( buffer == NULL ) || ( n > buffer_capacity ) ) {
+                release();
+                buffer = allocate(n);
+                buffer_capacity = n;
             }
-            buffer = new Type[n];
             buffer_size = n;
         }
+        /**
+         * @brief Make sure the storage can hold n elements, keeping the contents.
+         *
+         * Does nothing if the capacity is already large enough.
+         *
+         * @param n : the number of elements to make room for.
+         */
+        void reserve( size_t n ) {
+            if ( ( buffer != NULL ) && ( n <= buffer_capacity ) ) {
+                return;
+            }
+            reallocate(n);
+        }
+        /**
+         * @brief Release any storage beyond the current size, keeping the contents.
+         */
+        void shrink_to_fit() {
+            if ( ( buffer != NULL ) && ( buffer_capacity > buffer_size ) ) {
+                reallocate(buffer_size);
+            }
+        }
         /**
          * @brief Clear the array, deleting all storage space previously allocated.
          *
          * Clear the array, deleting all storage space previously allocated.
          */
         void clear() {
-            if ( buffer != NULL ) {
-                delete[] buffer;
-                buffer = NULL;
-            }
-            buffer_size = 0;
+            release();
+        }
+        /**
+         * @brief Swap the contents (storage and allocators) of two arrays.
+         *
+         * @param array : the array to swap with.
+         */
+        void swap(Array<Type,DynamicStorage,Allocator>& array) {
+            std::swap(buffer_size, array.buffer_size);
+            std::swap(buffer_capacity, array.buffer_capacity);
+            std::swap(buffer, array.buffer);
+            std::swap(storage_allocator, array.storage_allocator);
         }
 
         /*********************
@@ -510,12 +642,62 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
          * @param array : the array to be inserted.
          * @return OutputStream : continue streaming with the updated output stream.
          */
-        template <typename OutputStream, typename ElementType>
-        friend OutputStream& operator<<(OutputStream &ostream , const Array<ElementType,DynamicStorage> &array);
+        template <typename OutputStream, typename ElementType, typename ElementAllocator>
+        friend OutputStream& operator<<(OutputStream &ostream , const Array<ElementType,DynamicStorage,ElementAllocator> &array);
 
     private:
+        typedef std::allocator_traits<Allocator> AllocatorTraits;
+
+        /**
+         * @brief Allocate and default construct n elements (fundamental types stay uninitialised).
+         */
+        Type* allocate(const size_t &n) {
+            Type *storage = AllocatorTraits::allocate(storage_allocator, n);
+            size_t constructed = 0;
+            try {
+                for ( ; constructed < n; ++constructed ) {
+                    ::new (static_cast<void*>(storage + constructed)) Type;
+                }
+            } catch ( ... ) {
+                destroy(storage, constructed);
+                AllocatorTraits::deallocate(storage_allocator, storage, n);
+                throw;
+            }
+            return storage;
+        }
+        static void destroy(Type *storage, const size_t &n) {
+            for ( size_t i = 0; i < n; ++i ) {
+                storage[i].~Type();
+            }
+        }
+        /**
+         * @brief Move the contents into new storage for n elements.
+         */
+        void reallocate(const size_t &n) {
+            Type *storage = allocate(n);
+            const size_t kept = std::min<size_t>(buffer_size, n);
+            if ( buffer != NULL ) {
+                std::move(buffer, buffer + kept, storage);
+            }
+            release();
+            buffer = storage;
+            buffer_size = kept;
+            buffer_capacity = n;
+        }
+        void release() {
+            if ( buffer != NULL ) {
+                destroy(buffer, buffer_capacity);
+                AllocatorTraits::deallocate(storage_allocator, buffer, buffer_capacity);
+                buffer = NULL;
+            }
+            buffer_size = 0;
+            buffer_capacity = 0;
+        }
+
         unsigned int buffer_size;
+        unsigned int buffer_capacity;
         Type *buffer;
+        Allocator storage_allocator;
 
 };
 
@@ -523,8 +705,8 @@ class ECL_PUBLIC Array<Type,DynamicStorage> : public BluePrintFactory< Array<Typ
 ** Implementation [Array]
 *****************************************************************************/
 
-template <typename OutputStream, typename ElementType>
-OutputStream& operator<<(OutputStream &ostream , const Array<ElementType,DynamicStorage> &array) {
+template <typename OutputStream, typename ElementType, typename ElementAllocator>
+OutputStream& operator<<(OutputStream &ostream , const Array<ElementType,DynamicStorage,ElementAllocator> &array) {
 
     ostream << "[ ";
     for(size_t i = 0; i < array.buffer_size; ++i )
@@ -606,9 +788,10 @@ class ConstantDynamicArray: public ArrayBluePrint< ConstantDynamicArray<Type> >
          * Fill all elements of an existing array with a constant value.
          * Note that this clears whatever was initially in the array.
          *
-         * @param array : the array to fill.
+         * @param array : the array to fill (any allocator).
          */
-        void apply(base_type& array) const {
+        template <typename DynamicArray>
+        void apply(DynamicArray& array) const {
             array.resize(reserve_size);
             std::fill_n(array.begin(),reserve_size,val);
         }
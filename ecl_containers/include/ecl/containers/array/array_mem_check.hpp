@@ -20,6 +20,7 @@
 #include <algorithm> // std::copy
 #include <cstddef>  // size_t
 #include <iterator>
+#include "../common/allocators.hpp"
 #include "../definitions.hpp"
 #include "../initialiser.hpp"
 #include "../stencil.hpp"
@@ -99,10 +100,12 @@ template <typename Type, size_t N> class ArrayFormatter;
  * @endcode
  *
  * @tparam Type : the type of the element stored in the array.
+ * @tparam Size : the number of elements, DynamicStorage for the heap allocated specialisation.
+ * @tparam Allocator : only used by dynamically sized arrays.
  *
  * @sa @ref ecl::containers::BoundedListInitialiser "BoundedListInitialiser", @ref ecl::blueprints::ArrayFactory "ArrayFactory".
  **/
-template<typename Type, std::size_t Size = DynamicStorage>
+template<typename Type, std::size_t Size = DynamicStorage, typename Allocator = AlignedAllocator<Type> >
 class ECL_PUBLIC Array : public blueprints::ArrayFactory<Type,Size> {
     public:
         /*********************
@@ -349,8 +352,8 @@ class ECL_PUBLIC Array : public blueprints::ArrayFactory<Type,Size> {
          * @param array : the array to be inserted.
          * @return OutputStream : continue streaming with the updated output stream.
          */
-        template <typename OutputStream, typename ElementType, size_t ArraySize>
-        friend OutputStream& operator<<(OutputStream &ostream , const Array<ElementType,ArraySize> &array);
+        template <typename OutputStream, typename ElementType, size_t ArraySize, typename ElementAllocator>
+        friend OutputStream& operator<<(OutputStream &ostream , const Array<ElementType,ArraySize,ElementAllocator> &array);
 
         /******************************************
 		** Buffer under/overrun checks
@@ -388,8 +391,8 @@ class ECL_PUBLIC Array : public blueprints::ArrayFactory<Type,Size> {
  * Initialise the under and overrun sections with a magic char. This is later
  * checked to see if its been disturbed.
  */
-template<typename Type, size_t Size>
-void Array<Type,Size>::initialiseMagicSections() {
+template<typename Type, size_t Size, typename Allocator>
+void Array<Type,Size,Allocator>::initialiseMagicSections() {
 
 	for ( unsigned int i = 0; i < bufferUnderrunLength(); ++i ) {
 		underrun[i] = magicChar();
@@ -408,8 +411,8 @@ void Array<Type,Size>::initialiseMagicSections() {
  *
  * @return bool : true if a buffer overrun is detected, false otherwise.
  */
-template<typename Type, size_t Size>
-bool Array<Type,Size>::bufferOverRun() {
+template<typename Type, size_t Size, typename Allocator>
+bool Array<Type,Size,Allocator>::bufferOverRun() {
 
 	for ( unsigned int i = 0; i < bufferOverrunLength(); ++i ) {
 		if ( overrun[i] != magicChar() ) {
@@ -427,8 +430,8 @@ bool Array<Type,Size>::bufferOverRun() {
  * an under/overrun has occurred.
  * @return bool : true if a buffer underrun is detected, false otherwise.
  */
-template<typename Type, size_t Size>
-bool Array<Type,Size>::bufferUnderRun() {
+template<typename Type, size_t Size, typename Allocator>
+bool Array<Type,Size,Allocator>::bufferUnderRun() {
 	for ( unsigned int i = 0; i < bufferUnderrunLength(); ++i ) {
 		if ( underrun[i] != magicChar() ) {
 			return true;
@@ -445,8 +448,8 @@ bool Array<Type,Size>::bufferUnderRun() {
  *
  * @return bool : true if a buffer overflow is detected, false otherwise.
  */
-template<typename Type, size_t Size>
-bool Array<Type,Size>::bufferOverFlow() {
+template<typename Type, size_t Size, typename Allocator>
+bool Array<Type,Size,Allocator>::bufferOverFlow() {
 	return ( bufferOverRun() || bufferUnderRun() );
 }
 
@@ -455,8 +458,8 @@ bool Array<Type,Size>::bufferOverFlow() {
 ** Implementation [Array][Streaming]
 *****************************************************************************/
 
-template <typename OutputStream, typename ElementType, size_t ArraySize>
-OutputStream& operator<<(OutputStream &ostream , const Array<ElementType,ArraySize> &array) {
+template <typename OutputStream, typename ElementType, size_t ArraySize, typename ElementAllocator>
+OutputStream& operator<<(OutputStream &ostream , const Array<ElementType,ArraySize,ElementAllocator> &array) {
 
 	ecl_compile_time_concept_check(StreamConcept<OutputStream>);
 
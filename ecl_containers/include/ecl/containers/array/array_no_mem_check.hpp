@@ -20,6 +20,7 @@
 #include <algorithm> // std::copy
 #include <cstddef>  // size_t
 #include <iterator>
+#include "../common/allocators.hpp"
 #include "../definitions.hpp"
 #include "../initialiser.hpp"
 #include "../stencil.hpp"
@@ -99,10 +100,12 @@ template <typename Type, size_t N> class ArrayFormatter;
  * @endcode
  *
  * @tparam Type : the type of the element stored in the array.
+ * @tparam Size : the number of elements, DynamicStorage for the heap allocated specialisation.
+ * @tparam Allocator : only used by dynamically sized arrays.
  *
  * @sa @ref ecl::containers::BoundedListInitialiser "BoundedListInitialiser", @ref blueprints::ArrayFactory "ArrayFactory".
  **/
-template<typename Type, std::size_t Size = DynamicStorage>
+template<typename Type, std::size_t Size = DynamicStorage, typename Allocator = AlignedAllocator<Type> >
 class ECL_PUBLIC Array : public blueprints::ArrayFactory<Type,Size> {
     public:
         /*********************
@@ -349,8 +352,8 @@ class ECL_PUBLIC Array : public blueprints::ArrayFactory<Type,Size> {
          * @param array : the array to be inserted.
          * @return OutputStream : continue streaming with the updated output stream.
          */
-        template <typename OutputStream, typename ElementType, size_t ArraySize>
-        friend OutputStream& operator<<(OutputStream &ostream , const Array<ElementType,ArraySize> &array);
+        template <typename OutputStream, typename ElementType, size_t ArraySize, typename ElementAllocator>
+        friend OutputStream& operator<<(OutputStream &ostream , const Array<ElementType,ArraySize,ElementAllocator> &array);
 
     private:
         value_type elements[Size];
@@ -360,8 +363,8 @@ class ECL_PUBLIC Array : public blueprints::ArrayFactory<Type,Size> {
 ** Implementation [Array][Insertion Operators]
 *****************************************************************************/
 
-template <typename OutputStream, typename ElementType, size_t ArraySize>
-OutputStream& operator<<(OutputStream &ostream , const Array<ElementType,ArraySize> &array) {
+template <typename OutputStream, typename ElementType, size_t ArraySize, typename ElementAllocator>
+OutputStream& operator<<(OutputStream &ostream , const Array<ElementType,ArraySize,ElementAllocator> &array) {
 
 	ecl_compile_time_concept_check(StreamConcept<OutputStream>);
 
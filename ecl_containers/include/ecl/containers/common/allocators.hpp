@@ -0,0 +1,130 @@
+/**
+ * @file /include/ecl/containers/common/allocators.hpp
+ *
+ * @brief Allocators for the dynamic containers.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_CONTAINERS_COMMON_ALLOCATORS_HPP_
+#define ECL_CONTAINERS_COMMON_ALLOCATORS_HPP_
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <ecl/config/ecl.hpp>
+#include <ecl/config/macros.hpp>
+#include <ecl/errors/compile_time_assert.hpp>
+
+#if defined(ECL_IS_WIN32)
+  #include <malloc.h>
+#endif
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Interface [AlignedAllocator]
+*****************************************************************************/
+/**
+ * @brief Standard allocator handing out aligned storage.
+ *
+ * The default allocator for dynamic arrays. Aligning to a cache line (64
+ * bytes) means vectorised loops and Eigen maps over the array start on
+ * a boundary that suits every SSE/AVX load and no element straddles two
+ * lines unnecessarily.
+ *
+ * It meets the standard allocator requirements, so it can also be
+ * plugged into stl containers.
+ *
+ * @code
+ * std::vector<float, ecl::AlignedAllocator<float,32> > samples;
+ * @endcode
+ *
+ * @tparam Type : the element type.
+ * @tparam Alignment : a power of two, at least the alignment of Type (and of a pointer).
+ */
+template <typename Type, std::size_t Alignment = 64>
+class ECL_PUBLIC AlignedAllocator {
+public:
+  typedef Type value_type; /**< @brief Allocated element type. **/
+  static const std::size_t alignment = Alignment; /**< @brief Alignment of the storage [bytes]. **/
+
+  /**
+   * @brief Rebinds the allocator to another element type.
+   */
+  template <typename Other>
+  struct rebind {
+    typedef AlignedAllocator<Other,Alignment> other;
+  };
+
+  AlignedAllocator() {}
+  template <typename Other>
+  AlignedAllocator(const AlignedAllocator<Other,Alignment>& /* other */) {}
+
+  /**
+   * @brief Allocate (but don't construct) storage for n elements.
+   *
+   * @param n : number of elements.
+   * @return Type* : aligned storage, never NULL (even for n = 0).
+   *
+   * @exception std::bad_alloc : if the storage couldn't be allocated.
+   */
+  Type* allocate(std::size_t n) {
+    ecl_compile_time_assert( ( Alignment & ( Alignment - 1 ) ) == 0 );
+    ecl_compile_time_assert( ( Alignment >= alignof(Type) ) && ( Alignment >= sizeof(void*) ) );
+    if ( n > static_cast<std::size_t>(-1)/sizeof(Type) ) {
+      throw std::bad_alloc();
+    }
+    const std::size_t bytes = ( n == 0 ) ? 1 : n*sizeof(Type);
+    void *storage = NULL;
+    #if defined(ECL_IS_WIN32)
+      storage = _aligned_malloc(bytes, Alignment);
+    #else
+      if ( posix_memalign(&storage, Alignment, bytes) != 0 ) {
+        storage = NULL;
+      }
+    #endif
+    if ( storage == NULL ) {
+      throw std::bad_alloc();
+    }
+    return static_cast<Type*>(storage);
+  }
+  /**
+   * @brief Release storage from allocate().
+   *
+   * @param storage : as returned by allocate().
+   */
+  void deallocate(Type *storage, std::size_t /* n */) {
+    #if defined(ECL_IS_WIN32)
+      _aligned_free(storage);
+    #else
+      free(storage);
+    #endif
+  }
+};
+
+/**
+ * @brief Storage from any aligned allocator can be released by any other.
+ */
+template <typename Type, typename Other, std::size_t Alignment>
+bool operator==(const AlignedAllocator<Type,Alignment>& /* lhs */, const AlignedAllocator<Other,Alignment>& /* rhs */) { return true; }
+/**
+ * @brief Storage from any aligned allocator can be released by any other.
+ */
+template <typename Type, typename Other, std::size_t Alignment>
+bool operator!=(const AlignedAllocator<Type,Alignment>& /* lhs */, const AlignedAllocator<Other,Alignment>& /* rhs */) { return false; }
+
+} // namespace ecl
+
+#endif /* ECL_CONTAINERS_COMMON_ALLOCATORS_HPP_ */
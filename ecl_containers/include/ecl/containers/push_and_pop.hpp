@@ -20,6 +20,7 @@
 
 #include "push_and_pop/push_and_pop_dynamic.hpp"
 #include "push_and_pop/push_and_pop_fixed.hpp"
+#include "push_and_pop/push_and_pop_spsc.hpp"
 
 // make sure the utility classes get included.
 #include "push_and_pop/formatters.hpp"
@@ -0,0 +1,234 @@
+/**
+ * @file /include/ecl/containers/push_and_pop/push_and_pop_spsc.hpp
+ *
+ * @brief Lock-free single producer, single consumer variant of PushAndPop.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+ ** Ifdefs
+ *****************************************************************************/
+
+#ifndef ECL_CONTAINERS_PUSH_AND_POP_SPSC_HPP_
+#define ECL_CONTAINERS_PUSH_AND_POP_SPSC_HPP_
+
+/*****************************************************************************
+ ** Includes
+ *****************************************************************************/
+
+#include <atomic>
+#include <cstddef>
+#include <ecl/config/macros.hpp>
+#include <ecl/errors/compile_time_assert.hpp>
+#include "../array.hpp"
+
+/*****************************************************************************
+ ** Namespaces
+ *****************************************************************************/
+
+namespace ecl
+{
+namespace containers
+{
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+/**
+ * @brief Compile time rounding up to the next power of two.
+ *
+ * Used to size the underlying storage of the lock-free containers so
+ * that indices can be wrapped with a mask instead of a modulo.
+ *
+ * @param n : the value to round up (n > 0).
+ * @return std::size_t : smallest power of two >= n.
+ */
+constexpr std::size_t next_power_of_two(std::size_t n)
+{
+  std::size_t power = 1;
+  while ( power < n ) { power <<= 1; }
+  return power;
+}
+
+} // namespace containers
+
+/*****************************************************************************
+ ** Interface
+ *****************************************************************************/
+/**
+ * @brief Lock-free, fixed size ring buffer for one producer and one consumer.
+ *
+ * A thread-safe variant of the fixed PushAndPop container for the common
+ * case of handing data from exactly one producing thread (e.g. a serial
+ * reader) to exactly one consuming thread (e.g. a control loop) without
+ * a mutex.
+ *
+ * - push_back() may only be called from the producer thread.
+ * - pop_front() and front() may only be called from the consumer thread.
+ * - size(), empty() and full() can be called from either, but are
+ *   only snapshots when the other thread is active.
+ *
+ * Unlike PushAndPop, a full buffer does not discard the oldest element
+ * (the producer may not touch the consumer's index), so push_back()
+ * reports failure instead.
+ *
+ * The leader (written by the producer) and follower (written by the
+ * consumer) indices live on separate cache lines and are published with
+ * release/acquire semantics. Each side also keeps a cached copy of the
+ * other side's index so it only touches the shared cache line when the
+ * buffer appears full (producer) or empty (consumer). Storage is rounded
+ * up to a power of two so that indices wrap with a mask.
+ *
+ * <b>Usage</b>:
+ *
+ * @code
+ * SpscPushAndPop<Sample, 64> samples;
+ *
+ * // producer thread
+ * if ( !samples.push_back(sample) ) { ++dropped; }
+ *
+ * // consumer thread
+ * Sample sample;
+ * while ( samples.pop_front(sample) ) { process(sample); }
+ * @endcode
+ *
+ * @tparam Type : element type (must be default constructible and assignable).
+ * @tparam Size : maximum number of elements held at any one time.
+ *
+ * @sa ecl::PushAndPop.
+ */
+template<typename Type, std::size_t Size>
+class ECL_PUBLIC SpscPushAndPop
+{
+public:
+  typedef Type        value_type; /**< Element type. **/
+  typedef std::size_t size_type;  /**< Type used to denote the length of the buffer. **/
+
+  static const std::size_t cache_line_size = 64; /**< @brief Padding used to separate the indices. **/
+  static const std::size_t storage_size = containers::next_power_of_two(Size); /**< @brief Underlying (masked) storage length. **/
+
+  SpscPushAndPop() :
+    leader(0),
+    follower_cache(0),
+    follower(0),
+    leader_cache(0)
+  {
+    ecl_compile_time_assert( Size > 0 );
+  }
+
+  virtual ~SpscPushAndPop() {}
+
+  /*********************
+  ** Producer
+  **********************/
+  /**
+   * @brief Pushes an element onto the back of the buffer [producer only].
+   *
+   * @param datum : element to copy into the buffer.
+   * @return bool : false if the buffer was full and the element was not stored.
+   */
+  bool push_back(const Type & datum)
+  {
+    const std::size_t current = leader.load(std::memory_order_relaxed);
+    if ( current - follower_cache == Size ) {
+      follower_cache = follower.load(std::memory_order_acquire);
+      if ( current - follower_cache == Size ) {
+        return false;
+      }
+    }
+    data[current & mask] = datum;
+    leader.store(current + 1, std::memory_order_release);
+    return true;
+  }
+
+  /*********************
+  ** Consumer
+  **********************/
+  /**
+   * @brief Pops the oldest element off the front of the buffer [consumer only].
+   *
+   * @param datum : storage for the popped element.
+   * @return bool : false if the buffer was empty (datum is untouched).
+   */
+  bool pop_front(Type & datum)
+  {
+    const std::size_t current = follower.load(std::memory_order_relaxed);
+    if ( current == leader_cache ) {
+      leader_cache = leader.load(std::memory_order_acquire);
+      if ( current == leader_cache ) {
+        return false;
+      }
+    }
+    datum = data[current & mask];
+    follower.store(current + 1, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Peek at the oldest element without removing it [consumer only].
+   *
+   * @return Type* : pointer to the element or NULL if the buffer is empty.
+   */
+  Type* front()
+  {
+    const std::size_t current = follower.load(std::memory_order_relaxed);
+    if ( current == leader_cache ) {
+      leader_cache = leader.load(std::memory_order_acquire);
+      if ( current == leader_cache ) {
+        return NULL;
+      }
+    }
+    return &data[current & mask];
+  }
+
+  /*********************
+  ** Queries
+  **********************/
+  /**
+   * @brief Number of elements currently in the buffer.
+   *
+   * This is only a snapshot if the other thread is concurrently active.
+   *
+   * @return unsigned int : number of stored elements.
+   */
+  unsigned int size() const
+  {
+    const std::size_t tail = follower.load(std::memory_order_acquire);
+    const std::size_t head = leader.load(std::memory_order_acquire);
+    return static_cast<unsigned int>(head - tail);
+  }
+  bool empty() const { return size() == 0; }
+  bool full() const { return size() == Size; }
+  /**
+   * @brief Maximum number of elements the buffer can hold.
+   *
+   * @return unsigned int : the Size template parameter.
+   */
+  unsigned int asize() const { return Size; }
+
+private:
+  static const std::size_t mask = storage_size - 1;
+
+  // padding rather than alignas so heap allocation needs no over-aligned new
+  char padding_front[cache_line_size];
+  // producer side
+  std::atomic<std::size_t> leader;
+  std::size_t follower_cache;
+  char padding_producer[cache_line_size];
+  // consumer side
+  std::atomic<std::size_t> follower;
+  std::size_t leader_cache;
+  char padding_consumer[cache_line_size];
+  ecl::Array<Type, storage_size> data;
+};
+
+template<typename Type, std::size_t Size>
+const std::size_t SpscPushAndPop<Type,Size>::storage_size;
+
+template<typename Type, std::size_t Size>
+const std::size_t SpscPushAndPop<Type,Size>::mask;
+
+} // namespace ecl
+
+#endif /* ECL_CONTAINERS_PUSH_AND_POP_SPSC_HPP_ */
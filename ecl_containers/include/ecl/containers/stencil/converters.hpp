@@ -31,7 +31,7 @@ namespace ecl {
 ** Forware Declarations
 *****************************************************************************/
 
-template<typename Type, std::size_t Size> class Array;
+template<typename Type, std::size_t Size, typename Allocator> class Array;
 
 /*****************************************************************************
 ** Interface [Array]
@@ -40,38 +40,38 @@ template<typename Type, std::size_t Size> class Array;
 /**
  * @brief Specialisation for integral to char Stencil conversions.
  */
-template <typename Integral, std::size_t Size>
-class ECL_PUBLIC Converter < Stencil< Array<char,Size> >, Integral > : public converters::IntegralToByteArray< Stencil< Array<char,Size> >, Integral > {};
+template <typename Integral, std::size_t Size, typename Allocator>
+class ECL_PUBLIC Converter < Stencil< Array<char,Size,Allocator> >, Integral > : public converters::IntegralToByteArray< Stencil< Array<char,Size,Allocator> >, Integral > {};
 
 /**
  * @brief Specialisation for integral to unsigned char Stencil conversions.
  */
-template <typename Integral, std::size_t Size>
-class ECL_PUBLIC Converter < Stencil< Array<unsigned char,Size> >, Integral > : public converters::IntegralToByteArray< Stencil< Array<unsigned char,Size> >, Integral > {};
+template <typename Integral, std::size_t Size, typename Allocator>
+class ECL_PUBLIC Converter < Stencil< Array<unsigned char,Size,Allocator> >, Integral > : public converters::IntegralToByteArray< Stencil< Array<unsigned char,Size,Allocator> >, Integral > {};
 
 /**
  * @brief Specialisation for integral to signed char Stencil conversions.
  */
-template <typename Integral, std::size_t Size>
-class ECL_PUBLIC Converter < Stencil< Array<signed char,Size> >, Integral > : public converters::IntegralToByteArray< Stencil< Array<signed char,Size> >, Integral > {};
+template <typename Integral, std::size_t Size, typename Allocator>
+class ECL_PUBLIC Converter < Stencil< Array<signed char,Size,Allocator> >, Integral > : public converters::IntegralToByteArray< Stencil< Array<signed char,Size,Allocator> >, Integral > {};
 
 /**
  * @brief Specialisation for char Stencil container based FromByteArray converter.
  */
-template <typename Integral, std::size_t Size>
-class ECL_PUBLIC Converter <Integral, Stencil< Array<char,Size> > > : public converters::FromByteArray< Integral, Stencil< Array<char,Size> > > {};
+template <typename Integral, std::size_t Size, typename Allocator>
+class ECL_PUBLIC Converter <Integral, Stencil< Array<char,Size,Allocator> > > : public converters::FromByteArray< Integral, Stencil< Array<char,Size,Allocator> > > {};
 
 /**
  * @brief Specialisation for unsigned char Stencil container based FromByteArray converter.
  */
-template <typename Integral, std::size_t Size>
-class ECL_PUBLIC Converter <Integral, Stencil< Array<unsigned char,Size> > > : public converters::FromByteArray< Integral, Stencil< Array<unsigned char,Size> > > {};
+template <typename Integral, std::size_t Size, typename Allocator>
+class ECL_PUBLIC Converter <Integral, Stencil< Array<unsigned char,Size,Allocator> > > : public converters::FromByteArray< Integral, Stencil< Array<unsigned char,Size,Allocator> > > {};
 
 /**
  * @brief Specialisation for signed char Stencil container based FromByteArray converter.
  */
-template <typename Integral, std::size_t Size>
-class ECL_PUBLIC Converter <Integral, Stencil< Array<signed char,Size> > > : public converters::FromByteArray< Integral, Stencil< Array<signed char,Size> > > {};
+template <typename Integral, std::size_t Size, typename Allocator>
+class ECL_PUBLIC Converter <Integral, Stencil< Array<signed char,Size,Allocator> > > : public converters::FromByteArray< Integral, Stencil< Array<signed char,Size,Allocator> > > {};
 
 /**
  * @brief Specialisation for unsigned int to vector based unsigned char Stencil container.
@@ -9,7 +9,10 @@
 ** Includes
 *****************************************************************************/
 
+#include <cstdint>
 #include <iostream>
+#include <new>
+#include <utility>
 #include <gtest/gtest.h>
 #include "../../include/ecl/containers/array.hpp"
 
@@ -22,6 +25,26 @@ using ecl::blueprints::ArrayFactory;
 using ecl::blueprints::ConstantArray;
 using ecl::StandardException;
 using ecl::ContainerConcept;
+using ecl::DynamicStorage;
+
+/*****************************************************************************
+** Allocators
+*****************************************************************************/
+
+template <typename Type>
+class CountingAllocator {
+public:
+    typedef Type value_type;
+    CountingAllocator() {}
+    template <typename Other>
+    CountingAllocator(const CountingAllocator<Other>& /* other */) {}
+    Type* allocate(std::size_t n) { ++allocations; return static_cast<Type*>(::operator new(n*sizeof(Type))); }
+    void deallocate(Type *storage, std::size_t /* n */) { ::operator delete(storage); }
+    static int allocations;
+};
+
+template <typename Type>
+int CountingAllocator<Type>::allocations = 0;
 
 /*****************************************************************************
 ** Tests
@@ -160,6 +183,74 @@ TEST(ArrayMemCheckTests,resize) {
 	darray.clear();
 }
 
+TEST(ArrayMemCheckTests,moves) {
+    Array<int> darray = Array<int>::Constant(4,3);
+    const int *storage = darray.begin();
+    Array<int> moved(std::move(darray));
+    EXPECT_EQ(4u,moved.size());
+    EXPECT_EQ(storage,moved.begin()); // handed over, not copied
+    EXPECT_EQ(0u,darray.size());
+    Array<int> assigned(2);
+    assigned = std::move(moved);
+    EXPECT_EQ(storage,assigned.begin());
+    EXPECT_EQ(3,assigned[3]);
+    EXPECT_EQ(0u,moved.size());
+    moved = assigned; // usable again after being moved from
+    EXPECT_EQ(4u,moved.size());
+    EXPECT_EQ(3,moved[0]);
+    moved.swap(darray);
+    EXPECT_EQ(0u,moved.size());
+    EXPECT_EQ(4u,darray.size());
+}
+
+TEST(ArrayMemCheckTests,capacity) {
+#ifndef ECL_MEM_CHECK_ARRAYS
+    Array<int> darray(10);
+    darray << 0,1,2,3,4,5,6,7,8,9;
+    const int *storage = darray.begin();
+    darray.resize(4); // shrinking reuses the storage
+    EXPECT_EQ(4u,darray.size());
+    EXPECT_EQ(10u,darray.capacity());
+    EXPECT_EQ(storage,darray.begin());
+    EXPECT_EQ(3,darray[3]);
+    darray.resize(10); // and so does growing back
+    EXPECT_EQ(storage,darray.begin());
+    darray.resize(4);
+    darray.reserve(100); // reallocates, but keeps the contents
+    EXPECT_EQ(4u,darray.size());
+    EXPECT_EQ(100u,darray.capacity());
+    EXPECT_EQ(3,darray[3]);
+    darray.shrink_to_fit();
+    EXPECT_EQ(4u,darray.capacity());
+    EXPECT_EQ(2,darray[2]);
+    darray.clear();
+    EXPECT_EQ(0u,darray.capacity());
+#else
+    SUCCEED(); // memory checking arrays always reallocate
+#endif
+}
+
+TEST(ArrayMemCheckTests,allocators) {
+#ifndef ECL_MEM_CHECK_ARRAYS
+    Array<double> samples(5);
+    EXPECT_EQ(0u,reinterpret_cast<std::uintptr_t>(samples.begin()) % 64);
+    Array<double,DynamicStorage,ecl::AlignedAllocator<double,32> > avx(3);
+    EXPECT_EQ(0u,reinterpret_cast<std::uintptr_t>(avx.begin()) % 32);
+    typedef Array<int,DynamicStorage,CountingAllocator<int> > CountedArray;
+    CountingAllocator<int>::allocations = 0;
+    CountedArray counted(8);
+    counted.resize(2);
+    counted.resize(8);
+    EXPECT_EQ(1,CountingAllocator<int>::allocations);
+    CountedArray constant = CountedArray::Constant(4,7); // blueprints work with any allocator
+    EXPECT_EQ(7,constant[3]);
+    CountedArray moved(std::move(counted));
+    EXPECT_EQ(2,CountingAllocator<int>::allocations);
+#else
+    SUCCEED(); // memory checking arrays ignore the allocator
+#endif
+}
+
 TEST(ArrayMemCheckTests,concepts) {
 	typedef Array<char,6> ByteArray;
 	ecl_compile_time_concept_check(ContainerConcept<ByteArray>);
@@ -10,6 +10,7 @@
  *****************************************************************************/
 
 #include <iostream>
+#include <thread>
 #include <gtest/gtest.h>
 #include "../../include/ecl/containers/array.hpp"
 #include "../../include/ecl/containers/push_and_pop.hpp"
@@ -22,6 +23,7 @@ using ecl::Array;
 using ecl::StandardException;
 using ecl::ContainerConcept;
 using ecl::PushAndPop;
+using ecl::SpscPushAndPop;
 
 /*****************************************************************************
  ** Tests
@@ -142,6 +144,69 @@ TEST(PushAndPopTests, pop_front_only )
 //	}
 }
 
+TEST(PushAndPopTests, spsc_push_and_pop )
+{
+  SpscPushAndPop<int, 3> pp;
+  EXPECT_EQ(4U, (SpscPushAndPop<int, 3>::storage_size));
+  EXPECT_EQ(3U, pp.asize());
+  EXPECT_TRUE(pp.empty());
+  int value = -1;
+  EXPECT_FALSE(pp.pop_front(value));
+  EXPECT_EQ(-1, value);
+  EXPECT_TRUE(pp.push_back(0));
+  EXPECT_TRUE(pp.push_back(1));
+  EXPECT_TRUE(pp.push_back(2));
+  EXPECT_TRUE(pp.full());
+  EXPECT_FALSE(pp.push_back(3)); // no room, unlike PushAndPop it doesn't drop the front
+  EXPECT_EQ(3U, pp.size());
+  ASSERT_TRUE(pp.front() != NULL);
+  EXPECT_EQ(0, *pp.front());
+  for (int i = 0; i < 3; ++i)
+  {
+    EXPECT_TRUE(pp.pop_front(value));
+    EXPECT_EQ(i, value);
+  }
+  EXPECT_TRUE(pp.empty());
+  EXPECT_TRUE(pp.front() == NULL);
+  // wrap around the masked storage a few times
+  for (int i = 0; i < 20; ++i)
+  {
+    EXPECT_TRUE(pp.push_back(i));
+    EXPECT_TRUE(pp.pop_front(value));
+    EXPECT_EQ(i, value);
+  }
+}
+
+TEST(PushAndPopTests, spsc_threaded )
+{
+  const unsigned int count = 100000;
+  SpscPushAndPop<unsigned int, 64> pp;
+  std::thread producer([&pp, count]() {
+    for (unsigned int i = 0; i < count; ++i)
+    {
+      while (!pp.push_back(i)) { std::this_thread::yield(); }
+    }
+  });
+  unsigned int expected = 0;
+  bool in_order = true;
+  while (expected < count)
+  {
+    unsigned int value;
+    if (pp.pop_front(value))
+    {
+      in_order = in_order && (value == expected);
+      ++expected;
+    }
+    else
+    {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  EXPECT_TRUE(in_order);
+  EXPECT_TRUE(pp.empty());
+}
+
 TEST(PushAndPopTests,concepts)
 {
   typedef PushAndPop<unsigned char> UnsignedByteBuffer;
@@ -0,0 +1,93 @@
+/**
+ * @file /src/benchmarks/clocks.cpp
+ *
+ * @brief Call overhead of ecl's clocks.
+ *
+ * Times a million back to back calls of each clock, from the raw system
+ * call through the TimeStamp based watches to the cycle counter.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <ecl/time_lite/functions.hpp>
+#include <ecl/time/cpuwatch.hpp>
+#include <ecl/time/cycle_clock.hpp>
+#include <ecl/time/fast_stopwatch.hpp>
+#include <ecl/time/stopwatch.hpp>
+#include <ecl/time/timestamp.hpp>
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::CycleClock;
+using ecl::FastStopWatch;
+using ecl::StopWatch;
+using ecl::TimeStamp;
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+const unsigned int number_of_calls = 1000000;
+volatile long sink = 0; // stop the calls being optimised away
+
+long now_ns() {
+  timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec*1000000000L + time.tv_nsec;
+}
+
+template <typename Call>
+void run(const std::string &name, Call call) {
+  long start = now_ns();
+  for ( unsigned int i = 0; i < number_of_calls; ++i ) {
+    call();
+  }
+  double per_call = static_cast<double>(now_ns() - start)/number_of_calls;
+  std::cout << std::setw(28) << name << std::setw(10) << std::fixed << std::setprecision(1) << per_call << std::endl;
+}
+
+/*****************************************************************************
+** Main
+*****************************************************************************/
+
+int main() {
+
+  std::cout << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << "                 Clock Call Overhead [ns]" << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << std::endl;
+
+  CycleClock::calibrate();
+  std::cout << "Cycle clock frequency [MHz]: " << CycleClock::frequency()/1.0e6 << std::endl;
+  std::cout << std::endl;
+
+  run("clock_gettime", []() { sink = now_ns(); });
+  run("ecl::epoch_time", []() { ecl::TimeStructure time; ecl::epoch_time(time); sink = time.tv_nsec; });
+  run("TimeStamp()", []() { TimeStamp time; sink = time.nsec(); });
+  TimeStamp stamp;
+  run("TimeStamp::stamp()", [&stamp]() { stamp.stamp(); sink = stamp.nsec(); });
+  StopWatch stopwatch;
+  run("StopWatch::split()", [&stopwatch]() { sink = stopwatch.split().nsec(); });
+#if defined(ECL_HAS_CPUWATCH)
+  ecl::CpuWatch cpuwatch;
+  run("CpuWatch::split()", [&cpuwatch]() { sink = cpuwatch.split().nsec(); });
+#endif
+  run("CycleClock::ticks()", []() { sink = CycleClock::ticks(); });
+  FastStopWatch fast_stopwatch;
+  run("FastStopWatch::splitTicks()", [&fast_stopwatch]() { sink = fast_stopwatch.splitTicks(); });
+  run("FastStopWatch::split()", [&fast_stopwatch]() { sink = fast_stopwatch.split().nsec(); });
+  uint64_t ticks = CycleClock::ticks();
+  run("CycleClock::timestamp()", [ticks]() { sink = CycleClock::timestamp(ticks).nsec(); });
+  std::cout << std::endl;
+  return 0;
+}
@@ -11,10 +11,15 @@
 *****************************************************************************/
 
 #include <algorithm>
+#include <sched.h>
 #include <iostream>
+#include <utility>
 #include <vector>
 #include <ecl/containers/array.hpp>
+#include <ecl/containers/push_and_pop.hpp>
+#include <ecl/threads/mutex.hpp>
 #include <ecl/threads/priority.hpp>
+#include <ecl/threads/thread.hpp>
 #include <ecl/time/stopwatch.hpp>
 #include <ecl/time/timestamp.hpp>
 
@@ -25,11 +30,79 @@
 using std::string;
 using std::vector;
 using ecl::Array;
+using ecl::Mutex;
+using ecl::PushAndPop;
+using ecl::SpscPushAndPop;
+using ecl::Thread;
 using ecl::RealTimePriority4;
 using ecl::StandardException;
 using ecl::StopWatch;
 using ecl::TimeStamp;
 
+/*****************************************************************************
+** Producers
+*****************************************************************************/
+
+const unsigned int transfers = 1000000;
+const unsigned int repetitions = 10000;
+const unsigned int samples = 1000; // e.g. a trajectory's worth of points
+
+/**
+ * Mutex guarded PushAndPop, the way a serial reader thread handing samples to
+ * a control thread had to be written before SpscPushAndPop.
+ */
+class MutexGuardedBuffer {
+public:
+  void producer() {
+    for ( unsigned int i = 0; i < transfers; ) {
+      mutex.lock();
+      bool pushed = false;
+      if ( buffer.size() < 63 ) {
+        buffer.push_back(i);
+        pushed = true;
+        ++i;
+      }
+      mutex.unlock();
+      if ( !pushed ) { sched_yield(); }
+    }
+  }
+  unsigned int consume() {
+    unsigned int sum = 0;
+    for ( unsigned int i = 0; i < transfers; ) {
+      mutex.lock();
+      bool popped = false;
+      if ( buffer.size() > 0 ) {
+        sum += buffer.pop_front();
+        popped = true;
+        ++i;
+      }
+      mutex.unlock();
+      if ( !popped ) { sched_yield(); }
+    }
+    return sum;
+  }
+  Mutex mutex;
+  PushAndPop<unsigned int, 63> buffer;
+};
+
+class LockFreeBuffer {
+public:
+  void producer() {
+    for ( unsigned int i = 0; i < transfers; ) {
+      if ( buffer.push_back(i) ) { ++i; } else { sched_yield(); }
+    }
+  }
+  unsigned int consume() {
+    unsigned int sum = 0;
+    unsigned int value;
+    for ( unsigned int i = 0; i < transfers; ) {
+      if ( buffer.pop_front(value) ) { sum += value; ++i; } else { sched_yield(); }
+    }
+    return sum;
+  }
+  SpscPushAndPop<unsigned int, 63> buffer;
+};
+
 /*****************************************************************************
 ** Main
 *****************************************************************************/
@@ -149,6 +222,77 @@ int main()
     std::cout << "Array  [manual]   : " << timestamp[0] << std::endl;
     std::cout << "Vector [manual]   : " << timestamp[2] << std::endl;
 
+    std::cout << std::endl;
+    std::cout << "***********************************************************" << std::endl;
+    std::cout << "         Dynamic Arrays (" << repetitions << " x " << samples << " doubles)" << std::endl;
+    std::cout << "***********************************************************" << std::endl;
+    std::cout << std::endl;
+
+    Array<double> source = Array<double>::Constant(samples, 1.0);
+    Array<double> sink;
+    stopwatch.restart();
+    for ( unsigned int i = 0; i < repetitions; ++i ) {
+        Array<double> copied(source);
+        source.swap(copied);
+    }
+    timestamp[0] = stopwatch.split();
+
+    for ( unsigned int i = 0; i < repetitions; ++i ) {
+        Array<double> moved(std::move(source));
+        source = std::move(moved);
+    }
+    timestamp[1] = stopwatch.split();
+
+    for ( unsigned int i = 0; i < repetitions; ++i ) {
+        sink = Array<double>::Constant(samples, 1.0);
+    }
+    timestamp[2] = stopwatch.split();
+
+    for ( unsigned int i = 0; i < repetitions; ++i ) {
+        sink.clear(); // what every resize used to do
+        sink.resize(( i % 2 == 0 ) ? samples/2 : samples);
+    }
+    timestamp[3] = stopwatch.split();
+
+    for ( unsigned int i = 0; i < repetitions; ++i ) {
+        sink.resize(( i % 2 == 0 ) ? samples/2 : samples);
+    }
+    timestamp[4] = stopwatch.split();
+
+    std::cout << "Hand over [copy]        : " << timestamp[0] << std::endl;
+    std::cout << "Hand over [move]        : " << timestamp[1] << std::endl;
+    std::cout << "Blueprint assignment    : " << timestamp[2] << std::endl;
+    std::cout << "Resize [reallocate]     : " << timestamp[3] << std::endl;
+    std::cout << "Resize [reuse capacity] : " << timestamp[4] << std::endl;
+
+    std::cout << std::endl;
+    std::cout << "***********************************************************" << std::endl;
+    std::cout << "              Producer-Consumer (" << transfers << " transfers)" << std::endl;
+    std::cout << "***********************************************************" << std::endl;
+    std::cout << std::endl;
+
+    unsigned int checksum[2];
+    MutexGuardedBuffer mutex_guarded_buffer;
+    stopwatch.restart();
+    Thread mutex_producer(&MutexGuardedBuffer::producer, mutex_guarded_buffer);
+    checksum[0] = mutex_guarded_buffer.consume();
+    mutex_producer.join();
+    timestamp[0] = stopwatch.split();
+
+    LockFreeBuffer lock_free_buffer;
+    stopwatch.restart();
+    Thread lock_free_producer(&LockFreeBuffer::producer, lock_free_buffer);
+    checksum[1] = lock_free_buffer.consume();
+    lock_free_producer.join();
+    timestamp[1] = stopwatch.split();
+
+    std::cout << "PushAndPop + Mutex : " << timestamp[0] << std::endl;
+    std::cout << "SpscPushAndPop     : " << timestamp[1] << std::endl;
+    if ( checksum[0] != checksum[1] ) {
+      std::cout << "Checksums differ!" << std::endl;
+    }
+    std::cout << std::endl;
+
 return 0;
 }
 
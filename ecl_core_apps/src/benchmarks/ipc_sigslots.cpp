@@ -0,0 +1,153 @@
+/**
+ * @file /src/benchmarks/ipc_sigslots.cpp
+ *
+ * @brief Round trip latency of sigslots between two processes.
+ *
+ * A forked child's IpcSlot echoes every ping back on another topic with
+ * an IpcSignal. Each leg is an emit into a message channel, a futex wakeup
+ * and a run of the slot's function in its thread, so a one way trip is
+ * roughly half the round trip.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include <sched.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <ecl/exceptions/standard_exception.hpp>
+#include <ecl/sigslots/ipc_signal.hpp>
+#include <ecl/sigslots/ipc_slot.hpp>
+
+#ifdef ECL_HAS_TOPIC_REGISTRY
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::IpcSignal;
+using ecl::IpcSlot;
+using ecl::StandardException;
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+const unsigned int number_of_round_trips = 20000;
+
+long now_ns() {
+  timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec*1000000000L + time.tv_nsec;
+}
+
+/**
+ * A small control message, a cache line.
+ */
+struct Ping {
+  long sequence;
+  char padding[56];
+};
+
+class Echo {
+public:
+  Echo() : pongs("ecl_bench_pong"), count(0) {}
+  void ping(const Ping &ping) {
+    while ( pongs.emit(ping) == 0 ) { // until the parent's slot shows up
+      sched_yield();
+    }
+    count.fetch_add(1);
+  }
+  IpcSignal<const Ping&> pongs;
+  std::atomic<unsigned int> count;
+};
+
+std::atomic<long> last_pong(-1);
+
+void pong(const Ping &ping) {
+  last_pong.store(ping.sequence);
+}
+
+void echo() {
+  try {
+    Echo echo;
+    IpcSlot<const Ping&> pings(&Echo::ping, echo, "ecl_bench_ping");
+    while ( echo.count.load() < number_of_round_trips ) {
+      usleep(10000);
+    }
+  } catch ( const StandardException &e ) {
+    std::cout << e.what() << std::endl;
+    _exit(1);
+  }
+  _exit(0);
+}
+
+void run() {
+  pid_t child = fork();
+  if ( child == 0 ) {
+    echo();
+  }
+  IpcSlot<const Ping&> pongs(pong, "ecl_bench_pong");
+  IpcSignal<const Ping&> pings("ecl_bench_ping");
+  std::vector<long> latencies(number_of_round_trips);
+  Ping ping = { 0, { 0 } };
+  for ( unsigned int i = 0; i < number_of_round_trips; ++i ) {
+    ping.sequence = i;
+    long start = now_ns();
+    while ( pings.emit(ping) == 0 ) { // until the child's slot shows up
+      sched_yield();
+    }
+    while ( last_pong.load() != ping.sequence ) {
+      sched_yield(); // let it run if we're sharing a core
+    }
+    latencies[i] = now_ns() - start;
+  }
+  waitpid(child, NULL, 0);
+  latencies.erase(latencies.begin()); // includes the discovery
+  std::sort(latencies.begin(), latencies.end());
+  std::cout << std::setw(10) << "Ping/Pong";
+  std::cout << std::setw(10) << latencies[latencies.size()/2];
+  std::cout << std::setw(10) << latencies[latencies.size()*99/100];
+  std::cout << std::setw(10) << latencies.back() << std::endl;
+}
+
+/*****************************************************************************
+** Main
+*****************************************************************************/
+
+int main() {
+
+  std::cout << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << "         Sigslots Round Trip Latency [ns]" << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << std::endl;
+
+  try {
+    std::cout << std::setw(10) << "" << std::setw(10) << "Median" << std::setw(10) << "99%" << std::setw(10) << "Max" << std::endl;
+    run();
+  } catch ( const StandardException &e ) {
+    std::cout << "Shared memory is not available." << std::endl;
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+  std::cout << std::endl;
+  return 0;
+}
+
+#else
+
+int main() {
+  std::cout << "Sigslots between processes are not supported on this platform." << std::endl;
+  return 0;
+}
+
+#endif /* ECL_HAS_TOPIC_REGISTRY */
@@ -0,0 +1,168 @@
+/**
+ * @file /src/benchmarks/jitter.cpp
+ *
+ * @brief Wakeup latency of a 1kHz loop, default vs real time configuration.
+ *
+ * Runs a cyclictest style loop (absolute sleeps on the monotonic clock)
+ * twice - once with the default scheduling and once with fifo scheduling,
+ * cpu pinning, a prefaulted stack and locked process memory - and prints
+ * a histogram of how late each wakeup was. Finally it compares ecl's
+ * PeriodicScheduler with and without spinning out the last 50us.
+ *
+ * Real time scheduling and memory locking usually need root (or the
+ * appropriate rlimits), otherwise the second run reports the failure.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <ecl/exceptions/standard_exception.hpp>
+#include <ecl/threads/priority.hpp>
+#include <ecl/threads/thread.hpp>
+#include <ecl/time/periodic_scheduler.hpp>
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::StandardException;
+using ecl::Thread;
+
+/*****************************************************************************
+** Loop
+*****************************************************************************/
+
+const unsigned int number_of_cycles = 5000;
+const long period_ns = 1000000L; // 1kHz
+const unsigned int number_of_buckets = 8;
+const long bucket_limits_us[number_of_buckets] = { 10, 20, 50, 100, 200, 500, 1000, -1 };
+
+class JitterLoop {
+public:
+  JitterLoop() : max_latency_us(0), total_latency_us(0) {
+    for ( unsigned int i = 0; i < number_of_buckets; ++i ) { buckets[i] = 0; }
+  }
+
+  void run() {
+    timespec expected, actual;
+    clock_gettime(CLOCK_MONOTONIC, &expected);
+    for ( unsigned int i = 0; i < number_of_cycles; ++i ) {
+      expected.tv_nsec += period_ns;
+      if ( expected.tv_nsec >= 1000000000L ) {
+        expected.tv_nsec -= 1000000000L;
+        ++expected.tv_sec;
+      }
+      clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &expected, NULL);
+      clock_gettime(CLOCK_MONOTONIC, &actual);
+      long latency_us = ( (actual.tv_sec - expected.tv_sec)*1000000000L + (actual.tv_nsec - expected.tv_nsec) )/1000;
+      record(latency_us);
+    }
+  }
+
+  void print(const std::string &title) const {
+    std::cout << title << std::endl;
+    std::cout << "  Average [us] : " << total_latency_us/number_of_cycles << std::endl;
+    std::cout << "  Maximum [us] : " << max_latency_us << std::endl;
+    for ( unsigned int i = 0; i < number_of_buckets; ++i ) {
+      if ( bucket_limits_us[i] < 0 ) {
+        std::cout << "      > " << std::setw(4) << bucket_limits_us[i-1];
+      } else {
+        std::cout << "     <= " << std::setw(4) << bucket_limits_us[i];
+      }
+      std::cout << " : " << buckets[i] << std::endl;
+    }
+    std::cout << std::endl;
+  }
+
+private:
+  void record(const long &latency_us) {
+    total_latency_us += latency_us;
+    if ( latency_us > max_latency_us ) { max_latency_us = latency_us; }
+    for ( unsigned int i = 0; i < number_of_buckets; ++i ) {
+      if ( ( bucket_limits_us[i] < 0 ) || ( latency_us <= bucket_limits_us[i] ) ) {
+        ++buckets[i];
+        break;
+      }
+    }
+  }
+
+  unsigned int buckets[number_of_buckets];
+  long max_latency_us;
+  long total_latency_us;
+};
+
+/*****************************************************************************
+** Scheduler
+*****************************************************************************/
+
+#ifdef ECL_HAS_PERIODIC_SCHEDULER
+void run_scheduler(const std::string &title, const long &spin_ns) {
+  ecl::PeriodicScheduler scheduler(ecl::Duration(0, period_ns), ecl::SkipMissedCycles, ecl::Duration(0, spin_ns));
+  scheduler.initialise();
+  for ( unsigned int i = 0; i < number_of_cycles; ++i ) {
+    scheduler();
+  }
+  const ecl::LatencyHistogram &latencies = scheduler.wakeupLatencies();
+  std::cout << title << std::endl;
+  std::cout << "  Median [us]  : " << latencies.percentile(50.0)/1000 << std::endl;
+  std::cout << "  99%    [us]  : " << latencies.percentile(99.0)/1000 << std::endl;
+  std::cout << "  99.9%  [us]  : " << latencies.percentile(99.9)/1000 << std::endl;
+  std::cout << "  Maximum [us] : " << latencies.maximum()/1000 << std::endl;
+  std::cout << "  Overruns     : " << scheduler.overruns() << std::endl;
+  std::cout << std::endl;
+}
+#endif
+
+/*****************************************************************************
+** Main
+*****************************************************************************/
+
+int main() {
+
+  std::cout << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << "          Wakeup Latency (1kHz, " << number_of_cycles << " cycles)" << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << std::endl;
+
+  /*********************
+  ** Defaults
+  **********************/
+  JitterLoop default_loop;
+  Thread default_thread(&JitterLoop::run, default_loop);
+  default_thread.join();
+  default_loop.print("Default Scheduling");
+
+  /*********************
+  ** Real Time
+  **********************/
+  try {
+    ecl::set_process_realtime(8*1024*1024, 64*1024);
+    unsigned long cpus = ecl::get_cpu_affinity();
+    unsigned long last_cpu = 0;
+    for ( unsigned int cpu = 0; cpu < 8*sizeof(unsigned long); ++cpu ) {
+      if ( cpus & (1UL << cpu) ) { last_cpu = (1UL << cpu); }
+    }
+    JitterLoop realtime_loop;
+    Thread realtime_thread(&JitterLoop::run, realtime_loop, ecl::RealTimePriority4, -1, last_cpu, ecl::FifoScheduling, 64*1024);
+    realtime_thread.join();
+    realtime_loop.print("Fifo Scheduling + Pinned + Locked Memory");
+  } catch ( const StandardException &e ) {
+    std::cout << "Real time configuration failed (need root?)." << std::endl;
+    std::cout << e.what() << std::endl;
+  }
+
+  /*********************
+  ** Periodic Scheduler
+  **********************/
+#ifdef ECL_HAS_PERIODIC_SCHEDULER
+  run_scheduler("PeriodicScheduler", 0);
+  run_scheduler("PeriodicScheduler (spin 50us)", 50000);
+#endif
+  return 0;
+}
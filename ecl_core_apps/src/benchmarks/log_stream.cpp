@@ -0,0 +1,108 @@
+/**
+ * @file /src/benchmarks/log_stream.cpp
+ *
+ * @brief Latency of LOG + FLUSH with synchronous and asynchronous writes.
+ *
+ * Each record is logged and flushed as a control loop would, timing every
+ * call. Synchronous streams write to the file on the calling thread,
+ * asynchronous streams only copy into their ring. Binary records (LOG_BINARY)
+ * additionally skip the formatting.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <ecl/streams/log_stream.hpp>
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::LogStream;
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+enum LogModes {
+  Info
+};
+
+const unsigned int number_of_records = 20000;
+
+long now_ns() {
+  timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec*1000000000L + time.tv_nsec;
+}
+
+/**
+ * Log and flush every record, returning the sorted call latencies [ns].
+ */
+std::vector<long> run(const std::string &file_name, const bool &asynchronous, const bool &binary, unsigned long &dropped) {
+  std::vector<long> latencies(number_of_records);
+  {
+    LogStream log_stream(file_name, ecl::New);
+    log_stream.enableMode(Info, "INFO");
+    if ( asynchronous ) {
+      log_stream.enableAsynchronousWrites(1024*1024, ecl::DropOnOverflow);
+    }
+    for ( unsigned int i = 0; i < number_of_records; ++i ) {
+      long start = now_ns();
+      if ( binary ) {
+        LOG_BINARY(log_stream, Info, "Control loop iteration {}, error {}\n", i, 0.001*i);
+      } else {
+        LOG(log_stream, Info) << "Control loop iteration " << i << ", error " << 0.001*i << "\n";
+      }
+      FLUSH(log_stream);
+      latencies[i] = now_ns() - start;
+    }
+    dropped = log_stream.device().dropped();
+  }
+  std::remove(file_name.c_str());
+  std::sort(latencies.begin(), latencies.end());
+  return latencies;
+}
+
+void print(const std::string &title, const std::vector<long> &latencies, const unsigned long &dropped) {
+  std::cout << std::setw(14) << title;
+  std::cout << std::setw(10) << latencies[latencies.size()/2];
+  std::cout << std::setw(10) << latencies[latencies.size()*99/100];
+  std::cout << std::setw(10) << latencies[latencies.size()*999/1000];
+  std::cout << std::setw(10) << latencies.back();
+  std::cout << std::setw(10) << dropped << std::endl;
+}
+
+/*****************************************************************************
+** Main
+*****************************************************************************/
+
+int main() {
+
+  std::cout << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << "            LOG + FLUSH Latency [ns]" << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << std::endl;
+
+  unsigned long dropped = 0;
+  std::cout << std::setw(14) << "Mode" << std::setw(10) << "Median" << std::setw(10) << "99%";
+  std::cout << std::setw(10) << "99.9%" << std::setw(10) << "Max" << std::setw(10) << "Dropped" << std::endl;
+  std::vector<long> latencies = run("ecl_bench_sync.log", false, false, dropped);
+  print("Synchronous", latencies, 0);
+  latencies = run("ecl_bench_async.log", true, false, dropped);
+  print("Asynchronous", latencies, dropped);
+  latencies = run("ecl_bench_binary.log", true, true, dropped);
+  print("Binary", latencies, dropped);
+  std::cout << std::endl;
+  return 0;
+}
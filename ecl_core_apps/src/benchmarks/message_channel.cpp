@@ -0,0 +1,133 @@
+/**
+ * @file /src/benchmarks/message_channel.cpp
+ *
+ * @brief Round trip latency between two processes over message channels.
+ *
+ * A forked child echoes every message back. The consumers either sleep on
+ * the channel's futex (wait()) or spin on empty(). Spinning only makes
+ * sense with a core to spare for each process.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <algorithm>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include <sched.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <ecl/exceptions/standard_exception.hpp>
+#include <ecl/ipc/message_channel.hpp>
+
+#ifdef ECL_HAS_MESSAGE_CHANNEL
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::MessageChannel;
+using ecl::StandardException;
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+const unsigned int number_of_round_trips = 20000;
+const unsigned int message_size = 64;
+
+long now_ns() {
+  timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec*1000000000L + time.tv_nsec;
+}
+
+void receive(MessageChannel &channel, char *message, const bool &spin) {
+  for (;;) {
+    if ( channel.read(message, message_size) > 0 ) {
+      return;
+    }
+    if ( spin ) {
+      sched_yield(); // let it run if we're sharing a core
+    } else {
+      channel.wait();
+    }
+  }
+}
+
+void echo(const bool &spin) {
+  try {
+    MessageChannel requests("ecl_bench_requests");
+    MessageChannel replies("ecl_bench_replies");
+    char message[message_size];
+    for ( unsigned int i = 0; i < number_of_round_trips; ++i ) {
+      receive(requests, message, spin);
+      replies.write(message, message_size);
+    }
+  } catch ( const StandardException &e ) {
+    std::cout << e.what() << std::endl;
+    _exit(1);
+  }
+  _exit(0);
+}
+
+void run(const bool &spin) {
+  MessageChannel requests("ecl_bench_requests");
+  MessageChannel replies("ecl_bench_replies");
+  pid_t child = fork();
+  if ( child == 0 ) {
+    echo(spin);
+  }
+  std::vector<long> latencies(number_of_round_trips);
+  char message[message_size] = { 0 };
+  for ( unsigned int i = 0; i < number_of_round_trips; ++i ) {
+    long start = now_ns();
+    requests.write(message, message_size);
+    receive(replies, message, spin);
+    latencies[i] = now_ns() - start;
+  }
+  waitpid(child, NULL, 0);
+  std::sort(latencies.begin(), latencies.end());
+  std::cout << std::setw(10) << ( spin ? "Spin" : "Futex" );
+  std::cout << std::setw(10) << latencies[latencies.size()/2];
+  std::cout << std::setw(10) << latencies[latencies.size()*99/100];
+  std::cout << std::setw(10) << latencies.back() << std::endl;
+}
+
+/*****************************************************************************
+** Main
+*****************************************************************************/
+
+int main() {
+
+  std::cout << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << "         Message Channel Round Trip Latency [ns]" << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << std::endl;
+
+  try {
+    std::cout << std::setw(10) << "Consumer" << std::setw(10) << "Median" << std::setw(10) << "99%" << std::setw(10) << "Max" << std::endl;
+    run(false);
+    run(true);
+  } catch ( const StandardException &e ) {
+    std::cout << "Shared memory is not available." << std::endl;
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+  std::cout << std::endl;
+  return 0;
+}
+
+#else
+
+int main() {
+  std::cout << "Message channels are not supported on this platform." << std::endl;
+  return 0;
+}
+
+#endif /* ECL_HAS_MESSAGE_CHANNEL */
@@ -0,0 +1,140 @@
+/**
+ * @file /src/benchmarks/polynomials.cpp
+ *
+ * @brief Cost of evaluating cubic and quintic polynomials over many points.
+ *
+ * Compares the point at a time evaluation (the old power accumulating loop
+ * and derivative polynomials rebuilt on every call, then Horner's method)
+ * with the simd batch evaluation.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <ecl/geometry/polynomial.hpp>
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::CubicPolynomial;
+using ecl::Polynomial;
+using ecl::QuinticPolynomial;
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+/*
+ * 10^6 points, rasterised in batches small enough to stay in cache (with
+ * the whole lot at once this would only measure memory bandwidth).
+ */
+const unsigned int batch_size = 4000;
+const unsigned int number_of_batches = 250;
+const unsigned int number_of_points = batch_size*number_of_batches;
+volatile double sink = 0.0; // stop the evaluations being optimised away
+
+long now_ns() {
+  timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec*1000000000L + time.tv_nsec;
+}
+
+void print(const std::string &name, const long &elapsed_ns) {
+  std::cout << std::setw(36) << name << std::setw(10) << std::fixed << std::setprecision(2);
+  std::cout << static_cast<double>(elapsed_ns)/number_of_points << std::endl;
+}
+
+/**
+ * What operator() used to do.
+ */
+template <unsigned int N>
+double power_accumulate(const Polynomial<N> &polynomial, const double &x) {
+  double tmp = x;
+  double value = polynomial.coefficients()[0];
+  for ( unsigned int i = 1; i <= N; ++i ) {
+    value += polynomial.coefficients()[i]*tmp;
+    tmp *= x;
+  }
+  return value;
+}
+
+template <unsigned int N>
+void run(const std::string &name, const Polynomial<N> &polynomial, const std::vector<double> &x) {
+  std::vector<double> values(x.size()), first(x.size()), second(x.size());
+  std::cout << name << std::endl;
+
+  long start = now_ns();
+  for ( unsigned int batch = 0; batch < number_of_batches; ++batch ) {
+    for ( unsigned int i = 0; i < x.size(); ++i ) {
+      values[i] = power_accumulate(polynomial, x[i]);
+      first[i] = power_accumulate(polynomial.derivative(), x[i]);
+      second[i] = power_accumulate(polynomial.derivative().derivative(), x[i]);
+    }
+  }
+  print("Rebuilt derivatives, all three", now_ns() - start);
+  sink = values.back() + first.back() + second.back();
+
+  start = now_ns();
+  for ( unsigned int batch = 0; batch < number_of_batches; ++batch ) {
+    for ( unsigned int i = 0; i < x.size(); ++i ) {
+      values[i] = polynomial(x[i]);
+    }
+  }
+  print("operator(), value", now_ns() - start);
+  sink = values.back();
+  start = now_ns();
+  for ( unsigned int batch = 0; batch < number_of_batches; ++batch ) {
+    for ( unsigned int i = 0; i < x.size(); ++i ) {
+      values[i] = polynomial(x[i]);
+      first[i] = polynomial.derivative(x[i]);
+      second[i] = polynomial.dderivative(x[i]);
+    }
+  }
+  print("Point at a time, all three", now_ns() - start);
+  sink = values.back() + first.back() + second.back();
+
+  start = now_ns();
+  for ( unsigned int batch = 0; batch < number_of_batches; ++batch ) {
+    polynomial.evaluate(&x[0], x.size(), &values[0]);
+  }
+  print("evaluate(), value", now_ns() - start);
+  sink = values.back();
+  start = now_ns();
+  for ( unsigned int batch = 0; batch < number_of_batches; ++batch ) {
+    polynomial.evaluate(&x[0], x.size(), &values[0], &first[0], &second[0]);
+  }
+  print("evaluate(), all three", now_ns() - start);
+  sink = values.back() + first.back() + second.back();
+  std::cout << std::endl;
+}
+
+/*****************************************************************************
+** Main
+*****************************************************************************/
+
+int main() {
+
+  std::cout << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << "       Polynomial Evaluation, 10^6 Points [ns/point]" << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << std::endl;
+
+  std::vector<double> x(batch_size);
+  for ( unsigned int i = 0; i < batch_size; ++i ) {
+    x[i] = 10.0*i/batch_size;
+  }
+  CubicPolynomial cubic = CubicPolynomial::SecondDerivativeInterpolation(0.0, 0.0, 0.0, 10.0, 1.0, 0.0);
+  QuinticPolynomial quintic = QuinticPolynomial::Interpolation(0.0, 0.0, 0.0, 0.0, 10.0, 1.0, 0.0, 0.0);
+  run("Cubic", cubic, x);
+  run("Quintic", quintic, x);
+  return 0;
+}
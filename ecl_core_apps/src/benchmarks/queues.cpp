@@ -0,0 +1,139 @@
+/**
+ * @file /src/benchmarks/queues.cpp
+ *
+ * @brief Scaling benchmark for the multi-producer queues.
+ *
+ * Compares ecl::MpmcQueue against a mutex guarded std::deque as the
+ * number of producers publishing into a single consumer grows.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <vector>
+#include <sched.h>
+#include <ecl/threads/mpmc_queue.hpp>
+#include <ecl/threads/mutex.hpp>
+#include <ecl/threads/thread.hpp>
+#include <ecl/time/stopwatch.hpp>
+#include <ecl/time/timestamp.hpp>
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::MpmcQueue;
+using ecl::Mutex;
+using ecl::StopWatch;
+using ecl::Thread;
+using ecl::TimeStamp;
+
+/*****************************************************************************
+** Classes
+*****************************************************************************/
+
+const unsigned int items_per_producer = 200000;
+const unsigned int max_queue_length = 1024;
+
+class LockedDeque {
+public:
+  bool push(const unsigned int &value) {
+    mutex.lock();
+    bool result = ( queue.size() < max_queue_length );
+    if ( result ) {
+      queue.push_back(value);
+    }
+    mutex.unlock();
+    return result;
+  }
+  bool pop(unsigned int &value) {
+    mutex.lock();
+    bool result = !queue.empty();
+    if ( result ) {
+      value = queue.front();
+      queue.pop_front();
+    }
+    mutex.unlock();
+    return result;
+  }
+private:
+  Mutex mutex;
+  std::deque<unsigned int> queue;
+};
+
+class LockFreeQueue {
+public:
+  bool push(const unsigned int &value) { return queue.trypush(value); }
+  bool pop(unsigned int &value) { return queue.trypop(value); }
+private:
+  MpmcQueue<unsigned int, max_queue_length> queue;
+};
+
+template <typename Queue>
+class Producer {
+public:
+  Producer() : queue(NULL) {}
+  void run() {
+    for ( unsigned int i = 0; i < items_per_producer; ) {
+      if ( queue->push(i) ) { ++i; } else { sched_yield(); }
+    }
+  }
+  Queue *queue;
+};
+
+/**
+ * Spins up the producers and consumes everything in this thread.
+ */
+template <typename Queue>
+TimeStamp run(const unsigned int &number_of_producers) {
+  Queue queue;
+  std::vector< Producer<Queue> > producers(number_of_producers);
+  std::vector<Thread*> threads;
+  StopWatch stopwatch;
+  for ( unsigned int i = 0; i < number_of_producers; ++i ) {
+    producers[i].queue = &queue;
+    threads.push_back(new Thread(&Producer<Queue>::run, producers[i]));
+  }
+  unsigned int value;
+  for ( unsigned int count = 0; count < number_of_producers*items_per_producer; ) {
+    if ( queue.pop(value) ) { ++count; } else { sched_yield(); }
+  }
+  TimeStamp elapsed = stopwatch.split();
+  for ( unsigned int i = 0; i < threads.size(); ++i ) {
+    threads[i]->join();
+    delete threads[i];
+  }
+  return elapsed;
+}
+
+/*****************************************************************************
+** Main
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+
+  unsigned int max_producers = 8;
+  if ( argc > 1 ) {
+    max_producers = atoi(argv[1]);
+  }
+
+  std::cout << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << "         N Producers -> 1 Consumer (" << items_per_producer << " items each)" << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << std::endl;
+  std::cout << "Producers    deque + Mutex [s]    MpmcQueue [s]" << std::endl;
+
+  for ( unsigned int n = 1; n <= max_producers; n *= 2 ) {
+    TimeStamp locked = run<LockedDeque>(n);
+    TimeStamp lock_free = run<LockFreeQueue>(n);
+    std::cout << "  " << n << "          " << locked << "          " << lock_free << std::endl;
+  }
+  std::cout << std::endl;
+  return 0;
+}
@@ -0,0 +1,160 @@
+/**
+ * @file /src/benchmarks/serial.cpp
+ *
+ * @brief Serial read latency and cpu load, poll() vs a snooze loop.
+ *
+ * Runs on a pseudo terminal pair, so no hardware is required. A writer
+ * thread sends a small packet every 2ms while the reader waits with a
+ * 50ms timeout, either in Serial::read() (poll) or in the read/snooze loop
+ * the serial device used for short timeouts before.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <atomic>
+#include <cstdlib>
+#include <ctime>
+#include <fcntl.h>
+#include <iostream>
+#include <string>
+#include <termios.h>
+#include <unistd.h>
+#include <ecl/devices/serial.hpp>
+#include <ecl/threads/thread.hpp>
+#include <ecl/time/duration.hpp>
+#include <ecl/time/snooze.hpp>
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::Duration;
+using ecl::Serial;
+using ecl::Snooze;
+using ecl::Thread;
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+const unsigned int number_of_packets = 500;
+const unsigned int packet_size = 16;
+const long timeout_ms = 50;
+
+long monotonic_ns() {
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec*1000000000L + now.tv_nsec;
+}
+
+long thread_cpu_ns() {
+  timespec now;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+  return now.tv_sec*1000000000L + now.tv_nsec;
+}
+
+class Writer {
+public:
+  Writer(int fd) : fd(fd), last_write_ns(0) {}
+  void run() {
+    char packet[packet_size] = "0123456789abcde";
+    for ( unsigned int i = 0; i < number_of_packets; ++i ) {
+      usleep(2000);
+      last_write_ns.store(monotonic_ns());
+      ssize_t n = ::write(fd, packet, packet_size);
+      (void) n;
+    }
+  }
+  int fd;
+  std::atomic<long> last_write_ns;
+};
+
+struct Result {
+  Result() : total_latency_ns(0), max_latency_ns(0), reads(0), cpu_ns(0) {}
+  void record(const long &latency_ns) {
+    total_latency_ns += latency_ns;
+    if ( latency_ns > max_latency_ns ) { max_latency_ns = latency_ns; }
+    ++reads;
+  }
+  void print(const std::string &title) const {
+    std::cout << title << std::endl;
+    std::cout << "  Average latency [us] : " << total_latency_ns/(reads ? reads : 1)/1000 << std::endl;
+    std::cout << "  Maximum latency [us] : " << max_latency_ns/1000 << std::endl;
+    std::cout << "  Reader cpu time [ms] : " << cpu_ns/1000000 << std::endl;
+    std::cout << std::endl;
+  }
+  long total_latency_ns, max_latency_ns, reads, cpu_ns;
+};
+
+/**
+ * The pre-poll implementation for timeouts < 100ms, 5ms snoozes for 20-100ms.
+ */
+long snooze_read(int fd, Snooze &snooze, unsigned char *bytes, unsigned long n) {
+  long no_read = 0;
+  snooze.initialise();
+  for ( long i = 0; i < timeout_ms/5; ++i ) {
+    no_read = ::read(fd, bytes, n);
+    if ( no_read != 0 ) {
+      break;
+    }
+    snooze();
+  }
+  return no_read;
+}
+
+/*****************************************************************************
+** Main
+*****************************************************************************/
+
+int main() {
+
+  std::cout << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << "          Serial Reads (" << number_of_packets << " packets, 2ms apart)" << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << std::endl;
+
+  Result results[2];
+  for ( unsigned int mode = 0; mode < 2; ++mode ) {
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if ( ( master == -1 ) || ( grantpt(master) != 0 ) || ( unlockpt(master) != 0 ) ) {
+      std::cout << "Pseudo terminals are not available." << std::endl;
+      return 1;
+    }
+    Serial serial(ptsname(master));
+    serial.block(timeout_ms);
+    // for the snooze loop, a second non-blocking (termios) handle on the slave
+    int slave = ::open(ptsname(master), O_RDWR | O_NOCTTY);
+    termios options;
+    tcgetattr(slave, &options);
+    cfmakeraw(&options);
+    options.c_cc[VMIN] = 0;
+    options.c_cc[VTIME] = 0;
+    tcsetattr(slave, TCSANOW, &options);
+    Snooze snooze(Duration(0.005));
+
+    Writer writer(master);
+    Thread thread(&Writer::run, writer);
+    unsigned char buffer[256];
+    unsigned long received = 0;
+    long cpu_start = thread_cpu_ns();
+    while ( received < number_of_packets*packet_size ) {
+      long n = ( mode == 0 ) ? snooze_read(slave, snooze, buffer, 256) : serial.read(buffer, 256);
+      if ( n > 0 ) {
+        results[mode].record(monotonic_ns() - writer.last_write_ns.load());
+        received += n;
+      }
+    }
+    results[mode].cpu_ns = thread_cpu_ns() - cpu_start;
+    thread.join();
+    ::close(slave);
+    serial.close();
+    ::close(master);
+  }
+  results[0].print("Read/Snooze Loop (5ms)");
+  results[1].print("Serial::read (poll)");
+  return 0;
+}
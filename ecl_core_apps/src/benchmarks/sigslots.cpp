@@ -0,0 +1,267 @@
+/**
+ * @file /src/benchmarks/sigslots.cpp
+ *
+ * @brief Cost of emitting to 1, 10 and 100 slots.
+ *
+ * Compares the snapshot based emit with a replica of the previous
+ * implementation (walking the map of topics and set of slots, passing the
+ * data by value and locking in process()), for a small payload and a
+ * large sensor sized one. Also times rewiring a slot (connect and
+ * disconnect) while many other topics exist, by name and by handle, and
+ * what a slow slot costs the emitter when it is run directly and when it
+ * is queued on an executor.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <ecl/sigslots.hpp>
+#include <ecl/threads/mutex.hpp>
+#include <ecl/utilities/function_objects.hpp>
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+const unsigned int number_of_emits = 20000;
+
+long now_ns() {
+  timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec*1000000000L + time.tv_nsec;
+}
+
+/**
+ * A laser scan's worth of data.
+ */
+struct Scan {
+  float ranges[1080];
+};
+
+volatile float sink = 0.0f; // stop the slots being optimised away
+
+void scanByValue(Scan scan) { sink = scan.ranges[0]; }
+void scanByReference(const Scan &scan) { sink = scan.ranges[0]; }
+void integer(const int &i) { sink = i; }
+
+/**
+ * A visualiser or logger, 20us of work.
+ */
+void slow(const int &i) {
+  long start = now_ns();
+  while ( now_ns() - start < 20000 ) {}
+  sink = i;
+}
+
+/*****************************************************************************
+** Legacy
+*****************************************************************************/
+
+namespace legacy {
+
+/**
+ * The emit and process of the previous SigSlot, wired up by hand.
+ */
+template <typename Data>
+class SigSlot {
+public:
+  typedef std::set<SigSlot<Data>*> Subscribers;
+
+  SigSlot(void (*f)(Data)) : processing_count(0), function(new ecl::UnaryFreeFunction<Data>(f)) {}
+  ~SigSlot() { delete function; }
+
+  void emit(Data data) {
+    typename std::map<std::string, const Subscribers*>::const_iterator topic_iter;
+    typename Subscribers::const_iterator slots_iter;
+    for ( topic_iter = publications.begin(); topic_iter != publications.end(); ++topic_iter ) {
+      const Subscribers* subscribers = topic_iter->second;
+      for ( slots_iter = subscribers->begin(); slots_iter != subscribers->end(); ++slots_iter ) {
+        (*slots_iter)->process(data);
+      }
+    }
+  }
+  void process(Data data) {
+    mutex.trylock();
+    ++processing_count;
+    (*function)(data);
+    if ( --processing_count == 0 ) {
+      mutex.unlock();
+    }
+  }
+
+  std::map<std::string, const Subscribers*> publications;
+
+private:
+  ecl::Mutex mutex;
+  unsigned int processing_count;
+  ecl::UnaryFunction<Data,void> *function;
+};
+
+} // namespace legacy
+
+/*****************************************************************************
+** Benchmarks
+*****************************************************************************/
+
+template <typename Data>
+double legacyEmit(void (*f)(Data), const unsigned int &number_of_slots, const Data &data) {
+  legacy::SigSlot<Data> signal(f);
+  std::vector<legacy::SigSlot<Data>*> slots;
+  typename legacy::SigSlot<Data>::Subscribers subscribers;
+  for ( unsigned int i = 0; i < number_of_slots; ++i ) {
+    slots.push_back(new legacy::SigSlot<Data>(f));
+    subscribers.insert(slots.back());
+  }
+  signal.publications["benchmark"] = &subscribers;
+  long start = now_ns();
+  for ( unsigned int i = 0; i < number_of_emits; ++i ) {
+    signal.emit(data);
+  }
+  const double elapsed = static_cast<double>(now_ns() - start)/number_of_emits;
+  for ( unsigned int i = 0; i < slots.size(); ++i ) {
+    delete slots[i];
+  }
+  return elapsed;
+}
+
+template <typename Data>
+double snapshotEmit(void (*f)(Data), const unsigned int &number_of_slots, const Data &data) {
+  std::ostringstream topic;
+  topic << "benchmark_" << number_of_slots;
+  ecl::Signal<Data> signal(topic.str());
+  std::vector<ecl::Slot<Data>*> slots;
+  for ( unsigned int i = 0; i < number_of_slots; ++i ) {
+    slots.push_back(new ecl::Slot<Data>(f, topic.str()));
+  }
+  long start = now_ns();
+  for ( unsigned int i = 0; i < number_of_emits; ++i ) {
+    signal.emit(data);
+  }
+  const double elapsed = static_cast<double>(now_ns() - start)/number_of_emits;
+  for ( unsigned int i = 0; i < slots.size(); ++i ) {
+    delete slots[i];
+  }
+  return elapsed;
+}
+
+/**
+ * Connect and disconnect a slot, with number_of_topics other topics alive.
+ */
+double rewire(const unsigned int &number_of_topics, const bool &by_handle) {
+  const unsigned int number_of_rewires = 2000;
+  std::vector<ecl::Signal<const int&>*> signals;
+  for ( unsigned int i = 0; i < number_of_topics; ++i ) {
+    std::ostringstream topic;
+    topic << "rewire_" << number_of_topics << "_" << i;
+    signals.push_back(new ecl::Signal<const int&>(topic.str()));
+  }
+  const std::string name("rewire_target");
+  const ecl::TopicHandle handle(name);
+  ecl::Signal<const int&> signal(handle);
+  ecl::Slot<const int&> slot(integer);
+  long start = now_ns();
+  for ( unsigned int i = 0; i < number_of_rewires; ++i ) {
+    if ( by_handle ) {
+      slot.connect(handle);
+      slot.disconnect(handle);
+    } else {
+      slot.connect(name);
+      slot.disconnect(name);
+    }
+  }
+  const double elapsed = static_cast<double>(now_ns() - start)/number_of_rewires;
+  for ( unsigned int i = 0; i < signals.size(); ++i ) {
+    delete signals[i];
+  }
+  return elapsed;
+}
+
+/**
+ * Emit to a slow slot, run directly or queued.
+ */
+double slowEmit(ecl::SlotExecutor *executor, ecl::SlotQueueStatistics &statistics) {
+  const unsigned int number_of_slow_emits = 2000;
+  ecl::Signal<const int&> signal("slow");
+  ecl::Slot<const int&> *slot = ( executor == NULL ) ? new ecl::Slot<const int&>(slow) : new ecl::Slot<const int&>(slow, *executor, 16, ecl::DropOldest);
+  slot->connect("slow");
+  long start = now_ns();
+  for ( unsigned int i = 0; i < number_of_slow_emits; ++i ) {
+    signal.emit(i);
+  }
+  const double elapsed = static_cast<double>(now_ns() - start)/number_of_slow_emits;
+  statistics = slot->queueStatistics();
+  delete slot;
+  return elapsed;
+}
+
+template <typename Data>
+void print(const std::string &name, double (*benchmark)(void (*)(Data), const unsigned int&, const Data&), void (*f)(Data), const Data &data) {
+  std::cout << std::setw(36) << name << std::fixed << std::setprecision(1);
+  std::cout << std::setw(10) << benchmark(f, 1, data);
+  std::cout << std::setw(10) << benchmark(f, 10, data);
+  std::cout << std::setw(10) << benchmark(f, 100, data) << std::endl;
+}
+
+/*****************************************************************************
+** Main
+*****************************************************************************/
+
+int main() {
+
+  std::cout << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << "     Signal Emits [ns/emit]" << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << std::endl;
+
+  Scan scan;
+  for ( unsigned int i = 0; i < 1080; ++i ) {
+    scan.ranges[i] = 0.01f*i;
+  }
+  const int i = 3;
+
+  std::cout << std::setw(36) << "Slots" << std::setw(10) << 1 << std::setw(10) << 10 << std::setw(10) << 100 << std::endl;
+  print<const int&>("Legacy, const int&", legacyEmit<const int&>, integer, i);
+  print<const int&>("Snapshot, const int&", snapshotEmit<const int&>, integer, i);
+  print<Scan>("Legacy, Scan", legacyEmit<Scan>, scanByValue, scan);
+  print<Scan>("Snapshot, Scan", snapshotEmit<Scan>, scanByValue, scan);
+  print<const Scan&>("Legacy, const Scan&", legacyEmit<const Scan&>, scanByReference, scan);
+  print<const Scan&>("Snapshot, const Scan&", snapshotEmit<const Scan&>, scanByReference, scan);
+  std::cout << std::endl;
+
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << "     Rewiring A Slot [ns/connect+disconnect]" << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << std::endl;
+
+  std::cout << std::setw(36) << "Other Topics" << std::setw(10) << 10 << std::setw(10) << 100 << std::setw(10) << 1000 << std::endl;
+  std::cout << std::setw(36) << "By name" << std::fixed << std::setprecision(1);
+  std::cout << std::setw(10) << rewire(10, false) << std::setw(10) << rewire(100, false) << std::setw(10) << rewire(1000, false) << std::endl;
+  std::cout << std::setw(36) << "By handle";
+  std::cout << std::setw(10) << rewire(10, true) << std::setw(10) << rewire(100, true) << std::setw(10) << rewire(1000, true) << std::endl;
+  std::cout << std::endl;
+
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << "     Slow (20us) Slot [ns/emit]" << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << std::endl;
+
+  ecl::SlotQueueStatistics statistics;
+  ecl::SlotExecutor executor;
+  std::cout << std::setw(36) << "Direct" << std::setw(10) << slowEmit(NULL, statistics) << std::endl;
+  std::cout << std::setw(36) << "Queued, DropOldest" << std::setw(10) << slowEmit(&executor, statistics) << std::endl;
+  std::cout << std::setw(36) << "  processed/dropped" << std::setw(10) << statistics.processed << std::setw(10) << statistics.dropped << std::endl;
+  std::cout << std::setw(36) << "  mean/max latency [us]" << std::setw(10) << statistics.mean_latency/1000.0 << std::setw(10) << statistics.max_latency/1000.0 << std::endl;
+  std::cout << std::endl;
+  return 0;
+}
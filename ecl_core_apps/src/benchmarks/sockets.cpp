@@ -0,0 +1,211 @@
+/**
+ * @file /src/benchmarks/sockets.cpp
+ *
+ * @brief Loopback throughput for header + payload messages.
+ *
+ * Compares sending each message as two writes, copying header and payload
+ * into a temporary buffer, a single gathered (writev style) write and, for
+ * the large payloads, a zero copy write.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <ecl/devices/socket.hpp>
+#include <ecl/exceptions/standard_exception.hpp>
+#include <ecl/threads/thread.hpp>
+#include <ecl/time/stopwatch.hpp>
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::SocketClient;
+using ecl::SocketServer;
+using ecl::StandardException;
+using ecl::StopWatch;
+using ecl::Thread;
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+const unsigned int port = 5590;
+const unsigned long header_size = 16;
+const unsigned long bytes_per_run = 32*1024*1024;
+
+enum Mode {
+  TwoWrites = 0,
+  CopyAndWrite,
+  GatherWrite,
+  ZeroCopyWrite
+};
+
+const char* mode_names[] = { "Two Writes", "Copy + Write", "Gather Write", "Zero Copy" };
+
+class Listener {
+public:
+  Listener(SocketServer &server) : server(server) {}
+  void run() { server.listen(); }
+  SocketServer &server;
+};
+
+class Reader {
+public:
+  Reader(SocketServer &server, const unsigned long &expected) : server(server), expected(expected), buffer(256*1024) {}
+  void run() {
+    unsigned long received = 0;
+    while ( received < expected ) {
+      long n = server.read(&buffer[0], buffer.size());
+      if ( n <= 0 ) { break; }
+      received += n;
+    }
+  }
+  SocketServer &server;
+  unsigned long expected;
+  std::vector<char> buffer;
+};
+
+/**
+ * Write everything, looping over partial writes.
+ */
+bool send_all(SocketClient &client, iovec *buffers, unsigned int count) {
+  while ( count > 0 ) {
+    long n = client.write(buffers, count);
+    if ( n < 0 ) { return false; }
+    while ( ( count > 0 ) && ( static_cast<unsigned long>(n) >= buffers->iov_len ) ) {
+      n -= buffers->iov_len;
+      ++buffers;
+      --count;
+    }
+    if ( count > 0 ) {
+      buffers->iov_base = static_cast<char*>(buffers->iov_base) + n;
+      buffers->iov_len -= n;
+    }
+  }
+  return true;
+}
+
+double run(SocketServer &server, SocketClient &client, const Mode &mode, const unsigned long &payload_size) {
+  const unsigned long message_size = header_size + payload_size;
+  const unsigned long number_of_messages = bytes_per_run/message_size;
+  std::vector<char> header(header_size, 'h');
+  std::vector<char> payload(payload_size, 'p');
+  std::vector<char> scratch(message_size);
+
+  Reader reader(server, number_of_messages*message_size);
+  Thread thread(&Reader::run, reader);
+  StopWatch stopwatch;
+  unsigned long zero_copy_sends = 0, zero_copy_completions = 0;
+  for ( unsigned long i = 0; i < number_of_messages; ++i ) {
+    switch ( mode ) {
+      case ( TwoWrites ) : {
+        iovec first = { &header[0], header_size };
+        iovec second = { &payload[0], payload_size };
+        send_all(client, &first, 1);
+        send_all(client, &second, 1);
+        break;
+      }
+      case ( CopyAndWrite ) : {
+        memcpy(&scratch[0], &header[0], header_size);
+        memcpy(&scratch[header_size], &payload[0], payload_size);
+        iovec buffer = { &scratch[0], message_size };
+        send_all(client, &buffer, 1);
+        break;
+      }
+      case ( GatherWrite ) : {
+        iovec buffers[2] = { { &header[0], header_size }, { &payload[0], payload_size } };
+        send_all(client, buffers, 2);
+        break;
+      }
+      case ( ZeroCopyWrite ) : {
+        // header is small, copy it - payload goes zero copy
+        iovec buffer = { &header[0], header_size };
+        send_all(client, &buffer, 1);
+        unsigned long sent = 0;
+        while ( sent < payload_size ) {
+          long n = client.writeZeroCopy(&payload[sent], payload_size - sent);
+          if ( n < 0 ) { break; }
+          sent += n;
+          ++zero_copy_sends;
+        }
+        zero_copy_completions += client.zeroCopyCompletions();
+        break;
+      }
+      default : { break; }
+    }
+  }
+  thread.join();
+  double elapsed = static_cast<double>(stopwatch.elapsed());
+  // payload buffers can't be released until every zero copy send has completed
+  for ( unsigned int i = 0; ( i < 1000 ) && ( zero_copy_completions < zero_copy_sends ); ++i ) {
+    zero_copy_completions += client.zeroCopyCompletions();
+    usleep(1000);
+  }
+  return elapsed;
+}
+
+/*****************************************************************************
+** Main
+*****************************************************************************/
+
+int main() {
+
+  std::cout << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << "          Loopback Throughput (header + payload)" << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << std::endl;
+
+  SocketServer server;
+  SocketClient client;
+  try {
+    server.open(port);
+    Listener listener(server);
+    Thread thread(&Listener::run, listener);
+    for ( unsigned int i = 0; ( i < 100 ) && !client.open(); ++i ) {
+      try {
+        client.open("localhost", port);
+      } catch ( const StandardException &e ) {
+        usleep(10000);
+      }
+    }
+    thread.join();
+  } catch ( const StandardException &e ) {
+    std::cout << "Could not open a loopback connection." << std::endl;
+    std::cout << e.what() << std::endl;
+    return 1;
+  }
+  client.setNoDelay(true);
+  const bool zero_copy = client.setZeroCopy(true);
+
+  const unsigned long payload_sizes[] = { 64, 1024, 64*1024 };
+  std::cout << std::setw(10) << "Payload" << std::setw(16) << "Mode" << std::setw(12) << "MB/s" << std::setw(14) << "Messages/s" << std::endl;
+  for ( unsigned int i = 0; i < 3; ++i ) {
+    for ( unsigned int mode = TwoWrites; mode <= ZeroCopyWrite; ++mode ) {
+      if ( ( mode == ZeroCopyWrite ) && ( !zero_copy || ( payload_sizes[i] < 16*1024 ) ) ) {
+        continue;
+      }
+      double elapsed = run(server, client, static_cast<Mode>(mode), payload_sizes[i]);
+      unsigned long messages = bytes_per_run/(header_size + payload_sizes[i]);
+      std::cout << std::setw(10) << payload_sizes[i] << std::setw(16) << mode_names[mode];
+      std::cout << std::setw(12) << std::fixed << std::setprecision(1) << (messages*(header_size + payload_sizes[i]))/elapsed/1.0e6;
+      std::cout << std::setw(14) << std::setprecision(0) << messages/elapsed << std::endl;
+    }
+  }
+  std::cout << std::endl;
+  if ( !zero_copy ) {
+    std::cout << "Zero copy sends are not supported here." << std::endl;
+  } else {
+    std::cout << "Note: loopback falls back to copying for zero copy sends." << std::endl;
+  }
+  return 0;
+}
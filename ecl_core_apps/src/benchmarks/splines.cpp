@@ -0,0 +1,126 @@
+/**
+ * @file /src/benchmarks/splines.cpp
+ *
+ * @brief Cost of sampling a cubic spline with thousands of knots.
+ *
+ * Compares the old lookup (a linear scan for the segment, then evaluating
+ * the segment's polynomial or its derivative polynomial) with the spline's
+ * own lookups and batched evaluation.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <ecl/containers/array.hpp>
+#include <ecl/geometry/cubic_spline.hpp>
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::Array;
+using ecl::CubicPolynomial;
+using ecl::CubicSpline;
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+const unsigned int number_of_knots = 5000;
+const unsigned int number_of_samples = 100000;
+volatile double sink = 0.0; // stop the evaluations being optimised away
+
+long now_ns() {
+  timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec*1000000000L + time.tv_nsec;
+}
+
+void print(const std::string &name, const long &elapsed_ns) {
+  std::cout << std::setw(32) << name << std::setw(10) << std::fixed << std::setprecision(1);
+  std::cout << static_cast<double>(elapsed_ns)/number_of_samples << std::endl;
+}
+
+/**
+ * What the spline used to do.
+ */
+unsigned int linear_scan(const Array<double> &domain, const double &x) {
+  unsigned int index = 0;
+  while ( x > domain[index+1] ) {
+    ++index;
+  }
+  return index;
+}
+
+/*****************************************************************************
+** Main
+*****************************************************************************/
+
+int main() {
+
+  std::cout << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << "     Cubic Spline Sampling, " << number_of_knots << " Knots [ns/sample]" << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << std::endl;
+
+  Array<double> x_set(number_of_knots), y_set(number_of_knots);
+  for ( unsigned int i = 0; i < number_of_knots; ++i ) {
+    x_set[i] = 0.01*i;
+    y_set[i] = ( i % 11 )*0.1;
+  }
+  CubicSpline spline = CubicSpline::Natural(x_set, y_set);
+  const Array<double> domain = spline.domain();
+  const Array<CubicPolynomial> polynomials = spline.polynomials();
+
+  Array<double> ordered(number_of_samples), scattered(number_of_samples), ys;
+  for ( unsigned int i = 0; i < number_of_samples; ++i ) {
+    ordered[i] = x_set.front() + i*(x_set.back() - x_set.front())/(number_of_samples - 1);
+  }
+  for ( unsigned int i = 0; i < number_of_samples; ++i ) {
+    scattered[i] = ordered[( i*7919UL ) % number_of_samples];
+  }
+
+  long start = now_ns();
+  for ( unsigned int i = 0; i < number_of_samples; ++i ) {
+    sink = polynomials[linear_scan(domain, ordered[i])](ordered[i]);
+  }
+  print("Linear scan, value", now_ns() - start);
+  start = now_ns();
+  for ( unsigned int i = 0; i < number_of_samples; ++i ) {
+    sink = polynomials[linear_scan(domain, ordered[i])].derivative()(ordered[i]);
+  }
+  print("Linear scan, derivative", now_ns() - start);
+
+  start = now_ns();
+  for ( unsigned int i = 0; i < number_of_samples; ++i ) {
+    sink = spline(ordered[i]);
+  }
+  print("operator() in order", now_ns() - start);
+  start = now_ns();
+  for ( unsigned int i = 0; i < number_of_samples; ++i ) {
+    sink = spline.derivative(ordered[i]);
+  }
+  print("derivative() in order", now_ns() - start);
+  start = now_ns();
+  for ( unsigned int i = 0; i < number_of_samples; ++i ) {
+    sink = spline(scattered[i]);
+  }
+  print("operator() scattered", now_ns() - start);
+  start = now_ns();
+  spline.evaluate(ordered, ys);
+  print("evaluate() in order", now_ns() - start);
+  sink = ys.back();
+  start = now_ns();
+  spline.evaluate(scattered, ys);
+  print("evaluate() scattered", now_ns() - start);
+  sink = ys.back();
+  std::cout << std::endl;
+  return 0;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file /src/benchmarks/thread_pool.cpp
+ *
+ * @brief Task spawn latency of ecl::ThreadPool vs a fresh ecl::Thread per task.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <atomic>
+#include <iostream>
+#include <ecl/threads/thread.hpp>
+#include <ecl/threads/thread_pool.hpp>
+#include <ecl/time/stopwatch.hpp>
+#include <ecl/time/timestamp.hpp>
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::StopWatch;
+using ecl::Thread;
+using ecl::ThreadPool;
+using ecl::TimeStamp;
+
+/*****************************************************************************
+** Tasks
+*****************************************************************************/
+
+const unsigned int number_of_tasks = 10000;
+
+/**
+ * Records how long it took from submission until the task started running.
+ */
+class LatencyTask {
+public:
+  LatencyTask() : total_latency(0.0) {}
+  void submitted() { submit_time.stamp(); }
+  void run() {
+    TimeStamp now;
+    total_latency += static_cast<double>(now - submit_time);
+  }
+  TimeStamp submit_time;
+  double total_latency;
+};
+
+/*****************************************************************************
+** Main
+*****************************************************************************/
+
+int main() {
+
+  std::cout << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << "          Task Spawn Latency (" << number_of_tasks << " tasks)" << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << std::endl;
+
+  StopWatch stopwatch;
+  TimeStamp elapsed[2];
+  double latency[2];
+
+  /*********************
+  ** Fresh Threads
+  **********************/
+  LatencyTask thread_task;
+  stopwatch.restart();
+  for ( unsigned int i = 0; i < number_of_tasks; ++i ) {
+    thread_task.submitted();
+    Thread thread(&LatencyTask::run, thread_task);
+    thread.join();
+  }
+  elapsed[0] = stopwatch.split();
+  latency[0] = thread_task.total_latency/number_of_tasks;
+
+  /*********************
+  ** Pool
+  **********************/
+  LatencyTask pool_task;
+  ThreadPool pool(1);
+  stopwatch.restart();
+  for ( unsigned int i = 0; i < number_of_tasks; ++i ) {
+    pool_task.submitted();
+    pool.submit(&LatencyTask::run, pool_task);
+    pool.wait();
+  }
+  elapsed[1] = stopwatch.split();
+  latency[1] = pool_task.total_latency/number_of_tasks;
+
+  std::cout << "                  Total [s]       Avg Spawn Latency [us]" << std::endl;
+  std::cout << "Thread per task : " << elapsed[0] << "     " << latency[0]*1000000 << std::endl;
+  std::cout << "ThreadPool      : " << elapsed[1] << "     " << latency[1]*1000000 << std::endl;
+  std::cout << std::endl;
+  return 0;
+}
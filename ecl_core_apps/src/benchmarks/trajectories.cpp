@@ -0,0 +1,89 @@
+/**
+ * @file /src/benchmarks/trajectories.cpp
+ *
+ * @brief Cost of interpolating a long joint trajectory.
+ *
+ * Times the tension spline interpolation of a 100 waypoint, 7 joint
+ * trajectory, for progressively tighter acceleration bounds (i.e. more
+ * work stretching the waypoint durations to meet them).
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <cmath>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <ecl/linear_algebra.hpp>
+#include <ecl/manipulators.hpp>
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::JointAngles;
+using ecl::Trajectory;
+using ecl::WayPoint;
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+const unsigned int number_of_waypoints = 100;
+const unsigned int number_of_joints = 7;
+const unsigned int number_of_runs = 10;
+
+long now_ns() {
+  timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec*1000000000L + time.tv_nsec;
+}
+
+void append_waypoints(Trajectory<JointAngles> &trajectory, const double &max_acceleration) {
+  WayPoint<JointAngles> waypoint(number_of_joints);
+  for ( unsigned int i = 0; i < number_of_waypoints; ++i ) {
+    for ( unsigned int j = 0; j < number_of_joints; ++j ) {
+      waypoint.angles()[j] = std::sin(0.7*i + j) + 0.3*std::cos(1.3*i*j);
+    }
+    waypoint.nominalRates(3.0);
+    trajectory.append(waypoint);
+  }
+  trajectory.maxAccelerations(max_acceleration);
+}
+
+/*****************************************************************************
+** Main
+*****************************************************************************/
+
+int main() {
+
+  std::cout << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << "   Tension Spline Interpolation, 100 Waypoints, 7 Joints" << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << std::endl;
+
+  std::cout << std::setw(14) << "Max Accel" << std::setw(14) << "Time [ms]" << std::setw(14) << "Duration [s]" << std::endl;
+  const double max_accelerations[] = { 5.0, 2.0, 0.5, 0.2, 0.05 };
+  for ( unsigned int k = 0; k < 5; ++k ) {
+    double duration = 0.0;
+    long elapsed = 0;
+    for ( unsigned int run = 0; run < number_of_runs; ++run ) {
+      Trajectory<JointAngles> trajectory(number_of_joints);
+      append_waypoints(trajectory, max_accelerations[k]);
+      long start = now_ns();
+      trajectory.tensionSplineInterpolation(4.0);
+      elapsed += now_ns() - start;
+      duration = trajectory.duration();
+    }
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << std::setw(14) << max_accelerations[k];
+    std::cout << std::setw(14) << elapsed/1.0e6/number_of_runs;
+    std::cout << std::setw(14) << duration << std::endl;
+  }
+  std::cout << std::endl;
+  return 0;
+}
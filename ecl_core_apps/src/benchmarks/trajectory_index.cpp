@@ -0,0 +1,109 @@
+/**
+ * @file /src/benchmarks/trajectory_index.cpp
+ *
+ * @brief Cost of point to trajectory distance queries on long paths.
+ *
+ * Compares scanning every segment with odometry::distance() against the
+ * trajectory index's grid search and its incremental search, for a robot
+ * following the path.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <cmath>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <ecl/geometry/odometry.hpp>
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::odometry::Position2D;
+using ecl::odometry::Trajectory2D;
+using ecl::odometry::TrajectoryIndex;
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+const int number_of_poses = 10000;
+const int number_of_queries = 2000;
+volatile double sink = 0.0; // stop the queries being optimised away
+
+long now_ns() {
+  timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return time.tv_sec*1000000000L + time.tv_nsec;
+}
+
+void print(const std::string &name, const long &elapsed_ns) {
+  std::cout << std::setw(32) << name << std::setw(12) << std::fixed << std::setprecision(1);
+  std::cout << static_cast<double>(elapsed_ns)/number_of_queries << std::endl;
+}
+
+/*****************************************************************************
+** Main
+*****************************************************************************/
+
+int main() {
+
+  std::cout << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << "     Trajectory Distances, " << number_of_poses << " Poses [ns/query]" << std::endl;
+  std::cout << "***********************************************************" << std::endl;
+  std::cout << std::endl;
+
+  // a winding path, 5cm between poses
+  Trajectory2D path(3, number_of_poses);
+  for ( int i = 0; i < number_of_poses; ++i ) {
+    const float s = 0.05f*i;
+    path.col(i) << s, 10.0f*std::sin(0.05f*s), 0.0f;
+  }
+  // the robot, a little off the path
+  Trajectory2D robot(3, number_of_queries);
+  for ( int i = 0; i < number_of_queries; ++i ) {
+    robot.col(i) = path.col(i*(number_of_poses/number_of_queries)) + Eigen::Vector3f(0.02f, 0.1f, 0.0f);
+  }
+
+  long start = now_ns();
+  TrajectoryIndex index(path);
+  std::cout << std::setw(32) << "Build [us]" << std::setw(12) << (now_ns() - start)/1000 << std::endl;
+
+  start = now_ns();
+  for ( int i = 0; i < number_of_queries; ++i ) {
+    sink = ecl::odometry::distance(Position2D(robot.block<2,1>(0,i)), path);
+  }
+  print("odometry::distance()", now_ns() - start);
+  start = now_ns();
+  for ( int i = 0; i < number_of_queries; ++i ) {
+    sink = index.distance(Position2D(robot.block<2,1>(0,i)));
+  }
+  print("TrajectoryIndex::distance()", now_ns() - start);
+  int segment = 0;
+  start = now_ns();
+  for ( int i = 0; i < number_of_queries; ++i ) {
+    segment = index.nearestSegment(Position2D(robot.block<2,1>(0,i)), segment);
+  }
+  print("Incremental nearestSegment()", now_ns() - start);
+  sink = segment;
+
+  TrajectoryIndex short_index(path.leftCols(TrajectoryIndex::brute_force_threshold));
+  start = now_ns();
+  for ( int i = 0; i < number_of_queries; ++i ) {
+    sink = ecl::odometry::distance(Position2D(robot.block<2,1>(0,i)), path.leftCols(TrajectoryIndex::brute_force_threshold));
+  }
+  print("odometry::distance(), short", now_ns() - start);
+  start = now_ns();
+  for ( int i = 0; i < number_of_queries; ++i ) {
+    sink = short_index.distance(Position2D(robot.block<2,1>(0,i)));
+  }
+  print("Scan, short", now_ns() - start);
+  std::cout << std::endl;
+  return 0;
+}
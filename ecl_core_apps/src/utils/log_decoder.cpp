@@ -0,0 +1,74 @@
+/**
+ * @file /src/utils/log_decoder.cpp
+ *
+ * @brief Renders binary (LOG_BINARY) log files as text.
+ *
+ * @date October 2026
+ **/
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <ecl/command_line.hpp>
+#include <ecl/streams/log_records.hpp>
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using std::string;
+using ecl::ArgException;
+using ecl::CmdLine;
+using ecl::LogRecordDecoder;
+using ecl::UnlabeledValueArg;
+using ecl::ValueArg;
+
+/*****************************************************************************
+** Main program
+*****************************************************************************/
+
+int main(int argc, char** argv) {
+
+    string input_name, output_name;
+    try {
+        CmdLine cmd("Renders binary log files (written with LOG_BINARY) as text.",' ',"0.1");
+        UnlabeledValueArg<string> arg_input("input","Binary log file",true,"","string", cmd);
+        ValueArg<string> arg_output("o","output","Text file to write to [standard output]",false,"","string");
+        cmd.add(arg_output);
+        cmd.parse(argc,argv);
+        input_name = arg_input.getValue();
+        output_name = arg_output.getValue();
+    } catch ( ArgException &e ) {
+        std::cerr << "error: " << e.error() << " for arg " << e.argId() << std::endl;
+        return 1;
+    }
+
+    std::ifstream input(input_name.c_str(), std::ios::binary);
+    if ( !input ) {
+        std::cerr << "error: could not open " << input_name << std::endl;
+        return 1;
+    }
+    std::ofstream output_file;
+    if ( !output_name.empty() ) {
+        output_file.open(output_name.c_str());
+        if ( !output_file ) {
+            std::cerr << "error: could not open " << output_name << std::endl;
+            return 1;
+        }
+    }
+    std::ostream &output = output_name.empty() ? std::cout : output_file;
+
+    LogRecordDecoder decoder;
+    if ( !decoder.decode(input, output) ) {
+        std::cerr << "error: corrupt or truncated log after " << decoder.size() << " entries" << std::endl;
+        return 1;
+    }
+    if ( decoder.skipped() > 0 ) {
+        std::cerr << "warning: skipped " << decoder.skipped() << " entries whose format was in a dropped flush" << std::endl;
+    }
+    return 0;
+}
@@ -21,6 +21,7 @@
 #include "devices/modes.hpp"
 #include "devices/traits.hpp"
 #include "devices/ofile.hpp"
+#include "devices/reactor.hpp"
 #include "devices/serial.hpp"
 #include "devices/socket.hpp"
 #include "devices/string.hpp"
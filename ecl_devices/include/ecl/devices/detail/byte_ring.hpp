@@ -0,0 +1,163 @@
+/**
+ * @file /include/ecl/devices/detail/byte_ring.hpp
+ *
+ * @brief Lock-free, single producer/consumer ring of variable length records.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_DEVICES_BYTE_RING_HPP_
+#define ECL_DEVICES_BYTE_RING_HPP_
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+#include <stdint.h>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+namespace devices {
+
+/*****************************************************************************
+** Interface [ByteRing]
+*****************************************************************************/
+/**
+ * @brief Lock-free ring of variable length byte records.
+ *
+ * Used internally by the asynchronous shared files to hand blocks of
+ * formatted text from one producing thread to the background writer.
+ * Each record is stored with a length prefix and is published only when
+ * complete, so the consumer never sees (and never writes out) half a record.
+ *
+ * - push() may only be called from the producer thread.
+ * - pop() may only be called from the consumer thread.
+ *
+ * Index handling mirrors that of ecl::SpscPushAndPop (cached copies of
+ * the other side's index, release/acquire publication, power of two
+ * capacity).
+ */
+class ByteRing {
+public:
+	static const std::size_t cache_line_size = 64;
+	static const std::size_t header_size = sizeof(uint32_t);
+
+	/**
+	 * @brief Allocates the ring.
+	 *
+	 * @param capacity : bytes of storage, rounded up to a power of two.
+	 */
+	ByteRing(const std::size_t &capacity) :
+		leader(0),
+		follower_cache(0),
+		follower(0),
+		leader_cache(0)
+	{
+		std::size_t power = 1;
+		while ( power < capacity ) { power <<= 1; }
+		storage.resize(power);
+		mask = power - 1;
+	}
+
+	/**
+	 * @brief Pushes a complete record [producer only].
+	 *
+	 * @param s : the record's bytes.
+	 * @param n : the record's length.
+	 * @return bool : false if there was not enough room (nothing is stored).
+	 */
+	bool push(const char *s, const std::size_t &n) {
+		const std::size_t current = leader.load(std::memory_order_relaxed);
+		const std::size_t required = header_size + n;
+		if ( storage.size() - ( current - follower_cache ) < required ) {
+			follower_cache = follower.load(std::memory_order_acquire);
+			if ( storage.size() - ( current - follower_cache ) < required ) {
+				return false;
+			}
+		}
+		const uint32_t length = static_cast<uint32_t>(n);
+		copy_in(current, reinterpret_cast<const char*>(&length), header_size);
+		copy_in(current + header_size, s, n);
+		leader.store(current + required, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * @brief Pops as many complete records as fit in the buffer [consumer only].
+	 *
+	 * @param s : buffer to pop into (records are concatenated).
+	 * @param n : the buffer's length.
+	 * @return std::size_t : number of bytes popped (zero if empty or the next record doesn't fit).
+	 */
+	std::size_t pop(char *s, const std::size_t &n) {
+		std::size_t current = follower.load(std::memory_order_relaxed);
+		if ( current == leader_cache ) {
+			leader_cache = leader.load(std::memory_order_acquire);
+		}
+		std::size_t popped = 0;
+		while ( current != leader_cache ) {
+			uint32_t length;
+			copy_out(current, reinterpret_cast<char*>(&length), header_size);
+			if ( popped + length > n ) {
+				break;
+			}
+			copy_out(current + header_size, s + popped, length);
+			popped += length;
+			current += header_size + length;
+		}
+		follower.store(current, std::memory_order_release);
+		return popped;
+	}
+
+	/**
+	 * @brief Snapshot of whether there is anything waiting to be popped.
+	 */
+	bool empty() const {
+		return follower.load(std::memory_order_acquire) == leader.load(std::memory_order_acquire);
+	}
+	/**
+	 * @brief Storage length (after rounding up).
+	 */
+	std::size_t capacity() const { return storage.size(); }
+
+private:
+	void copy_in(const std::size_t &index, const char *s, const std::size_t &n) {
+		const std::size_t offset = index & mask;
+		const std::size_t first = ( n < storage.size() - offset ) ? n : storage.size() - offset;
+		memcpy(&storage[offset], s, first);
+		memcpy(&storage[0], s + first, n - first);
+	}
+	void copy_out(const std::size_t &index, char *s, const std::size_t &n) const {
+		const std::size_t offset = index & mask;
+		const std::size_t first = ( n < storage.size() - offset ) ? n : storage.size() - offset;
+		memcpy(s, &storage[offset], first);
+		memcpy(s + first, &storage[0], n - first);
+	}
+
+	std::vector<char> storage;
+	std::size_t mask;
+	char padding_front[cache_line_size];
+	// producer side
+	std::atomic<std::size_t> leader;
+	std::size_t follower_cache;
+	char padding_producer[cache_line_size];
+	// consumer side
+	std::atomic<std::size_t> follower;
+	std::size_t leader_cache;
+	char padding_consumer[cache_line_size];
+};
+
+} // namespace devices
+} // namespace ecl
+
+#endif /* ECL_DEVICES_BYTE_RING_HPP_ */
@@ -0,0 +1,109 @@
+/**
+ * @file /include/ecl/devices/detail/socket_options_pos.hpp
+ *
+ * @brief Option and zero copy helpers shared by the posix socket devices.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_DEVICES_SOCKET_OPTIONS_POS_HPP_
+#define ECL_DEVICES_SOCKET_OPTIONS_POS_HPP_
+
+/*****************************************************************************
+** Cross platform
+*****************************************************************************/
+
+#include <ecl/config/ecl.hpp>
+#ifndef ECL_IS_APPLE
+#ifdef ECL_IS_POSIX
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#if defined(__linux__)
+  #include <linux/errqueue.h>
+#endif
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+namespace devices {
+
+/*****************************************************************************
+** Methods
+*****************************************************************************/
+/**
+ * @brief Switch the descriptor between blocking and non-blocking mode.
+ *
+ * @param file_descriptor : the socket.
+ * @param blocking : the mode.
+ * @return bool : false if fcntl failed (errno is set).
+ */
+inline bool set_blocking(const int &file_descriptor, const bool &blocking) {
+	int flags = fcntl(file_descriptor, F_GETFL, 0);
+	if ( flags == -1 ) {
+		return false;
+	}
+	flags = blocking ? ( flags & ~O_NONBLOCK ) : ( flags | O_NONBLOCK );
+	return ( fcntl(file_descriptor, F_SETFL, flags) == 0 );
+}
+
+/**
+ * @brief Set an integer socket option.
+ *
+ * @return bool : false if setsockopt failed (errno is set).
+ */
+inline bool set_socket_option(const int &file_descriptor, const int &level, const int &name, const int &value) {
+	return ( setsockopt(file_descriptor, level, name, &value, sizeof(value)) == 0 );
+}
+
+/**
+ * @brief Drain the error queue of zero copy completion notifications.
+ *
+ * The kernel reports completed MSG_ZEROCOPY sends as ranges of their
+ * sequence numbers (one per send, starting at zero).
+ *
+ * @param file_descriptor : the socket.
+ * @return unsigned long : number of sends that completed since the last call.
+ */
+inline unsigned long reap_zero_copy(const int &file_descriptor) {
+	unsigned long completed = 0;
+	#if defined(__linux__) && defined(SO_EE_ORIGIN_ZEROCOPY)
+	char control[128];
+	for (;;) {
+		msghdr message = msghdr();
+		message.msg_control = control;
+		message.msg_controllen = sizeof(control);
+		if ( recvmsg(file_descriptor, &message, MSG_ERRQUEUE | MSG_DONTWAIT) == -1 ) {
+			break; // EAGAIN, nothing (more) queued
+		}
+		for ( cmsghdr *header = CMSG_FIRSTHDR(&message); header != NULL; header = CMSG_NXTHDR(&message, header) ) {
+			const sock_extended_err *error = reinterpret_cast<const sock_extended_err*>(CMSG_DATA(header));
+			if ( ( error->ee_errno == 0 ) && ( error->ee_origin == SO_EE_ORIGIN_ZEROCOPY ) ) {
+				completed += error->ee_data - error->ee_info + 1;
+			}
+		}
+	}
+	#else
+	(void) file_descriptor;
+	#endif
+	return completed;
+}
+
+} // namespace devices
+} // namespace ecl
+
+#endif  /* ECL_IS_POSIX */
+#endif  /* !ECL_IS_APPLE */
+#endif /* ECL_DEVICES_SOCKET_OPTIONS_POS_HPP_ */
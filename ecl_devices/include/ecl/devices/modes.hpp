@@ -37,6 +37,17 @@ enum WriteMode {
     Append 			/**< @brief Appends to an existing object (opens if not existing). **/
 };
 
+/**
+ * @brief What to do when an asynchronous device's buffer is full.
+ *
+ * Used by devices that hand their data to a background writer
+ * (e.g. shared files in asynchronous mode).
+ **/
+enum OverflowPolicy {
+    DropOnOverflow,  /**< @brief Discard the data (never blocks the caller). **/
+    BlockOnOverflow  /**< @brief Wait for the background writer to make room. **/
+};
+
 
 } // namespace ecl
 
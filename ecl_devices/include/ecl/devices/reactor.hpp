@@ -0,0 +1,296 @@
+/**
+ * @file /include/ecl/devices/reactor.hpp
+ *
+ * @brief Multiplexes reads from many devices onto a few threads (epoll).
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_DEVICES_REACTOR_HPP_
+#define ECL_DEVICES_REACTOR_HPP_
+
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#include <ecl/config/ecl.hpp>
+#if defined(ECL_IS_POSIX) && defined(__linux__)
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <map>
+#include <vector>
+#include <ecl/threads/condition_variable.hpp>
+#include <ecl/threads/mutex.hpp>
+#include <ecl/threads/priority.hpp>
+#include <ecl/threads/thread.hpp>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+namespace devices {
+
+/*****************************************************************************
+** Interface [ReactorCallbacks]
+*****************************************************************************/
+/**
+ * @brief Abstract parent for the type erased reactor read callbacks.
+ */
+class ReadCallback {
+public:
+	virtual ~ReadCallback() {}
+	virtual void operator()(const char *bytes, const unsigned long &n) = 0;
+};
+
+/**
+ * @brief Read callback wrapping a free function.
+ */
+class FreeReadCallback : public ReadCallback {
+public:
+	FreeReadCallback(void (*function)(const char*, const unsigned long&)) : function(function) {}
+	void operator()(const char *bytes, const unsigned long &n) { function(bytes, n); }
+private:
+	void (*function)(const char*, const unsigned long&);
+};
+
+/**
+ * @brief Read callback wrapping a member function.
+ *
+ * @tparam C : the class owning the member function.
+ */
+template <typename C>
+class MemberReadCallback : public ReadCallback {
+public:
+	MemberReadCallback(void (C::*function)(const char*, const unsigned long&), C &c) : function(function), c(c) {}
+	void operator()(const char *bytes, const unsigned long &n) { (c.*function)(bytes, n); }
+private:
+	void (C::*function)(const char*, const unsigned long&);
+	C &c;
+};
+
+/**
+ * @brief Abstract parent for the type erased reactor write-ready callbacks.
+ */
+class WriteCallback {
+public:
+	virtual ~WriteCallback() {}
+	virtual void operator()() = 0;
+};
+
+/**
+ * @brief Write-ready callback wrapping a free function.
+ */
+class FreeWriteCallback : public WriteCallback {
+public:
+	FreeWriteCallback(void (*function)()) : function(function) {}
+	void operator()() { function(); }
+private:
+	void (*function)();
+};
+
+/**
+ * @brief Write-ready callback wrapping a member function.
+ *
+ * @tparam C : the class owning the member function.
+ */
+template <typename C>
+class MemberWriteCallback : public WriteCallback {
+public:
+	MemberWriteCallback(void (C::*function)(), C &c) : function(function), c(c) {}
+	void operator()() { (c.*function)(); }
+private:
+	void (C::*function)();
+	C &c;
+};
+
+/*****************************************************************************
+** Interface [Reactor]
+*****************************************************************************/
+/**
+ * @brief Dispatches device reads from an epoll set on a few threads.
+ *
+ * Instead of dedicating a blocking reader thread to every serial port and
+ * socket, register their file descriptors here. The reactor threads sleep
+ * in epoll_wait() and when a device becomes readable, read whatever has
+ * arrived into that device's receive buffer and hand it to its callback.
+ *
+ * @code
+ * class Lidar {
+ * public:
+ *     void received(const char *bytes, const unsigned long &n) { ... }
+ * };
+ *
+ * Serial serial("/dev/ttyUSB0", BaudRate_115200);
+ * SocketClient client("localhost", 5555);
+ * Lidar lidar;
+ *
+ * devices::Reactor reactor(1);    // one thread for all the devices
+ * reactor.add(serial, &Lidar::received, lidar);
+ * reactor.add(client, on_client); // void on_client(const char*, const unsigned long&)
+ * @endcode
+ *
+ * Any device with a fileDescriptor() accessor (Serial, SocketClient,
+ * SocketServer) can be added, or the raw descriptor can be used directly.
+ * The devices' own read()/write() can still be used from other threads,
+ * but reads from the device will race the reactor. Remove a device before
+ * closing it, the descriptor number may be reused.
+ *
+ * <b>Callbacks</b>:
+ *
+ * - Callbacks for one device are never run concurrently (the descriptor
+ *   is only rearmed after its callback returns), callbacks for different
+ *   devices may run concurrently if the reactor has more than one thread.
+ * - A zero length read callback means the device hung up or failed. It is
+ *   removed from the reactor before the callback is made.
+ * - Write-ready callbacks are one shot - request one with notifyWritable()
+ *   when a write could not complete.
+ * - Callbacks may add or remove devices, including their own.
+ *
+ * The descriptors' blocking mode is not altered. Each dispatch makes a
+ * single read of at most the buffer size, more data re-triggers the
+ * descriptor.
+ */
+class Reactor {
+public:
+	/**
+	 * @brief Spawn the reactor threads.
+	 *
+	 * @param number_of_threads : number of dispatching threads.
+	 * @param priority : priority for the dispatching threads.
+	 * @exception StandardException : throws if the epoll set could not be created [debug mode only].
+	 */
+	Reactor(const unsigned int &number_of_threads = 1, const Priority &priority = DefaultPriority);
+	/**
+	 * @brief Stops and joins the reactor threads.
+	 *
+	 * The devices themselves are not closed.
+	 */
+	virtual ~Reactor();
+
+	/*********************
+	** Registration
+	**********************/
+	/**
+	 * @brief Register a device with a free function read callback.
+	 *
+	 * @param device : the device (must provide fileDescriptor()).
+	 * @param function : callback receiving the bytes read.
+	 * @param buffer_size : size of this device's receive buffer.
+	 * @return bool : false if it could not be added (e.g. already registered).
+	 */
+	template <typename Device>
+	bool add(Device &device, void (*function)(const char*, const unsigned long&), const unsigned long &buffer_size = 4096) {
+		return add(device.fileDescriptor(), new FreeReadCallback(function), buffer_size);
+	}
+	/**
+	 * @brief Register a device with a member function read callback.
+	 *
+	 * @param device : the device (must provide fileDescriptor()).
+	 * @param function : callback receiving the bytes read.
+	 * @param c : instance to run the callback on (must outlive the registration).
+	 * @param buffer_size : size of this device's receive buffer.
+	 * @return bool : false if it could not be added (e.g. already registered).
+	 */
+	template <typename Device, typename C>
+	bool add(Device &device, void (C::*function)(const char*, const unsigned long&), C &c, const unsigned long &buffer_size = 4096) {
+		return add(device.fileDescriptor(), new MemberReadCallback<C>(function, c), buffer_size);
+	}
+	/**
+	 * @brief Register a raw file descriptor.
+	 *
+	 * @param file_descriptor : the descriptor to watch for reads.
+	 * @param callback : heap allocated callback, the reactor takes ownership.
+	 * @param buffer_size : size of this descriptor's receive buffer.
+	 * @return bool : false if it could not be added (the callback is deleted).
+	 */
+	bool add(const int &file_descriptor, ReadCallback *callback, const unsigned long &buffer_size = 4096);
+
+	/**
+	 * @brief Unregister a device.
+	 *
+	 * If its callbacks are running on a reactor thread, this waits for them
+	 * to finish, so the device may be closed as soon as it returns. Called
+	 * from one of the reactor's own callbacks it can't wait - it returns
+	 * straight away and the registration is cleaned up after the running
+	 * dispatch. No callbacks follow a removal made from the device's own callback.
+	 *
+	 * @param device : the device (must provide fileDescriptor()).
+	 * @return bool : false if it was not registered.
+	 */
+	template <typename Device>
+	bool remove(Device &device) { return remove(device.fileDescriptor()); }
+	/**
+	 * @brief Unregister a raw file descriptor.
+	 *
+	 * @param file_descriptor : the registered descriptor.
+	 * @return bool : false if it was not registered.
+	 */
+	bool remove(const int &file_descriptor);
+
+	/*********************
+	** Writing
+	**********************/
+	/**
+	 * @brief Request a one shot callback when the device can be written to.
+	 *
+	 * @param device : a registered device (must provide fileDescriptor()).
+	 * @param function : callback to run.
+	 * @return bool : false if the device is not registered.
+	 */
+	template <typename Device>
+	bool notifyWritable(Device &device, void (*function)()) {
+		return notifyWritable(device.fileDescriptor(), new FreeWriteCallback(function));
+	}
+	/**
+	 * @brief Request a one shot member function callback when the device can be written to.
+	 *
+	 * @param device : a registered device (must provide fileDescriptor()).
+	 * @param function : callback to run.
+	 * @param c : instance to run the callback on.
+	 * @return bool : false if the device is not registered.
+	 */
+	template <typename Device, typename C>
+	bool notifyWritable(Device &device, void (C::*function)(), C &c) {
+		return notifyWritable(device.fileDescriptor(), new MemberWriteCallback<C>(function, c));
+	}
+	/**
+	 * @brief Request a one shot callback when the descriptor can be written to.
+	 *
+	 * @param file_descriptor : a registered descriptor.
+	 * @param callback : heap allocated callback, the reactor takes ownership.
+	 * @return bool : false if the descriptor is not registered (the callback is deleted).
+	 */
+	bool notifyWritable(const int &file_descriptor, WriteCallback *callback);
+
+	unsigned int size() const; /**< @brief Number of registered descriptors. **/
+
+private:
+	struct Registration;
+
+	void spin();
+	void dispatch(const int &file_descriptor, const unsigned int &serial, const unsigned int &events);
+	bool rearm(Registration *registration);
+	bool retire(Registration *registration);
+	void release(Registration *registration);
+
+	int epoll_fd;
+	int wakeup_fd;
+	unsigned int serials;
+	std::vector<Thread*> threads;
+	std::map<int, Registration*> registrations;
+	mutable Mutex mutex;
+	ConditionVariable idle; // a dispatch has finished
+};
+
+} // namespace devices
+} // namespace ecl
+
+#endif /* ECL_IS_POSIX && __linux__ */
+#endif /* ECL_DEVICES_REACTOR_HPP_ */
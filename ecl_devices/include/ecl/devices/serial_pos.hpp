@@ -25,9 +25,9 @@
 
 #include <string>
 #include <termios.h>
+#include <unistd.h>
 #include <ecl/exceptions/standard_exception.hpp>
 #include <ecl/errors/compile_time_assert.hpp>
-#include <ecl/time/snooze.hpp>
 #include <ecl/utilities/parameter.hpp>
 #include <ecl/type_traits/fundamental_types.hpp>
 #include "detail/error_handler.hpp"
@@ -73,8 +73,10 @@ namespace ecl
    *
    * Subsequently, the default mode of operation is using
    * a timeout - as this one will automatically return you whenever any
-   * new data comes in. Great for control! An alternative non-blocking option is
-   * also provided.
+   * new data comes in. Great for control! The timeout is implemented by
+   * sleeping in poll() on the file descriptor, so it has millisecond
+   * resolution and the thread wakes as soon as data arrives. An alternative
+   * non-blocking option is also provided.
    *
    * <b>Usage</b>:
    *
@@ -105,6 +107,14 @@ namespace ecl
    * n = serial.read(buffer,256); // always returns, even if nothing is there.
    * @endcode
    *
+   * Reading whole packets/lines (the timeout applies to the whole call).
+   *
+   * @code
+   * serial.block(20);
+   * n = serial.read_exactly(buffer,16);      // fixed size packet
+   * n = serial.read_until(buffer,256,'\n');  // newline terminated
+   * @endcode
+   *
    * Writing:
    *
    * @code
@@ -141,7 +151,7 @@ namespace ecl
      * constructors. Use this with the open() command to do so. You can
      * check for open status with via the open accessor.
      */
-    Serial() : is_open(false), error_handler(NoError)
+    Serial() : read_timeout_ms(5000), read_ahead_begin(0), read_ahead_end(0), is_open(false), error_handler(NoError)
     {};
     /**
      * @brief Constructs and opens the connection, RAII style.
@@ -273,17 +283,9 @@ namespace ecl
      * @brief Switch to blocking mode with a timeout for reading.
      *
      * Switched to blocking mode with the specified timeout in milliseconds.
-     * Note that there is a valid minimum value set by termios for serial
-     * timeouts - 100ms. We go beyond this though - if a timeout < 100ms is set
-     * this serial class will implement its own blocking loop with the specified
-     * timeout. If the timeout is > 100ms, then it will default to typical termios
-     * behaviour.
-     *
-     * Low latency blocking has its own looping logic (keeps the interface simple):
-     *
-     *  - <5ms  : loops at 1ms intervals.
-     *  - <20ms : loops at 2ms intervals.
-     *  - 20-100ms : loops at 5ms intervals.
+     * Reads sleep in poll() until data arrives or the timeout expires, so
+     * unlike the termios VTIME setting (100ms granularity) any millisecond
+     * timeout is honoured and no cpu is spent waiting.
      *
      * @param timeout : timeout measured in ms.
      */
@@ -338,6 +340,41 @@ namespace ecl
      **/
     template <typename Byte>
     long read(Byte *bytes, const unsigned long &n);
+    /**
+     * @brief Read exactly n bytes, unless the timeout expires first.
+     *
+     * Keeps reading until n bytes have arrived. The timeout configured via
+     * block() applies to the whole call, not to each chunk. In non-blocking
+     * mode it only returns what is already available.
+     *
+     * This function gives a compile time error if the type is not a byte (refer to ecl_mpl's)
+     * is_byte type traits.
+     *
+     * @param bytes : character string to read into from the serial port's buffer.
+     * @param n : the number of bytes to read.
+     * @return long : the number of bytes read (< n if it timed out), -1 on error.
+     * @exception StandardException : throws reading returned an error [debug mode only].
+     **/
+    template <typename Byte>
+    long read_exactly(Byte *bytes, const unsigned long &n);
+    /**
+     * @brief Read up to and including a delimiter.
+     *
+     * Reads until the delimiter is received, n bytes have been read or the
+     * timeout configured via block() expires (for the whole call). Bytes that
+     * arrive after the delimiter are kept for the next read.
+     *
+     * This function gives a compile time error if the type is not a byte (refer to ecl_mpl's)
+     * is_byte type traits.
+     *
+     * @param bytes : character string to read into from the serial port's buffer.
+     * @param n : the maximum number of bytes to read.
+     * @param delimiter : terminating byte (included in the result).
+     * @return long : the number of bytes read, -1 on error.
+     * @exception StandardException : throws reading returned an error [debug mode only].
+     **/
+    template <typename Byte>
+    long read_until(Byte *bytes, const unsigned long &n, const Byte &delimiter);
 
     /*********************
      ** Serial Specific
@@ -349,14 +386,14 @@ namespace ecl
      * them both.
      */
     void clear()
-    { tcflush(file_descriptor,TCIOFLUSH);}
+    { tcflush(file_descriptor,TCIOFLUSH); read_ahead_begin = read_ahead_end = 0;}
     /**
      * @brief Clear the input buffer.
      *
      * The serial input buffer are managed by the system. This clears it.
      */
     void clearInputBuffer()
-    { tcflush(file_descriptor,TCIFLUSH);}
+    { tcflush(file_descriptor,TCIFLUSH); read_ahead_begin = read_ahead_end = 0;}
     /**
      * @brief Clear the output buffer.
      *
@@ -373,13 +410,25 @@ namespace ecl
      */
     const Error& error() const
     { return error_handler;}
+
+    /**
+     * @brief The underlying file descriptor (e.g. for registering with a devices::Reactor).
+     */
+    int fileDescriptor() const
+    { return file_descriptor;}
   private:
     /*********************
      ** Constants
      **********************/
     enum {
-      NonBlocking = -1
+      NonBlocking = -1,
+      ReadAheadSize = 512
     };
+    /*********************
+     ** Reading
+     **********************/
+    long read_bytes(unsigned char *bytes, const unsigned long &n, const bool &fill, const int &delimiter);
+    long read_chunk(unsigned char *bytes, const unsigned long &n, const long &timeout_ms);
     /*********************
      ** Variables
      **********************/
@@ -387,8 +436,8 @@ namespace ecl
     termios options;
     std::string port;
     long read_timeout_ms;
-    ecl::Snooze fake_snooze;
-    unsigned int fake_loop_count;
+    unsigned char read_ahead[ReadAheadSize]; // bytes received after a read_until() delimiter
+    unsigned int read_ahead_begin, read_ahead_end;
     bool is_open;
     ecl::Error error_handler;
   };
@@ -443,77 +492,28 @@ namespace ecl
   long Serial::read(Byte &byte)
   {
     ecl_compile_time_assert( is_byte<Byte>::value );
-    if ( !is_open )  // internal check only, don't worry about doing the full device filename check here (we need speed)
-    {
-      ecl_debug_throw( StandardException(LOC, OpenError, std::string("Port ") + port + std::string(" is not open.")));
-      error_handler = OpenError;
-      return -1;
-    }
-    ssize_t no_read;
-    if ( ( read_timeout_ms != NonBlocking ) && ( read_timeout_ms < 100 ) )
-    {
-      fake_snooze.initialise();
-      for ( unsigned int i = 0; i < fake_loop_count; ++i )
-      {
-        no_read = ::read(file_descriptor, &byte, 1);
-        if ( no_read != 0 )
-        {
-          break;
-        }
-        fake_snooze();
-      }
-    }
-    else
-    {
-      no_read = ::read(file_descriptor, &byte, 1);
-    }
-    if ( no_read < 0 )
-    {
-      ecl_debug_throw(devices::read_exception(LOC));
-      error_handler = devices::read_error();
-      return -1;
-    }
-    error_handler = NoError;
-    return no_read;
-
+    return read_bytes(reinterpret_cast<unsigned char*>(&byte), 1, false, -1);
   }
 
   template <typename Byte>
   long Serial::read(Byte *bytes, const unsigned long &n)
   {
     ecl_compile_time_assert( is_byte<Byte>::value );
-    if ( !is_open )  // internal check only, don't worry about doing the full device filename check here (we need speed)
-    {
-      ecl_debug_throw( StandardException(LOC, OpenError, std::string("Port ") + port + std::string(" is not open.")));
-      error_handler = OpenError;
-      return -1;
-    }
-    ssize_t no_read = 0;
-    if ( ( read_timeout_ms != NonBlocking ) && ( read_timeout_ms < 100 ) )
-    {
-      fake_snooze.initialise();
-      for ( unsigned int i = 0; i < fake_loop_count; ++i )
-      {
-        no_read = ::read(file_descriptor, bytes, n);
-        if ( no_read != 0 )
-        {
-          break;
-        }
-        fake_snooze();
-      }
-    }
-    else
-    {
-      no_read = ::read(file_descriptor, bytes, n);
-    }
-    if ( no_read < 0 )
-    {
-      ecl_debug_throw(devices::read_exception(LOC));
-      error_handler = devices::read_error();
-      return -1;
-    }
-    error_handler = NoError;
-    return no_read;
+    return read_bytes(reinterpret_cast<unsigned char*>(bytes), n, false, -1);
+  }
+
+  template <typename Byte>
+  long Serial::read_exactly(Byte *bytes, const unsigned long &n)
+  {
+    ecl_compile_time_assert( is_byte<Byte>::value );
+    return read_bytes(reinterpret_cast<unsigned char*>(bytes), n, true, -1);
+  }
+
+  template <typename Byte>
+  long Serial::read_until(Byte *bytes, const unsigned long &n, const Byte &delimiter)
+  {
+    ecl_compile_time_assert( is_byte<Byte>::value );
+    return read_bytes(reinterpret_cast<unsigned char*>(bytes), n, true, static_cast<unsigned char>(delimiter));
   }
 
   /*****************************************************************************
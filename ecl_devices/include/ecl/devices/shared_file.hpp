@@ -24,10 +24,15 @@
 ** Includes
 *****************************************************************************/
 
+#include <atomic>
 #include <map>
 #include <string>
+#include <vector>
 #include <ecl/exceptions/standard_exception.hpp>
+#include <ecl/threads/condition_variable.hpp>
 #include <ecl/threads/mutex.hpp>
+#include <ecl/threads/thread.hpp>
+#include "detail/byte_ring.hpp"
 #include "detail/character_buffer.hpp"
 #include "ofile.hpp"
 #include "traits.hpp"
@@ -63,7 +68,7 @@ namespace devices {
  */
 class SharedFileCommon {
 public:
-    SharedFileCommon() : error_handler(NoError) {};
+    SharedFileCommon() : count(0), registered(false), error_handler(NoError), writer(NULL), shutdown(false), sleeping(false) {};
 	/**
 	 * @brief Automatically opens a file and initialises the count.
 	 *
@@ -73,22 +78,56 @@ public:
 	 * @param mode : writing mode (either New or Append).
 	 */
     SharedFileCommon(const std::string &name, ecl::WriteMode mode);
-    virtual ~SharedFileCommon() {}
+    /**
+     * @brief Stops the background writer (if any) after it has drained everything.
+     */
+    virtual ~SharedFileCommon();
 
     friend class ecl::SharedFile;
     friend class SharedFileManager;
 
 private:
+    /*********************
+    ** Asynchronous Writes
+    **********************/
+    void attach(ByteRing *ring);
+    void detach(ByteRing *ring);
+    void notify();
+    void push_blocking(ByteRing *ring, const char *s, unsigned long n);
+    unsigned long drain();
+    void write_in_background();
+    /*********************
+    ** Errors
+    **********************/
+    Error error();
+    void error(const Error &error);
+
     unsigned int count;
-    ecl::Mutex mutex;
+    const bool registered; // with the manager, else a stand in for a file that failed to open
+    ecl::Mutex mutex; // guards the rings, the file, its error and the background writer
     OFile file;
 	Error error_handler;
+	std::vector<ByteRing*> rings;
+	std::vector<char> batch;
+	ecl::ConditionVariable condition; // wakes the writer
+	ecl::ConditionVariable space; // wakes instances blocked on a full ring
+	ecl::Thread *writer;
+	bool shutdown;
+	std::atomic<bool> sleeping; // the writer is about to wait on the condition
 };
 
 class SharedFileManager {
 public:
 	static SharedFileCommon* RegisterSharedFile(const std::string &name, ecl::WriteMode mode = New);
 	static bool DeRegisterSharedFile(const std::string &name);
+	/**
+	 * @brief Writes out everything waiting in the asynchronous buffers.
+	 *
+	 * Registered with atexit() when the first file switches to asynchronous
+	 * writes so that nothing already handed to a background writer is lost
+	 * when the program exits.
+	 */
+	static void FlushAll();
 private:
 	static ecl::Mutex mutex;
 	static std::map<std::string,SharedFileCommon*> opened_files;
@@ -113,6 +152,26 @@ private:
  * this file). Everything else happens under the hood and cleanup occurs in the
  * destructors.
  *
+ * <b>Asynchronous Writes:</b>
+ *
+ * By default flushing writes to the file on the calling thread. After calling
+ * enableAsynchronousWrites(), flushing instead copies the instance's buffer
+ * into a lock-free ring owned by that instance (i.e. by the thread using it)
+ * and a background writer thread batches the rings of all instances sharing
+ * the file into large writes. Memory is bounded by the ring size - if a
+ * ring fills up, the overflow policy decides whether the data is dropped
+ * (counted, see dropped()) or the caller waits for the writer.
+ *
+ * @code
+ * SharedFile file("control.log");
+ * file.enableAsynchronousWrites(64*1024, DropOnOverflow);
+ * file.write("tick\n", 5);
+ * file.flush(); // doesn't touch the disk
+ * @endcode
+ *
+ * Everything flushed is guaranteed to reach the file when the instance is
+ * destroyed (which also flushes its remaining buffer) or the program exits.
+ *
  * @sa OFile.
  */
 class ecl_devices_PUBLIC SharedFile {
@@ -127,7 +186,7 @@ public:
 	 * constructors. Use this with the open() command to do so. You can
 	 * check for open status via the open accessor.
 	 */
-	SharedFile() {};
+	SharedFile() : shared_instance(NULL), ring(NULL), overflow_policy(DropOnOverflow), dropped_flushes(0) {};
 	/**
 	 * @brief Either opens a file for writing or a link to an existing shared instance.
 	 *
@@ -217,21 +276,69 @@ public:
 	 * @sa OFile
 	 **/
 	long write(const char* s, unsigned long n);
+	/**
+	 * @brief Write a character string as a whole, never split across two flushes.
+	 *
+	 * If the string doesn't fit in what's left of the buffer, the buffer is
+	 * flushed first. The string then reaches the file (or is dropped) in one
+	 * piece, never interleaved with the flushes of other instances sharing
+	 * the file. Used for records that must stay intact, e.g. binary log records.
+	 *
+	 * @param s : points to the beginning of the character string.
+	 * @param n : the number of characters to write (at most the buffer size, 4096).
+	 * @return long: the number of bytes written, -1 if the string is too large.
+	 *
+	 * @exception StandardException : throws from the underlying file if flushing returned an error [debug mode only].
+	 **/
+	long writeRecord(const char* s, unsigned long n);
 	/**
 	 * @brief Flush the internal buffer.
 	 *
 	 * This writes to the shared file. Error handling the same for OFile's write function.
+	 * In asynchronous mode it only pushes the buffer onto this instance's
+	 * ring, returning false if it was dropped.
 	 *
 	 * @exception StandardException : throws from the underlying file if flushing returned an error [debug mode only].
 	 * @sa OFile
 	 **/
 	bool flush();
 
-	const Error& error() const { return shared_instance->error_handler; }
+	/*********************
+	** Asynchronous Writes
+	**********************/
+	/**
+	 * @brief Hand flushes to a background writer instead of writing directly.
+	 *
+	 * The background writer is shared by all instances of the file and
+	 * started with the first instance that enables asynchronous writes.
+	 *
+	 * @param buffer_size : size of this instance's ring (at least two flushes worth).
+	 * @param policy : drop or block when the ring is full.
+	 * @return bool : false if the file is not open.
+	 */
+	bool enableAsynchronousWrites(const unsigned long &buffer_size = 64*1024, const OverflowPolicy &policy = DropOnOverflow);
+	/**
+	 * @brief Whether flushes are handed to the background writer.
+	 */
+	bool asynchronous() const { return ( ring != NULL ); }
+	/**
+	 * @brief Number of flushes discarded because the ring was full.
+	 *
+	 * @return unsigned long : dropped flushes (asynchronous mode, DropOnOverflow only).
+	 */
+	unsigned long dropped() const { return dropped_flushes; }
+
+	/**
+	 * @brief The last error on the shared file (also from the background writer).
+	 */
+	Error error() const { return shared_instance->error(); }
 
 private:
 	devices::SharedFileCommon* shared_instance;
 	devices::CharBuffer buffer;
+	devices::ByteRing *ring;
+	OverflowPolicy overflow_policy;
+	unsigned long dropped_flushes;
 };
 
 /*****************************************************************************
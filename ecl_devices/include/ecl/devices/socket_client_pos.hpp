@@ -32,6 +32,7 @@
 #include <string>
 #include <sys/ioctl.h> // used in remaining()
 #include <sys/socket.h>
+#include <sys/uio.h> // iovec
 #include <ecl/exceptions/macros.hpp>
 #include <ecl/exceptions/standard_exception.hpp>
 #include "socket_connection_status.hpp"
@@ -100,6 +101,51 @@ public:
 
 	bool open() const { return is_open; }
 
+	/*********************
+	** Socket Options
+	**********************/
+	/**
+	 * @brief Switch to blocking reads and writes (the default).
+	 *
+	 * @return bool : false if the mode could not be changed.
+	 */
+	bool block();
+	/**
+	 * @brief Switch to non-blocking reads and writes.
+	 *
+	 * Reads and writes that would block return 0 instead of waiting
+	 * (writes may also be partial). Pair with a devices::Reactor to
+	 * find out when to try again.
+	 *
+	 * @return bool : false if the mode could not be changed.
+	 */
+	bool unblock();
+	/**
+	 * @brief Disable/enable Nagle's algorithm (TCP_NODELAY).
+	 *
+	 * Enable for small, latency sensitive messages so they are not held
+	 * back waiting to be coalesced.
+	 */
+	bool setNoDelay(const bool &enable);
+	/**
+	 * @brief Cork/uncork the connection (TCP_CORK) [linux only].
+	 *
+	 * While corked, only full frames are sent. Uncorking flushes what is queued.
+	 */
+	bool setCork(const bool &enable);
+	/**
+	 * @brief Set the kernel send buffer size in bytes (SO_SNDBUF).
+	 */
+	bool setSendBufferSize(const int &bytes);
+	/**
+	 * @brief Set the kernel receive buffer size in bytes (SO_RCVBUF).
+	 */
+	bool setReceiveBufferSize(const int &bytes);
+	/**
+	 * @brief Allow zero copy sends via writeZeroCopy() (SO_ZEROCOPY) [linux only].
+	 */
+	bool setZeroCopy(const bool &enable);
+
 	/*********************
 	** Writing
 	**********************/
@@ -122,6 +168,40 @@ public:
 	 * @exception StandardException : throws if writing returned an error [debug mode only].
 	 **/
 	long write(const char *s, unsigned long n);
+	/**
+	 * @brief Gather several buffers into a single send (e.g. header + payload).
+	 *
+	 * Saves both the copy into a temporary buffer and the extra syscall
+	 * per buffer.
+	 *
+	 * @param buffers : the buffers to send, in order.
+	 * @param count : the number of buffers.
+	 * @return long : bytes written (0 if it would block) or a ConnectionStatus.
+	 * @exception StandardException : throws if writing returned an error [debug mode only].
+	 **/
+	long write(const iovec *buffers, const unsigned int &count);
+	/**
+	 * @brief Send a buffer without copying it into the kernel (MSG_ZEROCOPY) [linux only].
+	 *
+	 * Requires setZeroCopy(true). The pages are pinned and handed to the
+	 * network stack, so the buffer must not be modified or freed until
+	 * zeroCopyCompletions() has accounted for this send. Only pays off for
+	 * large (tens of kilobytes) payloads, and falls back to copying
+	 * silently on loopback.
+	 *
+	 * @param s : points to the beginning of the buffer.
+	 * @param n : the number of bytes to write.
+	 * @return long : bytes written (0 if it would block) or a ConnectionStatus.
+	 * @exception StandardException : throws if writing returned an error [debug mode only].
+	 **/
+	long writeZeroCopy(const char *s, const unsigned long &n);
+	/**
+	 * @brief Number of zero copy sends that completed since the last call.
+	 *
+	 * Sends complete in order, so after k completions the buffers of the
+	 * first k writeZeroCopy() calls can be reused.
+	 */
+	unsigned long zeroCopyCompletions();
 
 	/**
 	 * @brief Maybe all that is needed is a dummy flush (not sure).
@@ -184,11 +264,37 @@ public:
 	 * @exception StandardException : throws if reading returned an error [debug mode only].
      **/
     long peek(char*s, const unsigned long &n);
+    /**
+     * @brief Scatter the incoming data across several buffers.
+     *
+     * Like read(), returns as soon as something has arrived.
+     *
+     * @param buffers : the buffers to fill, in order.
+     * @param count : the number of buffers.
+     * @return long : bytes read (0 if it would block) or a ConnectionStatus.
+     * @exception StandardException : throws if reading returned an error [debug mode only].
+     **/
+    long read(iovec *buffers, const unsigned int &count);
+    /**
+     * @brief Wait until all n bytes have arrived (MSG_WAITALL).
+     *
+     * In non-blocking mode this behaves like read().
+     *
+     * @param s : character string to read into from the buffer.
+     * @param n : the number of bytes to read.
+     * @return long : bytes read or a ConnectionStatus.
+     * @exception StandardException : throws if reading returned an error [debug mode only].
+     **/
+    long read_exactly(char *s, const unsigned long &n);
 
 	/**
 	 * @brief Reports on the error state of the last operation.
 	 */
 	const Error& error() const { return error_handler; }
+	/**
+	 * @brief The connection's socket descriptor (e.g. for registering with a devices::Reactor).
+	 */
+	int fileDescriptor() const { return socket_fd; }
 
 private:
     std::string hostname;
@@ -196,6 +302,10 @@ private:
     int socket_fd;
     bool is_open;
     ecl::Error error_handler;
+
+    long send_message(const iovec *buffers, const unsigned int &count, const int &flags);
+    long receive_message(iovec *buffers, const unsigned int &count, const int &flags);
+    bool configure(const bool &result);
 };
 
 /*****************************************************************************
@@ -0,0 +1,328 @@
+/**
+ * @file /src/lib/reactor.cpp
+ *
+ * @brief Implementation for the epoll device reactor.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#include <ecl/config/ecl.hpp>
+#if defined(ECL_IS_POSIX) && defined(__linux__)
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <errno.h>
+#include <stdint.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <ecl/exceptions/standard_exception.hpp>
+#include "../../include/ecl/devices/reactor.hpp"
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+namespace devices {
+
+/*****************************************************************************
+** Registration
+*****************************************************************************/
+
+struct Reactor::Registration {
+	Registration(const int &file_descriptor, ReadCallback *callback, const unsigned long &buffer_size, const unsigned int &serial) :
+		file_descriptor(file_descriptor),
+		serial(serial),
+		buffer(buffer_size),
+		read_callback(callback),
+		write_callback(NULL),
+		busy(false),
+		cancelled(false),
+		removed(false)
+	{}
+	~Registration() {
+		delete read_callback;
+		delete write_callback;
+	}
+	int file_descriptor;
+	unsigned int serial; // tags its epoll events, the descriptor's number may be reused
+	std::vector<char> buffer;
+	ReadCallback *read_callback;
+	WriteCallback *write_callback;
+	bool busy;      // a reactor thread is dispatching it (the descriptor is disarmed)
+	bool cancelled; // unregistered, the dispatching thread mustn't touch the descriptor again
+	bool removed;   // removed while busy, the dispatching thread cleans up
+};
+
+namespace {
+
+/**
+ * The reactor whose threads this thread is, if any. Removals made from
+ * its callbacks can't wait for dispatches to finish.
+ */
+thread_local const Reactor *reactor_thread = NULL;
+
+} // namespace
+
+/**
+ * Epoll event data for a registration, the wakeup descriptor uses serial 0.
+ */
+static uint64_t event_key(const int &file_descriptor, const unsigned int &serial) {
+	return ( static_cast<uint64_t>(serial) << 32 ) | static_cast<uint32_t>(file_descriptor);
+}
+
+/*****************************************************************************
+** Implementation [Reactor][C&D]
+*****************************************************************************/
+
+Reactor::Reactor(const unsigned int &number_of_threads, const Priority &priority) :
+	epoll_fd(-1),
+	wakeup_fd(-1),
+	serials(0)
+{
+	epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+	wakeup_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if ( ( epoll_fd == -1 ) || ( wakeup_fd == -1 ) ) {
+		ecl_debug_throw(StandardException(LOC, OpenError, "Could not create the reactor's epoll set."));
+		return;
+	}
+	// level triggered and never rearmed, so it wakes every thread on shutdown
+	epoll_event event;
+	event.events = EPOLLIN;
+	event.data.u64 = event_key(wakeup_fd, 0);
+	epoll_ctl(epoll_fd, EPOLL_CTL_ADD, wakeup_fd, &event);
+	for ( unsigned int i = 0; i < number_of_threads; ++i ) {
+		threads.push_back(new Thread(&Reactor::spin, *this, priority));
+	}
+}
+
+Reactor::~Reactor() {
+	if ( wakeup_fd != -1 ) {
+		uint64_t one = 1;
+		ssize_t result = ::write(wakeup_fd, &one, sizeof(one));
+		(void) result;
+	}
+	for ( unsigned int i = 0; i < threads.size(); ++i ) {
+		threads[i]->join();
+		delete threads[i];
+	}
+	for ( std::map<int, Registration*>::iterator iter = registrations.begin(); iter != registrations.end(); ++iter ) {
+		delete iter->second;
+	}
+	if ( wakeup_fd != -1 ) { ::close(wakeup_fd); }
+	if ( epoll_fd != -1 ) { ::close(epoll_fd); }
+}
+
+/*****************************************************************************
+** Implementation [Reactor][Registration]
+*****************************************************************************/
+
+bool Reactor::add(const int &file_descriptor, ReadCallback *callback, const unsigned long &buffer_size) {
+	mutex.lock();
+	if ( ( file_descriptor < 0 ) || ( registrations.find(file_descriptor) != registrations.end() ) ) {
+		mutex.unlock();
+		delete callback;
+		return false;
+	}
+	if ( ++serials == 0 ) {
+		++serials;
+	}
+	Registration *registration = new Registration(file_descriptor, callback, buffer_size, serials);
+	epoll_event event;
+	event.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+	event.data.u64 = event_key(file_descriptor, serials);
+	if ( epoll_ctl(epoll_fd, EPOLL_CTL_ADD, file_descriptor, &event) == -1 ) {
+		mutex.unlock();
+		delete registration;
+		ecl_debug_throw(StandardException(LOC, InvalidInputError, "Could not add the file descriptor to the reactor (not pollable?)."));
+		return false;
+	}
+	registrations[file_descriptor] = registration;
+	mutex.unlock();
+	return true;
+}
+
+bool Reactor::remove(const int &file_descriptor) {
+	mutex.lock();
+	std::map<int, Registration*>::iterator iter = registrations.find(file_descriptor);
+	if ( iter == registrations.end() ) {
+		mutex.unlock();
+		return false;
+	}
+	Registration *registration = iter->second;
+	registrations.erase(iter);
+	epoll_ctl(epoll_fd, EPOLL_CTL_DEL, file_descriptor, NULL);
+	registration->cancelled = true;
+	if ( reactor_thread != this ) {
+		// let a dispatch finish, so the caller may close the descriptor straight away
+		while ( registration->busy ) {
+			idle.wait(mutex);
+		}
+	} else if ( registration->busy ) {
+		registration->removed = true; // from a callback, the dispatching thread cleans up
+		registration = NULL;
+	}
+	mutex.unlock();
+	delete registration;
+	return true;
+}
+
+bool Reactor::notifyWritable(const int &file_descriptor, WriteCallback *callback) {
+	mutex.lock();
+	std::map<int, Registration*>::iterator iter = registrations.find(file_descriptor);
+	if ( iter == registrations.end() ) {
+		mutex.unlock();
+		delete callback;
+		return false;
+	}
+	Registration *registration = iter->second;
+	delete registration->write_callback;
+	registration->write_callback = callback;
+	if ( !registration->busy ) {
+		rearm(registration); // otherwise the dispatching thread rearms it
+	}
+	mutex.unlock();
+	return true;
+}
+
+unsigned int Reactor::size() const {
+	mutex.lock();
+	unsigned int n = registrations.size();
+	mutex.unlock();
+	return n;
+}
+
+/*****************************************************************************
+** Implementation [Reactor][Dispatching]
+*****************************************************************************/
+
+void Reactor::spin() {
+	reactor_thread = this;
+	const int max_events = 16;
+	epoll_event events[max_events];
+	for (;;) {
+		int n = epoll_wait(epoll_fd, events, max_events, -1);
+		if ( n < 0 ) {
+			if ( errno == EINTR ) {
+				continue;
+			}
+			return;
+		}
+		for ( int i = 0; i < n; ++i ) {
+			const unsigned int serial = static_cast<unsigned int>(events[i].data.u64 >> 32);
+			if ( serial == 0 ) {
+				return; // wakeup
+			}
+			dispatch(static_cast<int>(events[i].data.u64 & 0xffffffff), serial, events[i].events);
+		}
+	}
+}
+
+void Reactor::dispatch(const int &file_descriptor, const unsigned int &serial, const unsigned int &events) {
+	/*********************
+	** Claim
+	**********************/
+	mutex.lock();
+	std::map<int, Registration*>::iterator iter = registrations.find(file_descriptor);
+	if ( ( iter == registrations.end() ) || ( iter->second->serial != serial ) ) {
+		mutex.unlock();
+		return; // removed after epoll_wait returned (its number may already be reused)
+	}
+	Registration *registration = iter->second;
+	registration->busy = true;
+	WriteCallback *write_callback = NULL;
+	if ( events & EPOLLOUT ) {
+		write_callback = registration->write_callback;
+		registration->write_callback = NULL;
+	}
+	mutex.unlock();
+
+	/*********************
+	** Callbacks
+	**********************/
+	if ( write_callback != NULL ) {
+		(*write_callback)();
+		delete write_callback;
+	}
+	mutex.lock();
+	const bool cancelled = registration->cancelled; // by a callback, the descriptor may already be closed or reused
+	mutex.unlock();
+	if ( cancelled ) {
+		release(registration);
+		return;
+	}
+	bool closed = false;
+	if ( events & EPOLLIN ) {
+		ssize_t n = ::read(file_descriptor, &registration->buffer[0], registration->buffer.size());
+		if ( n > 0 ) {
+			(*registration->read_callback)(&registration->buffer[0], n);
+		} else if ( n < 0 ) {
+			closed = ( errno != EAGAIN ) && ( errno != EINTR );
+		} else {
+			// ttys in non-canonical mode return 0 for 'no data', only trust the hangup flags
+			closed = ( events & (EPOLLHUP | EPOLLRDHUP | EPOLLERR) );
+		}
+	} else if ( events & (EPOLLHUP | EPOLLRDHUP | EPOLLERR) ) {
+		closed = true;
+	}
+	if ( closed && retire(registration) ) {
+		(*registration->read_callback)(&registration->buffer[0], 0);
+	}
+	release(registration);
+}
+
+/**
+ * Removes this registration (not whatever is registered under its
+ * descriptor's number now - a callback may have removed it and registered
+ * a new descriptor that reuses the number). The registration must be busy,
+ * release() deletes it.
+ */
+bool Reactor::retire(Registration *registration) {
+	mutex.lock();
+	std::map<int, Registration*>::iterator iter = registrations.find(registration->file_descriptor);
+	if ( ( iter == registrations.end() ) || ( iter->second != registration ) ) {
+		mutex.unlock();
+		return false; // already removed
+	}
+	registrations.erase(iter);
+	epoll_ctl(epoll_fd, EPOLL_CTL_DEL, registration->file_descriptor, NULL);
+	registration->cancelled = true;
+	registration->removed = true;
+	mutex.unlock();
+	return true;
+}
+
+void Reactor::release(Registration *registration) {
+	mutex.lock();
+	registration->busy = false;
+	if ( !registration->removed ) {
+		if ( !registration->cancelled ) {
+			rearm(registration);
+		}
+		registration = NULL; // still registered, or a remove() waiting for it deletes it
+	}
+	idle.notify_all();
+	mutex.unlock();
+	delete registration;
+}
+
+bool Reactor::rearm(Registration *registration) {
+	epoll_event event;
+	event.events = EPOLLIN | EPOLLRDHUP | EPOLLONESHOT;
+	if ( registration->write_callback != NULL ) {
+		event.events |= EPOLLOUT;
+	}
+	event.data.u64 = event_key(registration->file_descriptor, registration->serial);
+	return ( epoll_ctl(epoll_fd, EPOLL_CTL_MOD, registration->file_descriptor, &event) == 0 );
+}
+
+} // namespace devices
+} // namespace ecl
+
+#endif /* ECL_IS_POSIX && __linux__ */
@@ -19,9 +19,11 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <poll.h>
 #include <sys/ioctl.h>
 #include <termios.h>
-#include <cstdlib> // div
+#include <cstring> // memcpy, memchr
+#include <ctime> // clock_gettime
 #include <unistd.h> // access
 #include <ecl/exceptions/standard_exception.hpp>
 #include <ecl/exceptions/macros.hpp>
@@ -68,7 +70,7 @@ using ecl::StandardException;
 
 Serial::Serial(const std::string& port_name, const BaudRate &baud_rate, const DataBits &data_bits,
                const StopBits &stop_bits, const Parity &parity) :
-    port(port_name), read_timeout_ms(5000), error_handler(NoError)
+    port(port_name), read_timeout_ms(5000), read_ahead_begin(0), read_ahead_end(0), is_open(false), error_handler(NoError)
 {
   ecl_try
   {
@@ -283,6 +285,7 @@ void Serial::close()
     // should check return values here, it does have some, EBADF/EINTR/EIO
     ::close(file_descriptor);
     is_open = false;
+    read_ahead_begin = read_ahead_end = 0;
   }
 }
 
@@ -302,55 +305,10 @@ bool Serial::open()
 
 void Serial::block(const unsigned long &timeout)
 {
-  if (timeout < 100)
-  {
-    if (timeout < 5)
-    {
-      fake_snooze.period(ecl::Duration(0.001));
-      fake_loop_count = timeout;
-    }
-    else if (timeout < 20)
-    {
-      fake_snooze.period(ecl::Duration(0.002));
-      div_t d = div(timeout, 2);
-      if (d.rem == 0)
-      {
-        fake_loop_count = d.quot;
-      }
-      else
-      {
-        fake_loop_count = d.quot + 1;
-      }
-    }
-    else
-    {
-      fake_snooze.period(ecl::Duration(0.005));
-      div_t d = div(timeout, 5);
-      if (d.rem == 0)
-      {
-        fake_loop_count = d.quot;
-      }
-      else
-      {
-        fake_loop_count = d.quot + 1;
-      }
-    }
-    this->unblock();
-  }
-  else
-  {
-    options.c_cc[VMIN] = 0;
-    // VTIME is in tenths of a second
-    if (timeout < 100)
-    { // just in case we're not running in debug mode or exceptions are disabled.
-      options.c_cc[VTIME] = static_cast<unsigned char>(1); // 100/100
-    }
-    else
-    {
-      options.c_cc[VTIME] = static_cast<unsigned char>(timeout / 100);
-    }
-    tcsetattr(file_descriptor, TCSAFLUSH, &options);
-  }
+  // termios itself never blocks, the timeout is handled by poll() when reading
+  options.c_cc[VMIN] = 0;
+  options.c_cc[VTIME] = 0;
+  tcsetattr(file_descriptor, TCSAFLUSH, &options);
   read_timeout_ms = timeout;
 }
 
@@ -369,7 +327,146 @@ long Serial::remaining()
 {
   long bytes = 0;
   ioctl(file_descriptor, FIONREAD, &bytes);
-  return bytes;
+  return bytes + (read_ahead_end - read_ahead_begin);
+}
+
+/**
+ * Monotonic clock in milliseconds, used for the read deadlines.
+ */
+static long monotonic_ms()
+{
+  timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec * 1000L + now.tv_nsec / 1000000L;
+}
+
+long Serial::read_chunk(unsigned char *bytes, const unsigned long &n, const long &timeout_ms)
+{
+  if ( timeout_ms > 0 )
+  {
+    pollfd descriptor;
+    descriptor.fd = file_descriptor;
+    descriptor.events = POLLIN;
+    descriptor.revents = 0;
+    int result = ::poll(&descriptor, 1, timeout_ms);
+    if ( result == 0 )
+    {
+      return 0; // timed out
+    }
+    if ( result < 0 )
+    {
+      return ( errno == EINTR ) ? 0 : -1;
+    }
+    if ( descriptor.revents & ( POLLERR | POLLNVAL ) )
+    {
+      errno = ( descriptor.revents & POLLNVAL ) ? EBADF : EIO;
+      return -1;
+    }
+  }
+  ssize_t no_read = ::read(file_descriptor, bytes, n);
+  if ( ( no_read < 0 ) && ( errno == EAGAIN || errno == EINTR ) )
+  {
+    return 0;
+  }
+  if ( ( no_read == 0 ) && ( timeout_ms > 0 ) )
+  {
+    // poll reported the device ready (e.g. POLLHUP) but there is nothing
+    // to read, so it has hung up - retrying would only spin until the timeout.
+    errno = EIO;
+    return -1;
+  }
+  return no_read;
+}
+
+long Serial::read_bytes(unsigned char *bytes, const unsigned long &n, const bool &fill, const int &delimiter)
+{
+  if ( !is_open )  // internal check only, don't worry about doing the full device filename check here (we need speed)
+  {
+    ecl_debug_throw( StandardException(LOC, OpenError, std::string("Port ") + port + std::string(" is not open.")));
+    error_handler = OpenError;
+    return -1;
+  }
+  if ( n == 0 )
+  {
+    error_handler = NoError;
+    return 0;
+  }
+  unsigned long count = 0;
+  /*********************
+   ** Read Ahead
+   **********************/
+  if ( read_ahead_begin != read_ahead_end )
+  {
+    unsigned long available = read_ahead_end - read_ahead_begin;
+    count = ( available < n ) ? available : n;
+    if ( delimiter >= 0 )
+    {
+      const void *found = memchr(read_ahead + read_ahead_begin, delimiter, count);
+      if ( found != NULL )
+      {
+        count = static_cast<const unsigned char*>(found) - (read_ahead + read_ahead_begin) + 1;
+      }
+    }
+    memcpy(bytes, read_ahead + read_ahead_begin, count);
+    read_ahead_begin += count;
+    if ( read_ahead_begin == read_ahead_end )
+    {
+      read_ahead_begin = read_ahead_end = 0;
+    }
+    if ( ( delimiter >= 0 ) && ( bytes[count - 1] == delimiter ) )
+    {
+      error_handler = NoError;
+      return count;
+    }
+  }
+  /*********************
+   ** Device
+   **********************/
+  const long deadline = monotonic_ms() + ( ( read_timeout_ms == NonBlocking ) ? 0 : read_timeout_ms );
+  while ( count < n )
+  {
+    if ( !fill && ( count > 0 ) )
+    {
+      break;
+    }
+    long timeout_ms = deadline - monotonic_ms();
+    unsigned long chunk = n - count;
+    if ( ( delimiter >= 0 ) && ( chunk > ReadAheadSize ) )
+    {
+      chunk = ReadAheadSize; // anything past the delimiter has to fit in the read ahead buffer
+    }
+    long no_read = read_chunk(bytes + count, chunk, timeout_ms);
+    if ( no_read < 0 )
+    {
+      ecl_debug_throw(devices::read_exception(LOC));
+      error_handler = devices::read_error();
+      return -1;
+    }
+    if ( no_read == 0 )
+    {
+      if ( timeout_ms <= 0 )
+      {
+        break;
+      }
+      continue;
+    }
+    if ( delimiter >= 0 )
+    {
+      const void *found = memchr(bytes + count, delimiter, no_read);
+      if ( found != NULL )
+      {
+        unsigned long end = static_cast<const unsigned char*>(found) - bytes + 1;
+        read_ahead_begin = 0;
+        read_ahead_end = count + no_read - end;
+        memcpy(read_ahead, bytes + end, read_ahead_end);
+        count = end;
+        break;
+      }
+    }
+    count += no_read;
+  }
+  error_handler = NoError;
+  return count;
 }
 
 } // namespace ecl
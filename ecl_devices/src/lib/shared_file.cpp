@@ -16,6 +16,8 @@
 ** Includes
 *****************************************************************************/
 
+#include <atomic>
+#include <cstdlib>
 #include <iostream>
 #include <map>
 #include <string>
@@ -40,6 +42,7 @@ using ecl::WriteMode;
 using ecl::CloseError;
 using ecl::StandardException;
 using ecl::Mutex;
+using ecl::Thread;
 
 /*****************************************************************************
 ** Implementation [SharedFileCommon]
@@ -47,7 +50,11 @@ using ecl::Mutex;
 
 SharedFileCommon::SharedFileCommon(const std::string &name, ecl::WriteMode mode) :
 	count(1),
-	error_handler(NoError)
+	registered(true),
+	error_handler(NoError),
+	writer(NULL),
+	shutdown(false),
+	sleeping(false)
 {
 	ecl_try {
 		if ( !file.open(name,mode) ) {
@@ -59,6 +66,132 @@ SharedFileCommon::SharedFileCommon(const std::string &name, ecl::WriteMode mode)
 	}
 }
 
+SharedFileCommon::~SharedFileCommon() {
+	if ( writer != NULL ) {
+		mutex.lock();
+		shutdown = true;
+		condition.notify_one();
+		mutex.unlock();
+		writer->join(); // drains before it exits
+		delete writer;
+	}
+}
+
+/*****************************************************************************
+** Implementation [SharedFileCommon][Asynchronous Writes]
+*****************************************************************************/
+
+void SharedFileCommon::attach(ByteRing *ring) {
+	mutex.lock();
+	rings.push_back(ring);
+	if ( writer == NULL ) {
+		batch.resize(64*1024);
+		writer = new Thread(&SharedFileCommon::write_in_background, *this);
+	}
+	mutex.unlock();
+}
+
+void SharedFileCommon::detach(ByteRing *ring) {
+	mutex.lock();
+	drain();
+	for ( std::vector<ByteRing*>::iterator iter = rings.begin(); iter != rings.end(); ++iter ) {
+		if ( *iter == ring ) {
+			rings.erase(iter);
+			break;
+		}
+	}
+	mutex.unlock();
+}
+
+/**
+ * Called after pushing onto a ring. Only takes the lock when the writer
+ * has announced that it is going to sleep (see write_in_background()).
+ */
+void SharedFileCommon::notify() {
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if ( sleeping.load(std::memory_order_relaxed) ) {
+		mutex.lock();
+		condition.notify_one();
+		mutex.unlock();
+	}
+}
+
+/**
+ * Pops only ever happen with the mutex locked, so a push that fails here
+ * can't miss the space being freed before it waits.
+ */
+void SharedFileCommon::push_blocking(ByteRing *ring, const char *s, unsigned long n) {
+	mutex.lock();
+	while ( !ring->push(s, n) ) {
+		condition.notify_one();
+		space.wait(mutex);
+	}
+	mutex.unlock();
+}
+
+Error SharedFileCommon::error() {
+	mutex.lock();
+	Error error = error_handler;
+	mutex.unlock();
+	return error;
+}
+
+void SharedFileCommon::error(const Error &error) {
+	mutex.lock();
+	error_handler = error;
+	mutex.unlock();
+}
+
+/**
+ * Only ever called with the mutex locked, which also makes it the single
+ * consumer of every ring.
+ */
+unsigned long SharedFileCommon::drain() {
+	unsigned long total = 0;
+	for (;;) {
+		unsigned long n = 0;
+		for ( unsigned int i = 0; ( i < rings.size() ) && ( n < batch.size() ); ++i ) {
+			n += rings[i]->pop(&batch[n], batch.size() - n);
+		}
+		if ( n == 0 ) {
+			break;
+		}
+		ecl_try {
+			file.write(&batch[0], n);
+			error_handler = file.error();
+		} ecl_catch( StandardException &e ) {
+			// nowhere to report it from the background, it's in the error handler
+			error_handler = WriteError; // the file throws before setting its own
+		}
+		total += n;
+	}
+	if ( total > 0 ) {
+		ecl_try {
+			file.flush();
+		} ecl_catch( StandardException &e ) {}
+		space.notify_all();
+	}
+	return total;
+}
+
+void SharedFileCommon::write_in_background() {
+	mutex.lock();
+	while ( !shutdown ) {
+		if ( drain() == 0 ) {
+			// announce the sleep before taking a last look at the rings - a
+			// concurrent push is then either drained here or sees the flag and notifies
+			sleeping.store(true, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if ( ( drain() == 0 ) && !shutdown ) {
+				condition.wait(mutex);
+			}
+			sleeping.store(false, std::memory_order_relaxed);
+		}
+	}
+	drain();
+	mutex.unlock();
+}
+
 /*****************************************************************************
 ** Static Variable Initialisation [SharedFileManager]
 *****************************************************************************/
@@ -120,6 +253,16 @@ bool SharedFileManager::DeRegisterSharedFile(const std::string& name) {
     return true;
 }
 
+void SharedFileManager::FlushAll() {
+	mutex.lock();
+	for ( std::map<std::string,SharedFileCommon*>::iterator iter = opened_files.begin(); iter != opened_files.end(); ++iter ) {
+		iter->second->mutex.lock();
+		iter->second->drain();
+		iter->second->mutex.unlock();
+	}
+	mutex.unlock();
+}
+
 } // namespace devices
 
 /*****************************************************************************
@@ -133,7 +276,10 @@ using std::string;
 *****************************************************************************/
 
 SharedFile::SharedFile(const std::string &name, WriteMode mode) :
-	shared_instance(NULL)
+	shared_instance(NULL),
+	ring(NULL),
+	overflow_policy(DropOnOverflow),
+	dropped_flushes(0)
 {
 	ecl_try {
 		open(name,mode);
@@ -144,11 +290,19 @@ SharedFile::SharedFile(const std::string &name, WriteMode mode) :
 
 SharedFile::~SharedFile() {
 	ecl_try {
-	        if (shared_instance->error_handler.flag() == NoError) {
-	            devices::SharedFileManager::DeRegisterSharedFile( shared_instance->file.filename() );
-	        } else {
-	            delete shared_instance;
-	        }
+		if ( ring != NULL ) {
+			// nothing gets left behind, regardless of the overflow policy
+			overflow_policy = BlockOnOverflow;
+			flush();
+			shared_instance->detach(ring);
+			delete ring;
+		}
+		if ( shared_instance->registered ) {
+			// other instances may still be using it, whatever its error
+			devices::SharedFileManager::DeRegisterSharedFile( shared_instance->file.filename() );
+		} else {
+			delete shared_instance;
+		}
 	} ecl_catch( StandardException &e ) {
 		// Never throw from a destructor!
 		// use some other mechanism!!!
@@ -164,7 +318,7 @@ bool SharedFile::open(const std::string &name, WriteMode mode) {
                         shared_instance->error_handler = OpenError;
 			return false;
 		} else {
-			shared_instance->error_handler = NoError;
+			shared_instance->error(NoError);
 			return true;
 		}
 	} ecl_catch ( StandardException &e ) {
@@ -197,17 +351,66 @@ long SharedFile::write(const char* s, unsigned long n) {
 	return n;
 }
 
+long SharedFile::writeRecord(const char* s, unsigned long n) {
+	if ( n > devices::CharBuffer::buffer_size ) {
+		return -1;
+	}
+	if ( n > buffer.remaining() ) {
+		flush(); // if this was dropped, it was dropped whole
+	}
+	buffer.append(s, n);
+	if ( buffer.full() ) {
+		flush();
+	}
+	return n;
+}
+
+bool SharedFile::enableAsynchronousWrites(const unsigned long &buffer_size, const OverflowPolicy &policy) {
+	if ( ( shared_instance == NULL ) || !open() ) {
+		return false;
+	}
+	overflow_policy = policy;
+	if ( ring == NULL ) {
+		const unsigned long minimum_size = 2*(devices::CharBuffer::buffer_size + devices::ByteRing::header_size);
+		ring = new devices::ByteRing( ( buffer_size < minimum_size ) ? minimum_size : buffer_size );
+		shared_instance->attach(ring);
+		static const int registered = std::atexit(devices::SharedFileManager::FlushAll);
+		(void) registered;
+	}
+	return true;
+}
+
 bool SharedFile::flush() {
+	if ( ring != NULL ) {
+		bool pushed = true;
+		if ( buffer.size() > 0 ) {
+			if ( ring->push(buffer.c_ptr(), buffer.size()) ) {
+				shared_instance->notify();
+			} else if ( overflow_policy == BlockOnOverflow ) {
+				shared_instance->push_blocking(ring, buffer.c_ptr(), buffer.size());
+			} else {
+				++dropped_flushes;
+				pushed = false;
+			}
+		}
+		buffer.clear();
+		return pushed;
+	}
 	long written;
+	// the background writer of other instances writes to the file and its error too
+	shared_instance->mutex.lock();
 	ecl_debug_try {
 		written = shared_instance->file.write(buffer.c_ptr(), buffer.size() );
 	} ecl_debug_catch(const StandardException &e) {
-		shared_instance->error_handler = shared_instance->file.error();
+		// the file throws before setting its own
+		shared_instance->error_handler = shared_instance->file.open() ? WriteError : OpenError;
+		shared_instance->mutex.unlock();
 		ecl_debug_throw(StandardException(LOC,e));
 	}
 	buffer.clear();
 	// fallback for no exceptions
 	shared_instance->error_handler = shared_instance->file.error();
+	shared_instance->mutex.unlock();
 	if ( written > 0 ) {
 		return true;
 	} else {
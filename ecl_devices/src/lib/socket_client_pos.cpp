@@ -24,6 +24,7 @@
 #include <ecl/exceptions/standard_exception.hpp>
 #include "../../include/ecl/devices/detail/socket_error_handler_pos.hpp"
 #include "../../include/ecl/devices/detail/socket_exception_handler_pos.hpp"
+#include "../../include/ecl/devices/detail/socket_options_pos.hpp"
 #include "../../include/ecl/devices/socket_connection_status.hpp"
 #include "../../include/ecl/devices/socket_client_pos.hpp"
 
@@ -137,19 +138,39 @@ long SocketClient::read(char &c) {
 }
 
 long SocketClient::read(char *s, const unsigned long &n) {
+    iovec buffer = { s, n };
+    return receive_message(&buffer, 1, 0);
+}
+
+long SocketClient::read(iovec *buffers, const unsigned int &count) {
+    return receive_message(buffers, count, 0);
+}
+
+long SocketClient::read_exactly(char *s, const unsigned long &n) {
+    iovec buffer = { s, n };
+    return receive_message(&buffer, 1, MSG_WAITALL);
+}
+
+long SocketClient::receive_message(iovec *buffers, const unsigned int &count, const int &flags) {
 
     if ( !open() ) {
     	return ConnectionDisconnected;
     }
 
-    /*********************
-     * Check Status
-     *********************/
-//    SocketStatus status = pollStatus(POLLIN); // Times out according to timeout_ms if it can't read in the specified time.
-//    std::cout << "Polling Status " << status << std::endl;
-//    if ( status != SocketReadReady ) { return status; } // else it is ok to write.
+    unsigned long length = 0;
+    for ( unsigned int i = 0; i < count; ++i ) {
+        length += buffers[i].iov_len;
+    }
+    if ( length == 0 ) {
+        // recvmsg would return 0, which can't be told apart from a hang up
+        error_handler = NoError;
+        return 0;
+    }
 
-    int bytes_read = ::recv(socket_fd, s, n, 0); // Consider using MSG_WAITALL
+    msghdr message = msghdr();
+    message.msg_iov = buffers;
+    message.msg_iovlen = count;
+    ssize_t bytes_read = ::recvmsg(socket_fd, &message, flags);
 
     /*********************
 	** Error Handling
@@ -163,6 +184,9 @@ long SocketClient::read(char *s, const unsigned long &n) {
     	if ( errno == ECONNRESET ) {
     		close();
     		return ConnectionHungUp;
+    	} else if ( ( errno == EAGAIN ) || ( errno == EWOULDBLOCK ) ) {
+    		error_handler = NoError;
+    		return 0; // non-blocking and nothing there yet
     	} else {
 			ecl_debug_throw( devices::receive_exception(LOC) );
 			error_handler = devices::receive_error();
@@ -211,13 +235,38 @@ long SocketClient::write(const char &c) {
 }
 
 long SocketClient::write(const char *s, unsigned long n) {
+	iovec buffer = { const_cast<char*>(s), n };
+	return send_message(&buffer, 1, 0);
+}
+
+long SocketClient::write(const iovec *buffers, const unsigned int &count) {
+	return send_message(buffers, count, 0);
+}
+
+long SocketClient::writeZeroCopy(const char *s, const unsigned long &n) {
+	#if defined(MSG_ZEROCOPY)
+	iovec buffer = { const_cast<char*>(s), n };
+	return send_message(&buffer, 1, MSG_ZEROCOPY);
+	#else
+	return write(s, n);
+	#endif
+}
+
+unsigned long SocketClient::zeroCopyCompletions() {
+	return devices::reap_zero_copy(socket_fd);
+}
+
+long SocketClient::send_message(const iovec *buffers, const unsigned int &count, const int &flags) {
 
 	if ( !open() ) { return ConnectionDisconnected; }
 
     /*********************
      * Write
      *********************/
-    int bytes_written = ::send(socket_fd,s,n,MSG_NOSIGNAL);
+    msghdr message = msghdr();
+    message.msg_iov = const_cast<iovec*>(buffers);
+    message.msg_iovlen = count;
+    ssize_t bytes_written = ::sendmsg(socket_fd, &message, flags|MSG_NOSIGNAL);
 
     if ( bytes_written < 0 ) {
         switch(errno) {
@@ -225,6 +274,10 @@ long SocketClient::write(const char *s, unsigned long n) {
                 close();
                 return ConnectionHungUp;
             }
+            case ( EAGAIN ) : {
+                error_handler = NoError;
+                return 0; // non-blocking and the send buffer is full
+            }
             default : {
         	    ecl_debug_throw( devices::send_exception(LOC) );
         	    error_handler = devices::send_error();
@@ -232,9 +285,59 @@ long SocketClient::write(const char *s, unsigned long n) {
             }
         }
     }
+    error_handler = NoError;
     return bytes_written;
 }
 
+/*****************************************************************************
+** Implementation [SocketClient][Socket Options]
+*****************************************************************************/
+
+bool SocketClient::block() {
+	return configure(devices::set_blocking(socket_fd, true));
+}
+
+bool SocketClient::unblock() {
+	return configure(devices::set_blocking(socket_fd, false));
+}
+
+bool SocketClient::setNoDelay(const bool &enable) {
+	return configure(devices::set_socket_option(socket_fd, IPPROTO_TCP, TCP_NODELAY, enable ? 1 : 0));
+}
+
+bool SocketClient::setCork(const bool &enable) {
+	#if defined(TCP_CORK)
+	return configure(devices::set_socket_option(socket_fd, IPPROTO_TCP, TCP_CORK, enable ? 1 : 0));
+	#else
+	(void) enable;
+	error_handler = NotSupportedError;
+	return false;
+	#endif
+}
+
+bool SocketClient::setSendBufferSize(const int &bytes) {
+	return configure(devices::set_socket_option(socket_fd, SOL_SOCKET, SO_SNDBUF, bytes));
+}
+
+bool SocketClient::setReceiveBufferSize(const int &bytes) {
+	return configure(devices::set_socket_option(socket_fd, SOL_SOCKET, SO_RCVBUF, bytes));
+}
+
+bool SocketClient::setZeroCopy(const bool &enable) {
+	#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+	return configure(devices::set_socket_option(socket_fd, SOL_SOCKET, SO_ZEROCOPY, enable ? 1 : 0));
+	#else
+	(void) enable;
+	error_handler = NotSupportedError;
+	return false;
+	#endif
+}
+
+bool SocketClient::configure(const bool &result) {
+	error_handler = result ? Error(NoError) : Error(ConfigurationError);
+	return result;
+}
+
 } // namespace ecl
 
 #endif /* ECL_IS_POSIX */
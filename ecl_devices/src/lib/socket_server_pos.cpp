@@ -20,6 +20,7 @@
 
 #include <unistd.h>
 #include <ecl/exceptions/standard_exception.hpp>
+#include "../../include/ecl/devices/detail/socket_options_pos.hpp"
 #include "../../include/ecl/devices/socket_connection_status.hpp"
 #include "../../include/ecl/devices/socket_server_pos.hpp"
 
@@ -35,6 +36,7 @@ namespace ecl {
 
 SocketServer::SocketServer(const unsigned int &port_number) :
 		port(port_number),
+		client_socket_fd(-1),
 		is_open(false),
 		error_handler(NoError)
 {
@@ -123,11 +125,42 @@ int SocketServer::listen() {
 *****************************************************************************/
 
 long SocketServer::read(char *s, const unsigned long &n) {
+    iovec buffer = { s, n };
+    return receive_message(&buffer, 1, 0);
+}
+
+long SocketServer::read(iovec *buffers, const unsigned int &count) {
+    return receive_message(buffers, count, 0);
+}
+
+long SocketServer::read_exactly(char *s, const unsigned long &n) {
+    iovec buffer = { s, n };
+    return receive_message(&buffer, 1, MSG_WAITALL);
+}
+
+long SocketServer::receive_message(iovec *buffers, const unsigned int &count, const int &flags) {
 
     if ( !open() ) { return ConnectionDisconnected; }
 
-    int bytes_read = ::recv(client_socket_fd, s, n, 0);
+    unsigned long length = 0;
+    for ( unsigned int i = 0; i < count; ++i ) {
+        length += buffers[i].iov_len;
+    }
+    if ( length == 0 ) {
+        // recvmsg would return 0, which can't be told apart from a hang up
+        error_handler = NoError;
+        return 0;
+    }
+
+    msghdr message = msghdr();
+    message.msg_iov = buffers;
+    message.msg_iovlen = count;
+    ssize_t bytes_read = ::recvmsg(client_socket_fd, &message, flags);
     if ( bytes_read < 0 ) {
+    	if ( ( errno == EAGAIN ) || ( errno == EWOULDBLOCK ) ) {
+    		error_handler = NoError;
+    		return 0; // non-blocking and nothing there yet
+    	}
     	ecl_debug_throw(devices::receive_exception(LOC));
     	error_handler = devices::receive_error();
     	return ConnectionProblem;
@@ -172,10 +205,35 @@ long SocketServer::remaining() {
 *****************************************************************************/
 
 long SocketServer::write(const char *s, unsigned long n) {
+    iovec buffer = { const_cast<char*>(s), n };
+    return send_message(&buffer, 1, 0);
+}
+
+long SocketServer::write(const iovec *buffers, const unsigned int &count) {
+    return send_message(buffers, count, 0);
+}
+
+long SocketServer::writeZeroCopy(const char *s, const unsigned long &n) {
+    #if defined(MSG_ZEROCOPY)
+    iovec buffer = { const_cast<char*>(s), n };
+    return send_message(&buffer, 1, MSG_ZEROCOPY);
+    #else
+    return write(s, n);
+    #endif
+}
+
+unsigned long SocketServer::zeroCopyCompletions() {
+    return devices::reap_zero_copy(client_socket_fd);
+}
+
+long SocketServer::send_message(const iovec *buffers, const unsigned int &count, const int &flags) {
+    msghdr message = msghdr();
+    message.msg_iov = const_cast<iovec*>(buffers);
+    message.msg_iovlen = count;
     #ifdef MSG_NOSIGNAL
-        int bytes_written = ::send(client_socket_fd,s,n,0|MSG_NOSIGNAL);
+        ssize_t bytes_written = ::sendmsg(client_socket_fd, &message, flags|MSG_NOSIGNAL);
     #else
-        int bytes_written = ::send(client_socket_fd,s,n,0);
+        ssize_t bytes_written = ::sendmsg(client_socket_fd, &message, flags);
     #endif
     if ( bytes_written < 0 ) {
         switch(errno) {
@@ -183,6 +241,10 @@ long SocketServer::write(const char *s, unsigned long n) {
                 close();
                 return ConnectionHungUp;
             }
+            case ( EAGAIN ) : {
+                error_handler = NoError;
+                return 0; // non-blocking and the send buffer is full
+            }
             default : {
         	    ecl_debug_throw( devices::send_exception(LOC) );
         	    error_handler = devices::send_error();
@@ -194,6 +256,55 @@ long SocketServer::write(const char *s, unsigned long n) {
     return bytes_written;
 }
 
+/*****************************************************************************
+** Implementation [SocketServer][Socket Options]
+*****************************************************************************/
+
+bool SocketServer::block() {
+	return configure(devices::set_blocking(client_socket_fd, true));
+}
+
+bool SocketServer::unblock() {
+	return configure(devices::set_blocking(client_socket_fd, false));
+}
+
+bool SocketServer::setNoDelay(const bool &enable) {
+	return configure(devices::set_socket_option(client_socket_fd, IPPROTO_TCP, TCP_NODELAY, enable ? 1 : 0));
+}
+
+bool SocketServer::setCork(const bool &enable) {
+	#if defined(TCP_CORK)
+	return configure(devices::set_socket_option(client_socket_fd, IPPROTO_TCP, TCP_CORK, enable ? 1 : 0));
+	#else
+	(void) enable;
+	error_handler = NotSupportedError;
+	return false;
+	#endif
+}
+
+bool SocketServer::setSendBufferSize(const int &bytes) {
+	return configure(devices::set_socket_option(client_socket_fd, SOL_SOCKET, SO_SNDBUF, bytes));
+}
+
+bool SocketServer::setReceiveBufferSize(const int &bytes) {
+	return configure(devices::set_socket_option(client_socket_fd, SOL_SOCKET, SO_RCVBUF, bytes));
+}
+
+bool SocketServer::setZeroCopy(const bool &enable) {
+	#if defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+	return configure(devices::set_socket_option(client_socket_fd, SOL_SOCKET, SO_ZEROCOPY, enable ? 1 : 0));
+	#else
+	(void) enable;
+	error_handler = NotSupportedError;
+	return false;
+	#endif
+}
+
+bool SocketServer::configure(const bool &result) {
+	error_handler = result ? Error(NoError) : Error(ConfigurationError);
+	return result;
+}
+
 } // namespace ecl
 
 #endif /* ECL_IS_POSIX */
@@ -0,0 +1,317 @@
+/**
+ * @file /src/test/reactor.cpp
+ *
+ * @brief Unit Test for the device reactor (ptys and loopback sockets).
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#include <iostream>
+#include <ecl/config/ecl.hpp>
+#if defined(ECL_IS_POSIX) && defined(__linux__)
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <string>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <gtest/gtest.h>
+#include <ecl/exceptions/standard_exception.hpp>
+#include <ecl/threads/mutex.hpp>
+#include <ecl/threads/thread.hpp>
+#include "../../include/ecl/devices/reactor.hpp"
+#include "../../include/ecl/devices/serial.hpp"
+#include "../../include/ecl/devices/socket.hpp"
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::devices::Reactor;
+using ecl::Mutex;
+using ecl::Serial;
+using ecl::SocketClient;
+using ecl::SocketServer;
+using ecl::StandardException;
+using ecl::Thread;
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+class Receiver {
+public:
+	Receiver() : closed(false) {}
+	void received(const char *bytes, const unsigned long &n) {
+		mutex.lock();
+		if ( n == 0 ) {
+			closed = true;
+		} else {
+			data.append(bytes, n);
+		}
+		mutex.unlock();
+	}
+	void writable() { ++writable_count; }
+	std::string contents() {
+		mutex.lock();
+		std::string s(data);
+		mutex.unlock();
+		return s;
+	}
+	/**
+	 * Poll (for at most a second) until the expected string arrives.
+	 */
+	bool waitFor(const std::string &expected) {
+		for ( unsigned int i = 0; i < 1000; ++i ) {
+			if ( contents() == expected ) {
+				return true;
+			}
+			usleep(1000);
+		}
+		return false;
+	}
+	std::atomic<bool> closed;
+	std::atomic<unsigned int> writable_count{0};
+private:
+	Mutex mutex;
+	std::string data;
+};
+
+class Listener {
+public:
+	Listener(SocketServer &server) : server(server) {}
+	void run() { server.listen(); }
+	SocketServer &server;
+};
+
+/**
+ * Holds up the reactor thread so that events can pile up on other descriptors.
+ */
+class Blocker {
+public:
+	Blocker() : blocking(false), released(false), calls(0) {}
+	void received(const char * /* bytes */, const unsigned long & /* n */) {
+		++calls;
+		blocking = true;
+		while ( !released ) {
+			usleep(1000);
+		}
+	}
+	std::atomic<bool> blocking;
+	std::atomic<bool> released;
+	std::atomic<unsigned int> calls;
+};
+
+/**
+ * Removes a descriptor from a thread that isn't one of the reactor's.
+ */
+class Remover {
+public:
+	Remover(Reactor &reactor, const int &file_descriptor) :
+		reactor(reactor), file_descriptor(file_descriptor), done(false) {}
+	void run() {
+		EXPECT_TRUE(reactor.remove(file_descriptor));
+		done = true;
+	}
+	Reactor &reactor;
+	const int file_descriptor;
+	std::atomic<bool> done;
+};
+
+/**
+ * Write callback that removes and closes its descriptor and registers
+ * a (hung up) socket under the same number.
+ */
+class Swapper {
+public:
+	Swapper(Reactor &reactor, const int &file_descriptor, Receiver &receiver) :
+		reactor(reactor), file_descriptor(file_descriptor), receiver(receiver) {}
+	void swap() {
+		reactor.remove(file_descriptor);
+		::close(file_descriptor);
+		int pair[2];
+		ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, pair));
+		if ( pair[0] != file_descriptor ) { // usually it gets the lowest free number anyway
+			ASSERT_EQ(file_descriptor, dup2(pair[0], file_descriptor));
+			::close(pair[0]);
+		}
+		::close(pair[1]);
+		EXPECT_TRUE(reactor.add(file_descriptor, new ecl::devices::MemberReadCallback<Receiver>(&Receiver::received, receiver)));
+	}
+	Reactor &reactor;
+	const int file_descriptor; // const, or remove() takes it for a device
+	Receiver &receiver;
+};
+
+/*****************************************************************************
+** Tests
+*****************************************************************************/
+
+TEST(ReactorTests,ptys) {
+	const unsigned int number_of_ptys = 3;
+	int masters[number_of_ptys];
+	Serial serials[number_of_ptys];
+	Receiver receivers[number_of_ptys];
+	Reactor reactor(1);
+	for ( unsigned int i = 0; i < number_of_ptys; ++i ) {
+		masters[i] = posix_openpt(O_RDWR | O_NOCTTY);
+		if ( ( masters[i] == -1 ) || ( grantpt(masters[i]) != 0 ) || ( unlockpt(masters[i]) != 0 ) ) {
+			std::cout << "Pseudo terminals are not available, skipping." << std::endl;
+			return;
+		}
+		serials[i].open(ptsname(masters[i]));
+		EXPECT_TRUE(reactor.add(serials[i], &Receiver::received, receivers[i]));
+	}
+	EXPECT_EQ(number_of_ptys, reactor.size());
+	EXPECT_FALSE(reactor.add(serials[0], &Receiver::received, receivers[0])); // already registered
+	for ( unsigned int i = 0; i < number_of_ptys; ++i ) {
+		std::string message = std::string("pty") + static_cast<char>('0' + i);
+		ssize_t n = ::write(masters[i], message.c_str(), message.size());
+		EXPECT_EQ(static_cast<ssize_t>(message.size()), n);
+	}
+	for ( unsigned int i = 0; i < number_of_ptys; ++i ) {
+		EXPECT_TRUE(receivers[i].waitFor(std::string("pty") + static_cast<char>('0' + i)));
+	}
+	EXPECT_TRUE(reactor.remove(serials[1]));
+	EXPECT_FALSE(reactor.remove(serials[1]));
+	EXPECT_EQ(number_of_ptys - 1, reactor.size());
+	for ( unsigned int i = 0; i < number_of_ptys; ++i ) {
+		::close(masters[i]);
+	}
+}
+
+TEST(ReactorTests,sockets) {
+	try {
+		SocketServer server(5577);
+		Listener listener(server);
+		Thread thread(&Listener::run, listener);
+		SocketClient client;
+		for ( unsigned int i = 0; i < 100; ++i ) { // the listener might not be listening yet
+			try {
+				if ( client.open("localhost", 5577) ) { break; }
+			} catch ( const StandardException &e ) {}
+			usleep(10000);
+		}
+		thread.join();
+		ASSERT_TRUE(client.open());
+
+		Receiver server_receiver, client_receiver;
+		Reactor reactor(2);
+		EXPECT_TRUE(reactor.add(server, &Receiver::received, server_receiver));
+		EXPECT_TRUE(reactor.add(client, &Receiver::received, client_receiver));
+		client.write("ping", 4);
+		EXPECT_TRUE(server_receiver.waitFor("ping"));
+		server.write("pong", 4);
+		EXPECT_TRUE(client_receiver.waitFor("pong"));
+
+		// one shot write readiness
+		EXPECT_TRUE(reactor.notifyWritable(client, &Receiver::writable, client_receiver));
+		for ( unsigned int i = 0; ( i < 1000 ) && ( client_receiver.writable_count == 0 ); ++i ) {
+			usleep(1000);
+		}
+		EXPECT_EQ(1u, client_receiver.writable_count);
+
+		// hangups remove the device and signal with a zero length read
+		EXPECT_TRUE(reactor.remove(client)); // always remove before closing
+		client.close();
+		for ( unsigned int i = 0; ( i < 1000 ) && !server_receiver.closed; ++i ) {
+			usleep(1000);
+		}
+		EXPECT_TRUE(server_receiver.closed);
+		EXPECT_EQ(0u, reactor.size());
+	} catch ( const StandardException &e ) {
+		std::cout << "Loopback sockets are not available, skipping [" << e.what() << "]" << std::endl;
+	}
+}
+
+TEST(ReactorTests,reusedDescriptors) {
+	Reactor reactor(1);
+	int blocked[2], pair[2];
+	ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, blocked));
+	ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, pair));
+	Blocker blocker;
+	EXPECT_TRUE(reactor.add(blocked[0], new ecl::devices::MemberReadCallback<Blocker>(&Blocker::received, blocker)));
+	ssize_t n = ::write(blocked[1], "x", 1);
+	EXPECT_EQ(1, n);
+	for ( unsigned int i = 0; ( i < 1000 ) && !blocker.blocking; ++i ) {
+		usleep(1000);
+	}
+	// write ready and hung up in the one event, the write callback reuses the number
+	Receiver original, replacement;
+	Swapper swapper(reactor, pair[0], replacement);
+	EXPECT_TRUE(reactor.add(pair[0], new ecl::devices::MemberReadCallback<Receiver>(&Receiver::received, original)));
+	EXPECT_TRUE(reactor.notifyWritable(pair[0], new ecl::devices::MemberWriteCallback<Swapper>(&Swapper::swap, swapper)));
+	::close(pair[1]);
+	blocker.released = true;
+	for ( unsigned int i = 0; ( i < 1000 ) && !replacement.closed; ++i ) {
+		usleep(1000);
+	}
+	EXPECT_TRUE(replacement.closed); // its hangup is its own, not swallowed by the original's dispatch
+	EXPECT_FALSE(original.closed); // removed by its own callback
+	const int blocked_descriptor = blocked[0];
+	EXPECT_TRUE(reactor.remove(blocked_descriptor));
+	EXPECT_EQ(0u, reactor.size());
+	::close(pair[0]);
+	::close(blocked[0]);
+	::close(blocked[1]);
+}
+
+TEST(ReactorTests,removeWhileDispatching) {
+	Reactor reactor(1);
+	int pair[2];
+	ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, pair));
+	Blocker blocker;
+	EXPECT_TRUE(reactor.add(pair[0], new ecl::devices::MemberReadCallback<Blocker>(&Blocker::received, blocker)));
+	ssize_t n = ::write(pair[1], "x", 1);
+	EXPECT_EQ(1, n);
+	for ( unsigned int i = 0; ( i < 1000 ) && !blocker.blocking; ++i ) {
+		usleep(1000);
+	}
+	ASSERT_TRUE(blocker.blocking);
+	Remover remover(reactor, pair[0]);
+	Thread thread(&Remover::run, remover);
+	usleep(50000);
+	EXPECT_FALSE(remover.done); // waits for the callback
+	blocker.released = true;
+	thread.join();
+	EXPECT_TRUE(remover.done);
+	EXPECT_EQ(0u, reactor.size());
+	// nothing more is dispatched, and it's safe to close
+	n = ::write(pair[1], "y", 1);
+	EXPECT_EQ(1, n);
+	usleep(20000);
+	EXPECT_EQ(1u, blocker.calls);
+	::close(pair[0]);
+	::close(pair[1]);
+}
+
+/*****************************************************************************
+** Main program
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+
+	testing::InitGoogleTest(&argc,argv);
+	return RUN_ALL_TESTS();
+}
+
+#else
+
+/*****************************************************************************
+** Alternative main
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+	std::cout << "Currently not supported on your platform." << std::endl;
+}
+
+#endif /* ECL_IS_POSIX && __linux__ */
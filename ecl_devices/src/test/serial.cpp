@@ -0,0 +1,191 @@
+/**
+ * @file /src/test/serial.cpp
+ *
+ * @brief Unit Test for the serial device (on a pseudo terminal).
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#include <iostream>
+#include <ecl/config/ecl.hpp>
+#if defined(ECL_IS_POSIX)
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <string>
+#include <unistd.h>
+#include <gtest/gtest.h>
+#include <ecl/exceptions/standard_exception.hpp>
+#include <ecl/threads/thread.hpp>
+#include "../../include/ecl/devices/serial.hpp"
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::Serial;
+using ecl::StandardException;
+using ecl::Thread;
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+/**
+ * Master side of a pseudo terminal, the serial device opens the slave.
+ */
+class PseudoTerminal {
+public:
+	PseudoTerminal() : master(-1) {
+		master = posix_openpt(O_RDWR | O_NOCTTY);
+		if ( ( master != -1 ) && ( grantpt(master) == 0 ) && ( unlockpt(master) == 0 ) ) {
+			slave_name = ptsname(master);
+		}
+	}
+	~PseudoTerminal() { if ( master != -1 ) { ::close(master); } }
+	bool ok() const { return !slave_name.empty(); }
+	void write(const char *s) { ssize_t n = ::write(master, s, strlen(s)); (void) n; }
+
+	int master;
+	std::string slave_name;
+};
+
+double elapsed_ms(const timespec &start) {
+	timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec - start.tv_sec)*1000.0 + (now.tv_nsec - start.tv_nsec)/1000000.0;
+}
+
+class DelayedWriter {
+public:
+	DelayedWriter(PseudoTerminal &terminal, const char *s) : terminal(terminal), s(s) {}
+	void run() {
+		usleep(10000);
+		terminal.write(s);
+	}
+	PseudoTerminal &terminal;
+	const char *s;
+};
+
+/*****************************************************************************
+** Tests
+*****************************************************************************/
+
+TEST(SerialTests,timeout) {
+	PseudoTerminal terminal;
+	if ( !terminal.ok() ) {
+		std::cout << "Pseudo terminals are not available, skipping." << std::endl;
+		return;
+	}
+	Serial serial(terminal.slave_name);
+	serial.block(20);
+	char buffer[16];
+	timespec start;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	EXPECT_EQ(0, serial.read(buffer, 16));
+	double elapsed = elapsed_ms(start);
+	EXPECT_GE(elapsed, 19.0);
+	EXPECT_LT(elapsed, 500.0);
+}
+
+TEST(SerialTests,readExactly) {
+	PseudoTerminal terminal;
+	if ( !terminal.ok() ) {
+		return;
+	}
+	Serial serial(terminal.slave_name);
+	serial.block(1000);
+	terminal.write("abcd");
+	DelayedWriter writer(terminal, "efgh");
+	Thread thread(&DelayedWriter::run, writer);
+	char buffer[9];
+	EXPECT_EQ(8, serial.read_exactly(buffer, 8));
+	buffer[8] = '\0';
+	EXPECT_STREQ("abcdefgh", buffer);
+	thread.join();
+}
+
+TEST(SerialTests,readUntil) {
+	PseudoTerminal terminal;
+	if ( !terminal.ok() ) {
+		return;
+	}
+	Serial serial(terminal.slave_name);
+	serial.block(200);
+	terminal.write("abc\ndefg\nhi");
+	char buffer[16];
+	long n = serial.read_until(buffer, 16, '\n');
+	EXPECT_EQ(std::string("abc\n"), std::string(buffer, n > 0 ? n : 0));
+	EXPECT_EQ(7, serial.remaining());
+	n = serial.read_until(buffer, 16, '\n');
+	EXPECT_EQ(std::string("defg\n"), std::string(buffer, n > 0 ? n : 0));
+	// no delimiter, so it times out with what it has
+	n = serial.read_until(buffer, 16, '\n');
+	EXPECT_EQ(std::string("hi"), std::string(buffer, n > 0 ? n : 0));
+	// leftovers are also handed to ordinary reads
+	terminal.write("jk\nlm");
+	n = serial.read_until(buffer, 2, '\n');
+	EXPECT_EQ(std::string("jk"), std::string(buffer, n > 0 ? n : 0));
+	serial.read_exactly(buffer, 3);
+	EXPECT_EQ(std::string("\nlm"), std::string(buffer, 3));
+	// nothing asked for, nothing taken from the leftovers
+	terminal.write("no\npq");
+	n = serial.read_until(buffer, 16, '\n');
+	EXPECT_EQ(std::string("no\n"), std::string(buffer, n > 0 ? n : 0));
+	EXPECT_EQ(0, serial.read_until(buffer, 0, '\n'));
+	EXPECT_EQ(2, serial.remaining());
+}
+
+TEST(SerialTests,hangUp) {
+	PseudoTerminal terminal;
+	if ( !terminal.ok() ) {
+		return;
+	}
+	Serial serial(terminal.slave_name);
+	serial.block(2000);
+	::close(terminal.master);
+	terminal.master = -1;
+	char buffer[16];
+	long n = 0;
+	timespec start;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	try {
+		n = serial.read(buffer, 16);
+	} catch ( const StandardException &e ) {
+		n = -1;
+	}
+	// a hung up device is an error straight away, not a busy wait until the timeout
+	EXPECT_EQ(-1, n);
+	EXPECT_LT(elapsed_ms(start), 500.0);
+}
+
+/*****************************************************************************
+** Main program
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+
+	testing::InitGoogleTest(&argc,argv);
+	return RUN_ALL_TESTS();
+}
+
+#else
+
+/*****************************************************************************
+** Alternative main
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+	std::cout << "Currently not supported on your platform." << std::endl;
+}
+
+#endif /* ECL_IS_POSIX */
@@ -9,9 +9,13 @@
 ** Includes
 *****************************************************************************/
 
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <string>
 #include <gtest/gtest.h>
 #include <ecl/threads/thread.hpp>
+#include <ecl/time/sleep.hpp>
 #include <ecl/time/timestamp.hpp>
 #include "../../include/ecl/devices/shared_file.hpp"
 
@@ -45,6 +49,29 @@ void shared_files_f() {
     file.flush();
 }
 
+void async_shared_files_f() {
+    SharedFile file("async_shared.txt");
+    EXPECT_TRUE(file.enableAsynchronousWrites(8*1024, ecl::BlockOnOverflow));
+    for (unsigned int i = 0; i < 1000; ++i ) {
+    	file.write("Thread\n",7);
+    	file.flush();
+    }
+}
+
+void blocking_shared_files_f() {
+    SharedFile file("async_blocking.txt");
+    EXPECT_TRUE(file.enableAsynchronousWrites(1, ecl::BlockOnOverflow)); // rounds up to the minimum
+    char block[2048] = { 0 };
+    for (unsigned int i = 0; i < 1000; ++i ) {
+    	file.write(block, 2048);
+    	EXPECT_TRUE(file.flush());
+    }
+}
+
+long file_size(const char *name) {
+    std::ifstream input(name, std::ios::binary | std::ios::ate);
+    return input ? static_cast<long>(input.tellg()) : -1;
+}
 
 } // namespace tests
 } // namespace devices
@@ -69,6 +96,99 @@ TEST(SharedFileTests,allEggsInTheBasket) {
     thread.join();
 }
 
+TEST(SharedFileTests,asynchronous) {
+    {
+        SharedFile file("async_shared.txt");
+        EXPECT_TRUE(file.enableAsynchronousWrites(8*1024, ecl::BlockOnOverflow));
+        EXPECT_TRUE(file.asynchronous());
+        Thread thread(async_shared_files_f);
+        for (unsigned int i = 0; i < 1000; ++i ) {
+        	file.write("Main\n",5);
+        	if ( i % 10 == 0 ) { file.flush(); }
+        }
+        thread.join();
+        EXPECT_EQ(0u, file.dropped());
+    } // the last instance going out of scope writes everything out
+    std::ifstream input("async_shared.txt");
+    std::string line;
+    unsigned int main_lines = 0, thread_lines = 0;
+    while ( std::getline(input, line) ) {
+    	if ( line == "Main" ) { ++main_lines; }
+    	else if ( line == "Thread" ) { ++thread_lines; }
+    	else { ADD_FAILURE() << "Torn line: " << line; }
+    }
+    EXPECT_EQ(1000u, main_lines);
+    EXPECT_EQ(1000u, thread_lines);
+}
+
+TEST(SharedFileTests,asynchronousDrops) {
+    SharedFile file("async_drops.txt");
+    EXPECT_TRUE(file.enableAsynchronousWrites(1, ecl::DropOnOverflow)); // rounds up to the minimum
+    char block[2048] = { 0 };
+    unsigned int failed = 0;
+    for (unsigned int i = 0; i < 1000; ++i ) {
+    	file.write(block, 2048);
+    	if ( !file.flush() ) { ++failed; }
+    }
+    EXPECT_EQ(failed, file.dropped());
+}
+
+TEST(SharedFileTests,asynchronousBlocking) {
+    std::remove("async_blocking.txt"); // New doesn't truncate
+    {
+        SharedFile file("async_blocking.txt");
+        EXPECT_TRUE(file.enableAsynchronousWrites(1, ecl::BlockOnOverflow));
+        Thread thread(blocking_shared_files_f);
+        char block[2048] = { 0 };
+        for (unsigned int i = 0; i < 1000; ++i ) {
+        	file.write(block, 2048);
+        	EXPECT_TRUE(file.flush());
+        }
+        thread.join();
+        EXPECT_EQ(0u, file.dropped());
+    }
+    EXPECT_EQ(2*1000*2048, file_size("async_blocking.txt"));
+}
+
+TEST(SharedFileTests,asynchronousWakesWriter) {
+    std::remove("async_wake.txt");
+    SharedFile file("async_wake.txt");
+    EXPECT_TRUE(file.enableAsynchronousWrites());
+    for (unsigned int i = 0; i < 3; ++i ) {
+    	// give the writer time to go to sleep, the flush has to wake it
+    	ecl::Sleep()(ecl::Duration(0.05));
+    	file.write("Wake\n", 5);
+    	file.flush();
+    	long expected = 5*(i+1);
+    	for (unsigned int j = 0; ( j < 100 ) && ( file_size("async_wake.txt") != expected ); ++j ) {
+    		ecl::Sleep()(ecl::Duration(0.01));
+    	}
+    	EXPECT_EQ(expected, file_size("async_wake.txt"));
+    }
+}
+
+TEST(SharedFileTests,writeErrorWithTwoInstances) {
+    // writes fail once they get past the stdio buffer
+    SharedFile *first = new SharedFile("/dev/full");
+    SharedFile second("/dev/full");
+    EXPECT_EQ(2u, second.count());
+    char block[1024] = { 0 };
+    long n = 0;
+    for (unsigned int i = 0; ( i < 64 ) && ( n >= 0 ); ++i ) {
+    	ecl_debug_try {
+    		n = first->write(block, 1024);
+    	} ecl_debug_catch( const ecl::StandardException &e ) {
+    		n = -1;
+    	}
+    }
+    EXPECT_EQ(-1, n);
+    EXPECT_EQ(ecl::WriteError, second.error().flag());
+    delete first; // still in use by the second
+    EXPECT_EQ(1u, second.count());
+    SharedFile third("/dev/full");
+    EXPECT_EQ(2u, third.count());
+}
+
 /*****************************************************************************
 ** Main program
 *****************************************************************************/
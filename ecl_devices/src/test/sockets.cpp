@@ -0,0 +1,157 @@
+/**
+ * @file /src/test/sockets.cpp
+ *
+ * @brief Unit Test for the socket devices (over loopback).
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#include <iostream>
+#include <ecl/config/ecl.hpp>
+#if defined(ECL_IS_POSIX) && !defined(ECL_IS_APPLE)
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <cstring>
+#include <string>
+#include <unistd.h>
+#include <gtest/gtest.h>
+#include <ecl/exceptions/standard_exception.hpp>
+#include <ecl/threads/thread.hpp>
+#include "../../include/ecl/devices/socket.hpp"
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::SocketClient;
+using ecl::SocketServer;
+using ecl::StandardException;
+using ecl::Thread;
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+class Listener {
+public:
+	Listener(SocketServer &server) : server(server) {}
+	void run() { server.listen(); }
+	SocketServer &server;
+};
+
+/**
+ * Connects a client to a server on the loopback interface.
+ */
+bool connect(SocketServer &server, SocketClient &client, const unsigned int &port) {
+	try {
+		server.open(port);
+	} catch ( const StandardException &e ) {
+		return false;
+	}
+	Listener listener(server);
+	Thread thread(&Listener::run, listener);
+	for ( unsigned int i = 0; i < 100; ++i ) { // the listener might not be listening yet
+		try {
+			if ( client.open("localhost", port) ) { break; }
+		} catch ( const StandardException &e ) {}
+		usleep(10000);
+	}
+	thread.join();
+	return client.open();
+}
+
+/*****************************************************************************
+** Tests
+*****************************************************************************/
+
+TEST(SocketTests,scatterGather) {
+	SocketServer server;
+	SocketClient client;
+	if ( !connect(server, client, 5578) ) {
+		std::cout << "Loopback sockets are not available, skipping." << std::endl;
+		return;
+	}
+	EXPECT_TRUE(client.setNoDelay(true));
+	EXPECT_TRUE(client.setSendBufferSize(64*1024));
+	EXPECT_TRUE(server.setReceiveBufferSize(64*1024));
+
+	char header[4] = { 'h', 'd', 'r', ':' };
+	char payload[] = "payload";
+	iovec out[2] = { { header, 4 }, { payload, 7 } };
+	EXPECT_EQ(11, client.write(out, 2));
+
+	char in_header[4], in_payload[7];
+	iovec in[2] = { { in_header, 4 }, { in_payload, 7 } };
+	EXPECT_EQ(11, server.read_exactly(in_header, 4) + server.read_exactly(in_payload, 7));
+	EXPECT_EQ(0, memcmp(header, in_header, 4));
+	EXPECT_EQ(0, memcmp(payload, in_payload, 7));
+
+	EXPECT_EQ(11, server.write(out, 2));
+	EXPECT_EQ(11, client.read_exactly(in_header, 4) + client.read(&in[1], 1));
+	EXPECT_EQ(0, memcmp(payload, in_payload, 7));
+}
+
+TEST(SocketTests,nonBlocking) {
+	SocketServer server;
+	SocketClient client;
+	if ( !connect(server, client, 5579) ) {
+		return;
+	}
+	EXPECT_TRUE(server.unblock());
+	char buffer[16];
+	EXPECT_EQ(0, server.read(buffer, 16)); // nothing there, doesn't block
+	client.write("abc", 3);
+	long n = 0;
+	for ( unsigned int i = 0; ( i < 100 ) && ( n == 0 ); ++i ) {
+		n = server.read(buffer, 16);
+		if ( n == 0 ) { usleep(1000); }
+	}
+	EXPECT_EQ(3, n);
+	EXPECT_TRUE(server.block());
+}
+
+TEST(SocketTests,zeroLength) {
+	SocketServer server;
+	SocketClient client;
+	if ( !connect(server, client, 5580) ) {
+		return;
+	}
+	char buffer[4];
+	iovec empty[2] = { { buffer, 0 }, { buffer, 0 } };
+	// nothing asked for, not a hang up
+	EXPECT_EQ(0, server.read(buffer, 0));
+	EXPECT_EQ(0, client.read_exactly(buffer, 0));
+	EXPECT_EQ(0, client.read(empty, 2));
+	EXPECT_TRUE(server.open());
+	EXPECT_TRUE(client.open());
+	client.write("abc", 3);
+	EXPECT_EQ(3, server.read_exactly(buffer, 3));
+}
+
+/*****************************************************************************
+** Main program
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+
+	testing::InitGoogleTest(&argc,argv);
+	return RUN_ALL_TESTS();
+}
+
+#else
+
+/*****************************************************************************
+** Alternative main
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+	std::cout << "Currently not supported on your platform." << std::endl;
+}
+
+#endif
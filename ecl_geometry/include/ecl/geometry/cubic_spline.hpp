@@ -16,6 +16,7 @@
 ** Includes
 *****************************************************************************/
 
+#include <atomic>
 #include "polynomial.hpp"
 #include <ecl/config/macros.hpp>
 #include <ecl/concepts/macros.hpp>
@@ -118,6 +119,13 @@ class ECL_PUBLIC BluePrintFactory< CubicSpline > {
  * or a C2 constraint can be fixed, resulting in a derivation for the spline's
  * functions.
  *
+ * Segments are located with a binary search, after first checking the
+ * segment found by the previous lookup (and the one after it), so
+ * sampling in order costs O(1) per sample and random access O(log n).
+ * The value and derivative coefficients of every segment are stored
+ * contiguously, so no polynomials are constructed while evaluating. For
+ * sampling many points at once, see evaluate().
+ *
  * @sa @ref ecl::Polynomial "Polynomial", @ref splinesGeometry "Math::Splines.
  **/
 class ECL_PUBLIC CubicSpline : public BluePrintFactory< CubicSpline > {
@@ -195,6 +203,19 @@ class ECL_PUBLIC CubicSpline : public BluePrintFactory< CubicSpline > {
          * @exception : StandardException : throws if input x value is outside the spline range [debug mode only].
          */
         double dderivative(double x) const;
+        /**
+         * @brief Batched spline function.
+         *
+         * Evaluates the spline at many points at once. For increasing sample
+         * points it walks the segments incrementally, evaluating each run of
+         * points that fall in the same segment in a tight (vectorisable)
+         * loop. Unordered points are also handled, just more slowly.
+         *
+         * @param xs : the domain values.
+         * @param ys : the spline function's values (resized to match).
+         * @exception : StandardException : throws if any x value is outside the spline range [debug mode only].
+         */
+        void evaluate(const Array<double>& xs, Array<double>& ys) const;
 
         /**
          * @brief The discretised domain for this spline.
@@ -232,10 +253,30 @@ class ECL_PUBLIC CubicSpline : public BluePrintFactory< CubicSpline > {
         friend OutputStream& operator << (OutputStream &ostream, const CubicSpline &cubic_spline);
 
     private:
+        /**
+         * @brief The last segment looked up, copyable and safe to share between threads.
+         */
+        class SegmentHint {
+        public:
+            SegmentHint() : index(0) {}
+            SegmentHint(const SegmentHint &other) : index(other.load()) {}
+            SegmentHint& operator=(const SegmentHint &other) { store(other.load()); return *this; }
+            unsigned int load() const { return index.load(std::memory_order_relaxed); }
+            void store(const unsigned int &i) const { index.store(i, std::memory_order_relaxed); }
+        private:
+            mutable std::atomic<unsigned int> index;
+        };
+
+        static const unsigned int stride = 9; // cubic, quadratic (1st derivative) and linear (2nd derivative) coefficients
+        unsigned int segment(const double &x) const;
+        void tabulate();
+
         Array<double> discretised_domain;      // N+1 x_i's
         // Would normally use pointers here, but the polynomials have fixed storage
         // size, the copy cost is small and the access times will be faster this way.
         Array<CubicPolynomial> cubic_polynomials;   // N polynomials
+        Array<double> coefficients;            // N*stride, for evaluation
+        SegmentHint hint;
 };
 
 /*****************************************************************************
@@ -14,5 +14,7 @@
 
 #include "odometry_typedefs.hpp"
 #include "odometry_helper.hpp"
+#include "trajectory_buffer.hpp"
+#include "trajectory_index.hpp"
 
 #endif /*ECL_ODOMETRY_ODOMETRY_HPP_*/
@@ -39,6 +39,8 @@ ecl_geometry_PUBLIC double distance(const Pose2D& pose, const Trajectory2D& traj
  * to calculate the distance to the pose
  */
 ecl_geometry_PUBLIC double distance(const Position2D& position, const Trajectory2D& trajectory);
+ecl_geometry_PUBLIC double distance(const Pose2D& pose, const Trajectory2DView& trajectory); /**< @brief Shortest distance between a pose and a trajectory view */
+ecl_geometry_PUBLIC double distance(const Position2D& position, const Trajectory2DView& trajectory); /**< @brief Shortest distance between a position and a trajectory view */
 
 ecl_geometry_PUBLIC bool empty(const Trajectory2D& trajectory); /**< @brief Check if trajectory ptr is empty (ptr not set or has no poses) */
 ecl_geometry_PUBLIC bool empty(const Odom2DTrajectory& trajectory); /**< @brief Check if trajectory ptr is empty (ptr not set or has no odometries) */
@@ -46,6 +48,12 @@ ecl_geometry_PUBLIC bool empty(const Odom2DTrajectory& trajectory); /**< @brief
 ecl_geometry_PUBLIC int size(const Trajectory2D& trajectory); /**< @brief Get the size of the trajectory */
 ecl_geometry_PUBLIC int size(const Odom2DTrajectory& trajectory); /**< @brief Get the size of the trajectory */
 
+ecl_geometry_PUBLIC bool empty(const Trajectory2DView& trajectory); /**< @brief Check if trajectory view has no poses */
+ecl_geometry_PUBLIC bool empty(const Odom2DTrajectoryView& trajectory); /**< @brief Check if trajectory view has no odometries */
+
+ecl_geometry_PUBLIC int size(const Trajectory2DView& trajectory); /**< @brief Get the size of the trajectory view */
+ecl_geometry_PUBLIC int size(const Odom2DTrajectoryView& trajectory); /**< @brief Get the size of the trajectory view */
+
 ecl_geometry_PUBLIC double distance(const Odom2D& a, const Odom2D& b); /**< @brief Distance between the positions of odometries */
 ecl_geometry_PUBLIC double distance(const Pose2D& a, const Pose2D& b); /**< @brief Distance between poses */
 ecl_geometry_PUBLIC double distance(const Pose2D& a, const Odom2D& b); /**< @brief Distance between a pose and the position of a odometry */
@@ -55,13 +63,15 @@ ecl_geometry_PUBLIC double distanceSqared(const Pose2D& a, const Pose2D& b); /**
 /**< @brief Concat two trajectories
  *
  * Adds a trajectory to the end of another trajectory.
- * Shouldn't be used for frequent adding because of bad performance.
+ * Shouldn't be used for frequent adding because of bad performance,
+ * use a TrajectoryBuffer for that.
  */
 ecl_geometry_PUBLIC void addAtEnd(Trajectory2D& target, const Trajectory2D& addition);
 /**< @brief Concat two odometry trajectories
  *
  * Adds a trajectory to the end of another trajectory.
- * Shouldn't be used for frequent adding because of bad performance.
+ * Shouldn't be used for frequent adding because of bad performance,
+ * use a TrajectoryBuffer for that.
  */
 ecl_geometry_PUBLIC void addAtEnd(Odom2DTrajectory& target, const Odom2DTrajectory& addition);
 
@@ -86,14 +96,22 @@ ecl_geometry_PUBLIC void setAt(Odom2DTrajectory& trajectory, const int& index, c
 
 ecl_geometry_PUBLIC Pose2D getAt(const Trajectory2D& trajectory, const int& index); /**< @brief Get element of trajectory */
 ecl_geometry_PUBLIC Odom2D getAt(const Odom2DTrajectory& trajectory, const int& index); /**< @brief Get element of trajectory */
+ecl_geometry_PUBLIC Pose2D getAt(const Trajectory2DView& trajectory, const int& index); /**< @brief Get element of trajectory view */
+ecl_geometry_PUBLIC Odom2D getAt(const Odom2DTrajectoryView& trajectory, const int& index); /**< @brief Get element of trajectory view */
 
 ecl_geometry_PUBLIC Pose2D getFront(const Trajectory2D& trajectory); /**< @brief Get front (first) element of trajectory */
 ecl_geometry_PUBLIC Pose2D getBack(const Trajectory2D& trajectory); /**< @brief Get back (last) element of trajectory */
 ecl_geometry_PUBLIC Odom2D getFront(const Odom2DTrajectory& trajectory); /**< @brief Get front (first) element of trajectory */
 ecl_geometry_PUBLIC Odom2D getBack(const Odom2DTrajectory& trajectory); /**< @brief Get back (last) element of trajectory */
+ecl_geometry_PUBLIC Pose2D getFront(const Trajectory2DView& trajectory); /**< @brief Get front (first) element of trajectory view */
+ecl_geometry_PUBLIC Pose2D getBack(const Trajectory2DView& trajectory); /**< @brief Get back (last) element of trajectory view */
+ecl_geometry_PUBLIC Odom2D getFront(const Odom2DTrajectoryView& trajectory); /**< @brief Get front (first) element of trajectory view */
+ecl_geometry_PUBLIC Odom2D getBack(const Odom2DTrajectoryView& trajectory); /**< @brief Get back (last) element of trajectory view */
 
 ecl_geometry_PUBLIC Trajectory2D getPoses(const Odom2DTrajectory& trajectory); /**< @brief Extract poses of odom trajectory */
 ecl_geometry_PUBLIC Twist2DVector getTwists(const Odom2DTrajectory& trajectory); /**< @brief Extract twists of odom trajectory */
+ecl_geometry_PUBLIC Trajectory2D getPoses(const Odom2DTrajectoryView& trajectory); /**< @brief Extract poses of odom trajectory view */
+ecl_geometry_PUBLIC Twist2DVector getTwists(const Odom2DTrajectoryView& trajectory); /**< @brief Extract twists of odom trajectory view */
 
 ecl_geometry_PUBLIC void setVelocityX(Odom2D& odom, const float& value); /**< @brief Set linear velocity x direction */
 ecl_geometry_PUBLIC void setVelocityY(Odom2D& odom, const float& value); /**< @brief Set linear velocity y direction */
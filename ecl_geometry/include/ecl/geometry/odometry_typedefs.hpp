@@ -100,6 +100,22 @@ typedef Eigen::Matrix<float, 6, 1> Odom2D;
  */
 typedef Eigen::Matrix<float, 6, Eigen::Dynamic> Odom2DTrajectory;
 
+/**
+ * @brief Read only view of 2D poses stored elsewhere (x, y, heading).
+ *
+ * Maps a Trajectory2D over externally owned storage, e.g. a
+ * TrajectoryBuffer's, without copying it.
+ */
+typedef Eigen::Map<const Trajectory2D> Trajectory2DView;
+
+/**
+ * @brief Read only view of 2D odometries stored elsewhere (x, y, heading, v_x, v_y, w).
+ *
+ * Maps an Odom2DTrajectory over externally owned storage, e.g. a
+ * TrajectoryBuffer's, without copying it.
+ */
+typedef Eigen::Map<const Odom2DTrajectory> Odom2DTrajectoryView;
+
 
 /*****************************************************************************
 ** c++11 shared_ptr typedefs
@@ -17,6 +17,7 @@
 *****************************************************************************/
 
 #include <cmath>
+#include <cstddef>
 #include "cartesian_point.hpp"
 #include "function_math.hpp"
 #include "pascals_triangle.hpp"
@@ -43,6 +44,61 @@ namespace ecl {
 
 template <unsigned int N> class Polynomial;
 
+/*****************************************************************************
+** Horner's Method
+*****************************************************************************/
+
+namespace geometry {
+
+/**
+ * @brief Horner's method, unrolled at compile time.
+ *
+ * Folds the coefficients a_{K-1}..a_0 into the accumulators. Works for
+ * scalars and for fixed size eigen arrays alike - eigen maps the latter
+ * onto the platform's simd packets (sse/avx/neon).
+ *
+ * @tparam K : number of coefficients left to fold in.
+ */
+template <unsigned int K>
+struct Horner {
+	/**
+	 * @brief Value only, p should start as a_K.
+	 */
+	template <typename T>
+	static void value(const double *a, const T &x, T &p) {
+		p = p*x + a[K-1];
+		Horner<K-1>::value(a, x, p);
+	}
+	/**
+	 * @brief Value and derivatives, p should start as a_K, d and dd as zero.
+	 *
+	 * Leaves the first derivative in d and half the second derivative in dd.
+	 */
+	template <typename T>
+	static void derivatives(const double *a, const T &x, T &p, T &d, T &dd) {
+		dd = dd*x + d;
+		d = d*x + p;
+		p = p*x + a[K-1];
+		Horner<K-1>::derivatives(a, x, p, d, dd);
+	}
+};
+
+/**
+ * @cond DO_NOT_DOXYGEN
+ */
+template <>
+struct Horner<0> {
+	template <typename T>
+	static void value(const double * /* a */, const T & /* x */, T & /* p */) {}
+	template <typename T>
+	static void derivatives(const double * /* a */, const T & /* x */, T & /* p */, T & /* d */, T & /* dd */) {}
+};
+/**
+ * @endcond
+ */
+
+} // namespace geometry
+
 /*****************************************************************************
 ** BluePrintFactory
 *****************************************************************************/
@@ -213,6 +269,31 @@ class ecl_geometry_PUBLIC Polynomial : public BluePrintFactory< Polynomial<N> >,
          */
         double dderivative(const double &x) const;
 
+        /*********************
+        ** Batch Evaluation
+        **********************/
+        /**
+         * @brief Evaluate the polynomial and its derivatives at many points.
+         *
+         * Values, first and second derivatives all come out of a single
+         * Horner pass, unrolled at compile time and run over blocks of points
+         * at once in simd registers. Any of the outputs may be NULL if not
+         * wanted, with both derivatives NULL only the values are computed.
+         *
+         * @code
+         * std::vector<double> t(1000000), y(t.size()), dy(t.size());
+         * quintic.evaluate(&t[0], t.size(), &y[0], &dy[0]);
+         * @endcode
+         *
+         * @param x : points to evaluate at (contiguous).
+         * @param n : number of points.
+         * @param values : output, the n values (or NULL).
+         * @param first_derivatives : output, the n first derivatives (or NULL).
+         * @param second_derivatives : output, the n second derivatives (or NULL).
+         */
+        void evaluate(const double *x, const std::size_t n, double *values,
+                      double *first_derivatives = NULL, double *second_derivatives = NULL) const;
+
         /*********************
         ** Accessors
         **********************/
@@ -340,6 +421,26 @@ class ECL_PUBLIC Polynomial<0> {
             return 0.0;
         };
 
+        /*********************
+        ** Batch Evaluation
+        **********************/
+        /**
+         * @brief Evaluate at many points (constant values, zero derivatives).
+         *
+         * @param n : number of points.
+         * @param values : output, the n values (or NULL).
+         * @param first_derivatives : output, the n first derivatives (or NULL).
+         * @param second_derivatives : output, the n second derivatives (or NULL).
+         */
+        void evaluate(const double * /* x */, const std::size_t n, double *values,
+                      double *first_derivatives = NULL, double *second_derivatives = NULL) const {
+            for ( std::size_t i = 0; i < n; ++i ) {
+                if ( values != NULL ) { values[i] = coeff[0]; }
+                if ( first_derivatives != NULL ) { first_derivatives[i] = 0.0; }
+                if ( second_derivatives != NULL ) { second_derivatives[i] = 0.0; }
+            }
+        }
+
         /*********************
         ** Accessors
         **********************/
@@ -415,31 +516,70 @@ void Polynomial<N>::shift_horizontal(const double &shift)
 template <unsigned int N>
 double Polynomial<N>::operator()(const double &x) const
 {
-    double tmp = x;
-    double value = coeff[0];
-    for ( unsigned int i = 1; i <= N; ++i ) {
-         value += coeff[i]*tmp;
-         tmp *= x;
-    }
+    double value = coeff[N];
+    geometry::Horner<N>::value(&coeff[0], x, value);
     return value;
 }
 template <unsigned int N>
 double Polynomial<N>::derivative(const double &x) const {
-
-    if ( N > 0 ) {
-        return derivative()(x);
-    } else {
-        return 0.0;
-    }
+    double value = coeff[N], first = 0.0, half_second = 0.0;
+    geometry::Horner<N>::derivatives(&coeff[0], x, value, first, half_second);
+    return first;
 }
 
 template <unsigned int N>
 double Polynomial<N>::dderivative(const double &x) const {
+    double value = coeff[N], first = 0.0, half_second = 0.0;
+    geometry::Horner<N>::derivatives(&coeff[0], x, value, first, half_second);
+    return 2.0*half_second;
+}
 
-    if ( N > 1 ) {
-        return derivative().derivative()(x);
-    } else {
-        return 0.0;
+/*****************************************************************************
+ * Implementation [Polynomial - Batch Evaluation]
+ ****************************************************************************/
+template <unsigned int N>
+void Polynomial<N>::evaluate(const double *x, const std::size_t n, double *values,
+                             double *first_derivatives, double *second_derivatives) const
+{
+    // a few simd packets wide, enough to hide the multiply-add latencies
+    typedef Eigen::Array<double,8,1> Block;
+    typedef Eigen::Map<const Block> ConstBlockMap;
+    typedef Eigen::Map<Block> BlockMap;
+    const std::size_t block_size = Block::SizeAtCompileTime;
+    const std::size_t blocks_end = n - n % block_size; // the rest is done point by point
+    const double *a = &coeff[0];
+
+    if ( ( first_derivatives == NULL ) && ( second_derivatives == NULL ) ) {
+        if ( values == NULL ) {
+            return;
+        }
+        for ( std::size_t i = 0; i < blocks_end; i += block_size ) {
+            const Block xs = ConstBlockMap(x + i);
+            Block p = Block::Constant(a[N]);
+            geometry::Horner<N>::value(a, xs, p);
+            BlockMap(values + i) = p;
+        }
+        for ( std::size_t i = blocks_end; i < n; ++i ) {
+            values[i] = (*this)(x[i]);
+        }
+        return;
+    }
+    for ( std::size_t i = 0; i < blocks_end; i += block_size ) {
+        const Block xs = ConstBlockMap(x + i);
+        Block p = Block::Constant(a[N]);
+        Block d = Block::Zero();
+        Block dd = Block::Zero();
+        geometry::Horner<N>::derivatives(a, xs, p, d, dd);
+        if ( values != NULL ) { BlockMap(values + i) = p; }
+        if ( first_derivatives != NULL ) { BlockMap(first_derivatives + i) = d; }
+        if ( second_derivatives != NULL ) { BlockMap(second_derivatives + i) = 2.0*dd; }
+    }
+    for ( std::size_t i = blocks_end; i < n; ++i ) {
+        double p = a[N], d = 0.0, dd = 0.0;
+        geometry::Horner<N>::derivatives(a, x[i], p, d, dd);
+        if ( values != NULL ) { values[i] = p; }
+        if ( first_derivatives != NULL ) { first_derivatives[i] = d; }
+        if ( second_derivatives != NULL ) { second_derivatives[i] = 2.0*dd; }
     }
 }
 
@@ -118,6 +118,15 @@ public:
 	 * @return const Array<double>& : the discretised domain.
 	 */
 	const Array<double>& domain() const { return discretised_domain; }
+	/**
+	 * @brief The spline as a sequence of polynomials.
+	 *
+	 * One for each interval of the discretised domain, alternating between
+	 * the (promoted) linear segments and the quintic corners.
+	 *
+	 * @return Array<QuinticPolynomial> : the polynomials.
+	 */
+	Array<QuinticPolynomial> polynomials() const;
 
 	/*********************
 	 * Static Constructor
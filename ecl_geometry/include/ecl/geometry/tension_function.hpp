@@ -173,6 +173,20 @@ class ECL_PUBLIC TensionFunction : public BluePrintFactory< TensionFunction > {
          * @return double : the value of the 2nd derivative at x for tension tau.
          */
         double dderivative(const double &tau, const double &x) const;
+        /**
+         * @brief Value and derivatives for a certain tension at the specified point.
+         *
+         * Cheaper than calling each of them separately as the hyperbolic
+         * terms are shared.
+         *
+         * @param tau : the tension parameter.
+         * @param x : the point at which you wish to calculate the values for.
+         * @param value : the value at x.
+         * @param first_derivative : the derivative at x.
+         * @param second_derivative : the 2nd derivative at x.
+         */
+        void evaluate(const double &tau, const double &x, double &value,
+                      double &first_derivative, double &second_derivative) const;
 
         /*********************
         ** Accessors
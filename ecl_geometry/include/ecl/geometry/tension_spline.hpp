@@ -185,6 +185,20 @@ class ecl_geometry_PUBLIC TensionSpline : public BluePrintFactory< TensionSpline
          * @return const Array<double>& : the discretised domain.
          */
         const Array<double>& domain() const { return discretised_domain; }
+        /**
+         * @brief The tension functions constituting this spline.
+         *
+         * One for each interval of the discretised domain.
+         *
+         * @return const Array<TensionFunction>& : the tension functions.
+         */
+        const Array<TensionFunction>& functions() const { return tension_functions; }
+        /**
+         * @brief The tension parameter used by all of the tension functions.
+         *
+         * @return const double& : the tension (tau).
+         */
+        const double& tension() const { return tau; }
 
         /******************************************
         ** Streaming
@@ -206,8 +220,8 @@ class ecl_geometry_PUBLIC TensionSpline : public BluePrintFactory< TensionSpline
 
     private:
         Array<double> discretised_domain;           // N+1 x_i's
-        Array<TensionFunction> functions;   // N tension_functions
-        double tension;
+        Array<TensionFunction> tension_functions;   // N tension_functions
+        double tau;
 };
 
 /*****************************************************************************
@@ -223,8 +237,8 @@ OutputStream& operator << (OutputStream &ostream, const TensionSpline &tension_s
 
 	ecl_compile_time_concept_check(ecl::StreamConcept<OutputStream>);
 
-    for ( unsigned int i = 0; i < tension_spline.functions.size(); ++i ) {
-        ostream << tension_spline.functions[i] << "\n";
+    for ( unsigned int i = 0; i < tension_spline.tension_functions.size(); ++i ) {
+        ostream << tension_spline.tension_functions[i] << "\n";
     }
     ostream.flush();
     return ostream;
@@ -296,6 +310,17 @@ class ecl_geometry_PUBLIC C2TensionSpline : public ecl::BluePrint<C2TensionSplin
          */
         void apply(base_type& spline) const;
 
+        /**
+         * @brief The second derivatives solved for at each via point.
+         *
+         * These are also the largest second derivatives on each interval,
+         * so this is a cheap way of checking a spline's accelerations
+         * without applying the blueprint.
+         *
+         * @return const Array<double>& : the second derivatives (zero at the end points).
+         */
+        const ecl::Array<double>& secondDerivatives() const { return yddot_data; }
+
     private:
         ecl::Array<double> x_data;
         ecl::Array<double> y_data;
@@ -0,0 +1,217 @@
+/**
+ * @file /include/ecl/geometry/trajectory_buffer.hpp
+ *
+ * @brief Growable and sliding window storage for trajectories.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_ODOMETRY_TRAJECTORY_BUFFER_HPP_
+#define ECL_ODOMETRY_TRAJECTORY_BUFFER_HPP_
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <algorithm>
+#include <ecl/config/macros.hpp>
+#include <ecl/exceptions/macros.hpp>
+#include <ecl/exceptions/standard_exception.hpp>
+#include "odometry_typedefs.hpp"
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+namespace odometry {
+
+/*****************************************************************************
+** Enums
+*****************************************************************************/
+/**
+ * @brief What a trajectory buffer does when it runs out of room.
+ */
+enum TrajectoryBufferMode {
+  GrowingBuffer, /**< @brief Reallocate with double the capacity, keeping everything. **/
+  SlidingWindow  /**< @brief Keep only the most recent capacity columns. **/
+};
+
+/*****************************************************************************
+** Interface [TrajectoryBuffer]
+*****************************************************************************/
+/**
+ * @brief Column major trajectory storage with amortised constant time appends.
+ *
+ * Appending to a Trajectory2D or Odom2DTrajectory with addAtEnd() or
+ * resize() reallocates and copies the whole matrix every time, so
+ * recording a trail of odometry that way is quadratic. This keeps spare
+ * capacity around instead, either doubling it when it runs out
+ * (GrowingBuffer) or, for a sliding window of the most recent odometry,
+ * dropping the oldest columns (SlidingWindow).
+ *
+ * Columns are always stored contiguously, so view() can hand out an
+ * Eigen::Map of the contents without copying. The odometry helpers all
+ * have overloads for these views.
+ *
+ * A sliding window keeps room for twice its capacity. Appends write at
+ * the end of the storage and only once it is full are the retained
+ * columns moved back to the front - once every capacity appends.
+ *
+ * <b>Usage:</b>
+ *
+ * @code
+ * Odom2DTrajectoryBuffer recent(500, SlidingWindow);
+ * while ( running ) {
+ *     recent.push_back(odometry);
+ *     Trajectory2D poses = getPoses(recent.view());
+ * }
+ * @endcode
+ *
+ * @tparam Rows : number of rows in each column, 3 for poses and twists, 6 for odometry.
+ **/
+template <int Rows>
+class TrajectoryBuffer {
+public:
+  typedef Eigen::Matrix<float, Rows, Eigen::Dynamic> Matrix; /**< @brief The matrix type being buffered. **/
+  typedef Eigen::Matrix<float, Rows, 1> Column; /**< @brief A single column (pose, twist or odometry). **/
+  typedef Eigen::Map<const Matrix> ConstView; /**< @brief Read only view of the buffered columns. **/
+
+  /**
+   * @brief Configure the buffer.
+   *
+   * @param capacity : initial capacity (growing), or window size (sliding).
+   * @param mode : growing or sliding window.
+   * @exception : StandardException : throws if a sliding window has no capacity [debug mode only].
+   */
+  TrajectoryBuffer(const int& capacity = 0, const TrajectoryBufferMode& mode = GrowingBuffer) :
+    buffer_mode(mode),
+    window(capacity),
+    first(0),
+    last(0)
+  {
+    ecl_assert_throw( (mode == GrowingBuffer) || (capacity > 0),
+                     StandardException(LOC, InvalidInputError, "A sliding window needs a capacity."));
+    storage.resize(Eigen::NoChange, (mode == SlidingWindow) ? 2 * capacity : capacity);
+  }
+
+  /**
+   * @brief Make room for at least capacity columns without reallocating.
+   *
+   * Only growing buffers are affected, a sliding window's capacity is
+   * fixed on construction.
+   *
+   * @param capacity : number of columns to make room for.
+   */
+  void reserve(const int& capacity) {
+    if ( (buffer_mode == GrowingBuffer) && (capacity > storage.cols()) ) {
+      storage.conservativeResize(Eigen::NoChange, capacity);
+    }
+  }
+
+  /**
+   * @brief Append a single column.
+   *
+   * @param column : the pose, twist or odometry to append.
+   */
+  void push_back(const Column& column) {
+    if ( last == storage.cols() ) {
+      makeRoom(1);
+    }
+    storage.col(last++) = column;
+    if ( (buffer_mode == SlidingWindow) && (last - first > window) ) {
+      ++first;
+    }
+  }
+
+  /**
+   * @brief Append all the columns of a matrix.
+   *
+   * A sliding window only keeps the trailing columns that fit.
+   *
+   * @param columns : a Rows x n matrix (or expression).
+   */
+  template <typename Derived>
+  void append(const Eigen::MatrixBase<Derived>& columns) {
+    const int count = columns.cols();
+    if ( (buffer_mode == SlidingWindow) && (count >= window) ) {
+      storage.leftCols(window) = columns.rightCols(window);
+      first = 0;
+      last = window;
+      return;
+    }
+    if ( last + count > storage.cols() ) {
+      makeRoom(count);
+    }
+    storage.middleCols(last, count) = columns;
+    last += count;
+    if ( (buffer_mode == SlidingWindow) && (last - first > window) ) {
+      first = last - window;
+    }
+  }
+
+  /**
+   * @brief Drop all columns, keeping the capacity.
+   */
+  void clear() {
+    first = 0;
+    last = 0;
+  }
+
+  /**
+   * @brief Zero copy view of the buffered columns, oldest first.
+   *
+   * The view is invalidated by the next append.
+   *
+   * @return ConstView : map over the buffer's storage.
+   */
+  ConstView view() const {
+    return ConstView(storage.data() + first * Rows, Rows, last - first);
+  }
+
+  int size() const { return last - first; } /**< @brief Number of buffered columns. **/
+  bool empty() const { return last == first; } /**< @brief No columns buffered. **/
+  int capacity() const { return (buffer_mode == SlidingWindow) ? window : storage.cols(); } /**< @brief Columns that fit without reallocating (or dropping). **/
+  const TrajectoryBufferMode& mode() const { return buffer_mode; } /**< @brief Growing or sliding window. **/
+
+private:
+  /**
+   * Sliding windows shift the retained columns back to the front, growing
+   * buffers double their capacity.
+   */
+  void makeRoom(const int& count) {
+    if ( buffer_mode == SlidingWindow ) {
+      // never holds more than the window, so first > 0 here and the
+      // overlapping copy runs towards the front, which std::copy allows
+      std::copy(storage.data() + first * Rows, storage.data() + last * Rows, storage.data());
+      last -= first;
+      first = 0;
+    } else {
+      storage.conservativeResize(Eigen::NoChange, std::max<Eigen::Index>(std::max<Eigen::Index>(2 * storage.cols(), last + count), 16));
+    }
+  }
+
+  TrajectoryBufferMode buffer_mode;
+  int window;
+  int first, last; // buffered columns are [first, last) of the storage
+  Matrix storage;
+};
+
+/*****************************************************************************
+** Typedefs
+*****************************************************************************/
+
+typedef TrajectoryBuffer<3> Trajectory2DBuffer; /**< @brief Buffer of 2D poses, see Trajectory2D. **/
+typedef TrajectoryBuffer<6> Odom2DTrajectoryBuffer; /**< @brief Buffer of 2D odometries, see Odom2DTrajectory. **/
+
+/*****************************************************************************
+** Trailers
+*****************************************************************************/
+
+} // namespace odometry
+} // namespace ecl
+
+#endif /* ECL_ODOMETRY_TRAJECTORY_BUFFER_HPP_ */
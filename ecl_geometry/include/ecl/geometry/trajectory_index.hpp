@@ -0,0 +1,169 @@
+/**
+ * @file /include/ecl/geometry/trajectory_index.hpp
+ *
+ * @brief Spatial index for repeated point to trajectory distance queries.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_ODOMETRY_TRAJECTORY_INDEX_HPP_
+#define ECL_ODOMETRY_TRAJECTORY_INDEX_HPP_
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <vector>
+#include <ecl/config/macros.hpp>
+#include "macros.hpp"
+#include "odometry_typedefs.hpp"
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+namespace odometry {
+
+/*****************************************************************************
+** Interface [TrajectoryIndex]
+*****************************************************************************/
+/**
+ * @brief Nearest segment and distance queries against a fixed trajectory.
+ *
+ * The distance() helper scans every segment of the trajectory on every call.
+ * This index is built once for a trajectory and then answers the same
+ * question in (roughly) logarithmic time by bucketing the segments into a
+ * uniform grid and searching outwards from the query position's cell,
+ * ring by ring, until no unvisited cell could hold anything closer.
+ *
+ * Trajectories with fewer than brute_force_threshold segments skip the
+ * grid altogether - for those a vectorised scan over all of the segments
+ * is faster than any search.
+ *
+ * Path followers usually want the segment closest to where they were last
+ * cycle rather than the globally closest one (think of paths that loop back
+ * on themselves). The incremental nearestSegment() overload searches a window
+ * of segments around a previous hit and slides it while it keeps finding
+ * closer segments, which is also cheaper than a search of the whole grid.
+ *
+ * Queries are const and do not allocate, so a single index may be shared by
+ * multiple threads.
+ *
+ * <b>Usage:</b>
+ *
+ * @code
+ * TrajectoryIndex index(path);
+ * int segment = index.nearestSegment(getPosition(robot_pose));
+ * while ( following ) {
+ *     segment = index.nearestSegment(getPosition(robot_pose), segment);
+ *     double error = std::sqrt(index.squaredDistance(getPosition(robot_pose), segment));
+ *     // ...
+ * }
+ * @endcode
+ *
+ * @sa distance(const Position2D&, const Trajectory2D&).
+ **/
+class ecl_geometry_PUBLIC TrajectoryIndex {
+public:
+  static const int brute_force_threshold = 64; /**< @brief Trajectories with fewer segments are only ever scanned. **/
+
+  TrajectoryIndex(); /**< @brief Empty index, call build() before querying. **/
+  /**
+   * @brief Index the segments between consecutive poses of the trajectory.
+   *
+   * @param trajectory : the trajectory to index, it is copied.
+   */
+  TrajectoryIndex(const Trajectory2D& trajectory);
+  TrajectoryIndex(const Trajectory2DView& trajectory); /**< @brief Index the segments of a trajectory view, e.g. a TrajectoryBuffer's. **/
+
+  /**
+   * @brief Discard the current index and index a new trajectory.
+   *
+   * A trajectory with a single pose gets a single (zero length) segment,
+   * an empty trajectory gets none.
+   *
+   * @param trajectory : the trajectory to index, it is copied.
+   */
+  void build(const Trajectory2D& trajectory);
+  void build(const Trajectory2DView& trajectory); /**< @brief Discard the current index and index a trajectory view. **/
+
+  /**
+   * @brief Index of the segment closest to the position.
+   *
+   * Segment i runs from pose i to pose i+1 of the trajectory.
+   *
+   * @param position : query position.
+   * @return int : closest segment, or -1 if the index is empty.
+   */
+  int nearestSegment(const Position2D& position) const;
+  /**
+   * @brief Index of the closest segment, searching near a previous hit.
+   *
+   * Scans the segments within window of the previous hit. If the closest
+   * of those sits at either edge of the window, the search slides further
+   * in that direction for as long as it keeps getting closer. This tracks
+   * the local minimum, so it won't jump to another part of the path that
+   * happens to pass closer by.
+   *
+   * @param position : query position.
+   * @param previous : the segment returned by the last query.
+   * @param window : number of segments either side of previous to scan.
+   * @return int : closest segment, or -1 if the index is empty.
+   */
+  int nearestSegment(const Position2D& position, const int& previous, const int& window = 16) const;
+
+  /**
+   * @brief Shortest distance between the position and the trajectory.
+   *
+   * Same result as distance(const Position2D&, const Trajectory2D&), but
+   * computed in single precision.
+   *
+   * @param position : query position.
+   * @return double : the distance, or infinity if the index is empty.
+   */
+  double distance(const Position2D& position) const;
+  double distance(const Pose2D& pose) const; /**< @brief Shortest distance between the pose's position and the trajectory. **/
+
+  /**
+   * @brief Squared distance between the position and a single segment.
+   *
+   * @param position : query position.
+   * @param segment : index of the segment.
+   * @return double : the squared distance.
+   * @exception : StandardException : throws if the segment is out of range [debug mode only].
+   */
+  double squaredDistance(const Position2D& position, const int& segment) const;
+
+  int segments() const { return number_of_segments; } /**< @brief Number of indexed segments. **/
+
+private:
+  typedef Eigen::Array<float, 8, 1> Block;
+
+  int scan(const float& x, const float& y, const int& first, const int& last, float& squared_distance) const;
+  int search(const float& x, const float& y, float& squared_distance) const;
+  void searchCell(const float& x, const float& y, const int& cell, int& nearest, float& squared_distance) const;
+  void cellsCrossed(const int& segment, std::vector<int>& cells) const;
+
+  int number_of_segments;
+  // segment starts, directions and inverse squared lengths, stored as
+  // separate arrays so that scans are contiguous and vectorise.
+  Eigen::ArrayXf x_starts, y_starts, x_deltas, y_deltas, inverse_squared_lengths;
+  // uniform grid, segments listed for every cell they pass through
+  float x_min, y_min, cell_size, inverse_cell_size;
+  int columns, rows;
+  std::vector<int> cell_offsets; // cell i's segments are [ cell_offsets[i], cell_offsets[i+1] )
+  std::vector<int> cell_segments;
+};
+
+/*****************************************************************************
+** Trailers
+*****************************************************************************/
+
+} // namespace odometry
+} // namespace ecl
+
+#endif /* ECL_ODOMETRY_TRAJECTORY_INDEX_HPP_ */
@@ -13,6 +13,7 @@
 ** Includes
 *****************************************************************************/
 
+#include <algorithm>
 #include <ecl/exceptions/standard_exception.hpp>
 #include "../../include/ecl/geometry/cubic_spline.hpp"
 
@@ -28,29 +29,93 @@ namespace ecl {
 
 double CubicSpline::operator()(const double &x) const {
     ecl_assert_throw( ( ( x >= discretised_domain.front() ) && ( x <= discretised_domain.back() ) ), StandardException(LOC,OutOfRangeError) );
-    int index = 0;
-    while ( x > discretised_domain[index+1] ) {
-        ++index;
-    }
-    return cubic_polynomials[index](x);
+    const double *c = &coefficients[stride*segment(x)];
+    return ((c[3]*x + c[2])*x + c[1])*x + c[0];
 }
 
 double CubicSpline::derivative(double x) const {
     ecl_assert_throw( ( ( x >= discretised_domain.front() ) && ( x <= discretised_domain.back() ) ), StandardException(LOC,OutOfRangeError) );
-    int index = 0;
-    while ( x > discretised_domain[index+1] ) {
-        ++index;
-    }
-    return cubic_polynomials[index].derivative()(x);
+    const double *c = &coefficients[stride*segment(x) + 4];
+    return (c[2]*x + c[1])*x + c[0];
 }
 
 double CubicSpline::dderivative(double x) const {
     ecl_assert_throw( ( ( x >= discretised_domain.front() ) && ( x <= discretised_domain.back() ) ), StandardException(LOC,OutOfRangeError) );
-    int index = 0;
-    while ( x > discretised_domain[index+1] ) {
-        ++index;
+    const double *c = &coefficients[stride*segment(x) + 7];
+    return c[1]*x + c[0];
+}
+
+void CubicSpline::evaluate(const Array<double>& xs, Array<double>& ys) const {
+    const unsigned int n = xs.size();
+    ys.resize(n);
+    if ( n == 0 ) {
+        return;
+    }
+    const double *x = &xs[0];
+    double *y = &ys[0];
+    const double *knots = &discretised_domain[0];
+    unsigned int i = 0;
+    while ( i < n ) {
+        ecl_assert_throw( ( ( x[i] >= discretised_domain.front() ) && ( x[i] <= discretised_domain.back() ) ), StandardException(LOC,OutOfRangeError) );
+        const unsigned int index = segment(x[i]);
+        // the run of (increasing) points in this segment
+        const double upper = knots[index+1];
+        const double lower = x[i];
+        unsigned int end = i + 1;
+        while ( ( end < n ) && ( x[end] >= lower ) && ( x[end] <= upper ) ) {
+            ++end;
+        }
+        const double c0 = coefficients[stride*index];
+        const double c1 = coefficients[stride*index+1];
+        const double c2 = coefficients[stride*index+2];
+        const double c3 = coefficients[stride*index+3];
+        for ( unsigned int k = i; k < end; ++k ) {
+            y[k] = ((c3*x[k] + c2)*x[k] + c1)*x[k] + c0;
+        }
+        i = end;
+    }
+}
+
+/*****************************************************************************
+** Implementation [Private]
+*****************************************************************************/
+
+/**
+ * Segment i covers (x_i, x_i+1], the first also includes x_0.
+ */
+unsigned int CubicSpline::segment(const double &x) const {
+    const unsigned int last = cubic_polynomials.size() - 1;
+    unsigned int index = hint.load();
+    if ( index <= last ) {
+        if ( x <= discretised_domain[index+1] ) {
+            if ( ( index == 0 ) || ( x > discretised_domain[index] ) ) {
+                return index;
+            }
+        } else if ( ( index < last ) && ( x <= discretised_domain[index+2] ) ) {
+            hint.store(index+1);
+            return index+1;
+        }
+    }
+    const double *begin = &discretised_domain[0] + 1;
+    const double *end = begin + last + 1;
+    index = std::lower_bound(begin, end, x) - begin;
+    if ( index > last ) {
+        index = last; // beyond the domain (release mode)
+    }
+    hint.store(index);
+    return index;
+}
+
+void CubicSpline::tabulate() {
+    coefficients.resize(stride*cubic_polynomials.size());
+    for ( unsigned int i = 0; i < cubic_polynomials.size(); ++i ) {
+        const CubicPolynomial::Coefficients &a = cubic_polynomials[i].coefficients();
+        double *c = &coefficients[stride*i];
+        c[0] = a[0]; c[1] = a[1]; c[2] = a[2]; c[3] = a[3];
+        c[4] = a[1]; c[5] = 2*a[2]; c[6] = 3*a[3];
+        c[7] = 2*a[2]; c[8] = 6*a[3];
     }
-    return cubic_polynomials[index].derivative().derivative()(x);
+    hint.store(0);
 }
 
 } // namespace ecl
@@ -131,6 +131,7 @@ void C2CubicSpline::apply(ecl::CubicSpline& spline) const {
                         x_data[i],   y_data[i],   yddot_data[i],
                         x_data[i+1], y_data[i+1], yddot_data[i+1]  );
     }
+    spline.tabulate();
 }
 
 
@@ -173,6 +174,7 @@ void DerivativeHeuristicCubicSpline::apply(ecl::CubicSpline& spline) const {
                         x_data[i],   y_data[i],   ydot_data[i],
                         x_data[i+1], y_data[i+1], ydot_data[i+1]  );
     }
+    spline.tabulate();
 }
 
 } // namespace blueprints
@@ -26,6 +26,16 @@ double distance(const Pose2D& pose, const Trajectory2D& trajectory)
 }
 
 double distance(const Position2D& position, const Trajectory2D& trajectory)
+{
+  return distance(position, Trajectory2DView(trajectory.data(), trajectory.rows(), trajectory.cols()));
+}
+
+double distance(const Pose2D& pose, const Trajectory2DView& trajectory)
+{
+  return distance(getPosition(pose), trajectory);
+}
+
+double distance(const Position2D& position, const Trajectory2DView& trajectory)
 {
   Position2D segment_start = trajectory.topLeftCorner<2, 1>();
 
@@ -75,6 +85,26 @@ int size(const Odom2DTrajectory& trajectory)
   return trajectory.cols();
 }
 
+bool empty(const Trajectory2DView& trajectory)
+{
+  return size(trajectory) == 0;
+}
+
+bool empty(const Odom2DTrajectoryView& trajectory)
+{
+  return size(trajectory) == 0;
+}
+
+int size(const Trajectory2DView& trajectory)
+{
+  return trajectory.cols();
+}
+
+int size(const Odom2DTrajectoryView& trajectory)
+{
+  return trajectory.cols();
+}
+
 double distance(const Odom2D& a, const Odom2D& b)
 {
   return (getPosition(a) - getPosition(b)).norm();
@@ -108,7 +138,8 @@ void addAtEnd(Trajectory2D& target, const Trajectory2D& addition)
     return;
   }
 
-  target << addition;
+  resize(target, size(target) + size(addition));
+  target.rightCols(size(addition)) = addition;
 }
 
 void addAtEnd(Odom2DTrajectory& target, const Odom2DTrajectory& addition)
@@ -119,7 +150,8 @@ void addAtEnd(Odom2DTrajectory& target, const Odom2DTrajectory& addition)
     return;
   }
 
-  target << addition;
+  resize(target, size(target) + size(addition));
+  target.rightCols(size(addition)) = addition;
 }
 
 Trajectory2D vectorToTrajectory(const std::vector<Pose2D>& vec)
@@ -178,6 +210,16 @@ Odom2D getAt(const Odom2DTrajectory& trajectory, const int& index)
   return trajectory.col(index);
 }
 
+Pose2D getAt(const Trajectory2DView& trajectory, const int& index)
+{
+  return trajectory.col(index);
+}
+
+Odom2D getAt(const Odom2DTrajectoryView& trajectory, const int& index)
+{
+  return trajectory.col(index);
+}
+
 Pose2D getFront(const Trajectory2D& trajectory)
 {
   return trajectory.leftCols<1>();
@@ -198,6 +240,26 @@ Odom2D getBack(const Odom2DTrajectory& trajectory)
   return trajectory.rightCols<1>();
 }
 
+Pose2D getFront(const Trajectory2DView& trajectory)
+{
+  return trajectory.leftCols<1>();
+}
+
+Pose2D getBack(const Trajectory2DView& trajectory)
+{
+  return trajectory.rightCols<1>();
+}
+
+Odom2D getFront(const Odom2DTrajectoryView& trajectory)
+{
+  return trajectory.leftCols<1>();
+}
+
+Odom2D getBack(const Odom2DTrajectoryView& trajectory)
+{
+  return trajectory.rightCols<1>();
+}
+
 Trajectory2D getPoses(const Odom2DTrajectory& trajectory)
 {
   return trajectory.topRows<3>();
@@ -208,6 +270,16 @@ Twist2DVector getTwists(const Odom2DTrajectory& trajectory)
   return trajectory.bottomRows<3>();
 }
 
+Trajectory2D getPoses(const Odom2DTrajectoryView& trajectory)
+{
+  return trajectory.topRows<3>();
+}
+
+Twist2DVector getTwists(const Odom2DTrajectoryView& trajectory)
+{
+  return trajectory.bottomRows<3>();
+}
+
 void setVelocityX(Odom2D& odom, const float& value)
 {
   odom(3) = value;
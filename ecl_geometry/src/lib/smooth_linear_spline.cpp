@@ -148,6 +148,18 @@ double SmoothLinearSpline::dderivative(const double &x) const {
     }
 }
 
+Array<QuinticPolynomial> SmoothLinearSpline::polynomials() const {
+    Array<QuinticPolynomial> pieces(discretised_domain.size() - 1);
+    for ( unsigned int i = 0; i < pieces.size(); ++i ) {
+        if ( i % 2 == 0 ) { // linear
+            pieces[i].coefficients() << segments[i/2].coefficients()[0], segments[i/2].coefficients()[1], 0.0, 0.0, 0.0, 0.0;
+        } else { // quintic
+            pieces[i] = corners[(i-1)/2];
+        }
+    }
+    return pieces;
+}
+
 } // namespace ecl
 
 
@@ -51,6 +51,22 @@ double TensionFunction::operator ()(const double &tau, const double &x) const {
     return value;
 }
 
+void TensionFunction::evaluate(const double &tau, const double &x, double &value,
+                               double &first_derivative, double &second_derivative) const {
+    const double h = x_f-x_0;
+    const double tau_squared = tau*tau;
+    // two exponentials cover all the hyperbolic terms, (x_f-x) + (x-x_0) = h
+    const double exp_f = exp(tau*(x_f-x)), exp_0 = exp(tau*(x-x_0)), exp_h = exp_f*exp_0;
+    const double sinh_h = 0.5*(exp_h - 1.0/exp_h);
+    const double sinh_f = 0.5*(exp_f - 1.0/exp_f), cosh_f = 0.5*(exp_f + 1.0/exp_f);
+    const double sinh_0 = 0.5*(exp_0 - 1.0/exp_0), cosh_0 = 0.5*(exp_0 + 1.0/exp_0);
+    const double slope_0 = (y_0-z_0/tau_squared)/h;
+    const double slope_f = (y_f-z_f/tau_squared)/h;
+    value = (z_0*sinh_f + z_f*sinh_0)/(tau_squared*sinh_h) + slope_0*(x_f-x) + slope_f*(x-x_0);
+    first_derivative = (-1.0*z_0*cosh_f + z_f*cosh_0)/(tau*sinh_h) - slope_0 + slope_f;
+    second_derivative = (z_0*sinh_f + z_f*sinh_0)/sinh_h;
+}
+
 namespace blueprints {
 
 using ecl::TensionFunction;
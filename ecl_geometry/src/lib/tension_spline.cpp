@@ -32,7 +32,7 @@ double TensionSpline::operator()(const double &x) const {
     while ( x > discretised_domain[index+1] ) {
         ++index;
     }
-    return functions[index](tension,x);
+    return tension_functions[index](tau,x);
 }
 
 double TensionSpline::derivative(const double &x) const {
@@ -41,7 +41,7 @@ double TensionSpline::derivative(const double &x) const {
     while ( x > discretised_domain[index+1] ) {
         ++index;
     }
-    return functions[index].derivative(tension,x);
+    return tension_functions[index].derivative(tau,x);
 }
 
 double TensionSpline::dderivative(const double &x) const {
@@ -50,7 +50,7 @@ double TensionSpline::dderivative(const double &x) const {
     while ( x > discretised_domain[index+1] ) {
         ++index;
     }
-    return functions[index].dderivative(tension,x);
+    return tension_functions[index].dderivative(tau,x);
 }
 
 } // namespace ecl
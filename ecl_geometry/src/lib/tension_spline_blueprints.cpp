@@ -63,8 +63,12 @@ C2TensionSpline::C2TensionSpline(const ecl::Array<double>& x_set, const ecl::Arr
     h[0] = x_set[1] - x_set[0];
     for ( unsigned int i = 0; i < n; ++i ) {
         h[i] = x_set[i+1]-x_set[i];
-        a[i] = 1/h[i] - tension/sinh(tension*h[i]);
-        beta[i] = tension*(cosh(tension*h[i])/sinh(tension*h[i])) - 1/h[i];
+        // one exponential for both hyperbolics
+        double exponential = exp(tension*h[i]);
+        double sinh_h = 0.5*(exponential - 1/exponential);
+        double cosh_h = 0.5*(exponential + 1/exponential);
+        a[i] = 1/h[i] - tension/sinh_h;
+        beta[i] = tension*(cosh_h/sinh_h) - 1/h[i];
         gamma[i] = tension*tension*(y_data[i+1]-y_data[i])/h[i];
     }
     /*
@@ -104,10 +108,10 @@ TensionSpline C2TensionSpline::instantiate() {
 void C2TensionSpline::apply(TensionSpline& spline) const {
 
     spline.discretised_domain = x_data;
-    spline.tension = tension;
-    spline.functions.resize(x_data.size()-1); // One less polynomials than there is points
-    for (unsigned int i = 0; i < spline.functions.size(); ++i ) {
-        spline.functions[i] = TensionFunction::Interpolation(
+    spline.tau = tension;
+    spline.tension_functions.resize(x_data.size()-1); // One less polynomials than there is points
+    for (unsigned int i = 0; i < spline.tension_functions.size(); ++i ) {
+        spline.tension_functions[i] = TensionFunction::Interpolation(
                         x_data[i],   y_data[i],   yddot_data[i],
                         x_data[i+1], y_data[i+1], yddot_data[i+1]  );
     }
@@ -0,0 +1,445 @@
+/**
+ * @file /src/lib/trajectory_index.cpp
+ *
+ * @brief Spatial index for repeated point to trajectory distance queries.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <ecl/exceptions/macros.hpp>
+#include <ecl/exceptions/standard_exception.hpp>
+#include "../../include/ecl/geometry/trajectory_index.hpp"
+#include "../../include/ecl/geometry/odometry_helper.hpp"
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+namespace odometry {
+
+/*****************************************************************************
+** Static Variables
+*****************************************************************************/
+
+const int TrajectoryIndex::brute_force_threshold;
+
+/*****************************************************************************
+** Implementation
+*****************************************************************************/
+
+TrajectoryIndex::TrajectoryIndex() :
+  number_of_segments(0),
+  x_min(0.0f),
+  y_min(0.0f),
+  cell_size(1.0f),
+  inverse_cell_size(1.0f),
+  columns(0),
+  rows(0)
+{}
+
+TrajectoryIndex::TrajectoryIndex(const Trajectory2D& trajectory) :
+  number_of_segments(0),
+  x_min(0.0f),
+  y_min(0.0f),
+  cell_size(1.0f),
+  inverse_cell_size(1.0f),
+  columns(0),
+  rows(0)
+{
+  build(trajectory);
+}
+
+TrajectoryIndex::TrajectoryIndex(const Trajectory2DView& trajectory) :
+  number_of_segments(0),
+  x_min(0.0f),
+  y_min(0.0f),
+  cell_size(1.0f),
+  inverse_cell_size(1.0f),
+  columns(0),
+  rows(0)
+{
+  build(trajectory);
+}
+
+void TrajectoryIndex::build(const Trajectory2D& trajectory)
+{
+  build(Trajectory2DView(trajectory.data(), trajectory.rows(), trajectory.cols()));
+}
+
+void TrajectoryIndex::build(const Trajectory2DView& trajectory)
+{
+  const int poses = size(trajectory);
+  number_of_segments = ( poses > 1 ) ? poses - 1 : poses;
+  columns = 0;
+  rows = 0;
+  cell_offsets.clear();
+  cell_segments.clear();
+
+  x_starts.resize(number_of_segments);
+  y_starts.resize(number_of_segments);
+  x_deltas.resize(number_of_segments);
+  y_deltas.resize(number_of_segments);
+  inverse_squared_lengths.resize(number_of_segments);
+  float total_length = 0.0f;
+  for (int i = 0; i < number_of_segments; ++i)
+  {
+    const int end = ( poses > 1 ) ? i + 1 : i;
+    x_starts[i] = trajectory(0, i);
+    y_starts[i] = trajectory(1, i);
+    x_deltas[i] = trajectory(0, end) - trajectory(0, i);
+    y_deltas[i] = trajectory(1, end) - trajectory(1, i);
+    const float squared_length = x_deltas[i] * x_deltas[i] + y_deltas[i] * y_deltas[i];
+    // zero length segments project everything onto their start
+    inverse_squared_lengths[i] = ( squared_length > 0.0f ) ? 1.0f / squared_length : 0.0f;
+    total_length += std::sqrt(squared_length);
+  }
+  if (number_of_segments < brute_force_threshold)
+  {
+    return;
+  }
+
+  /*********************
+  ** Grid Dimensions
+  **********************/
+  // Cells about a segment long, so most segments only touch a few cells,
+  // but never more than a handful of cells per segment in total.
+  x_min = trajectory.row(0).minCoeff();
+  y_min = trajectory.row(1).minCoeff();
+  const float width = trajectory.row(0).maxCoeff() - x_min;
+  const float height = trajectory.row(1).maxCoeff() - y_min;
+  cell_size = std::max(total_length / number_of_segments, std::sqrt(width * height / (4.0f * number_of_segments)));
+  if (cell_size <= 0.0f)
+  {
+    cell_size = 1.0f;
+  }
+  inverse_cell_size = 1.0f / cell_size;
+  columns = static_cast<int>(width * inverse_cell_size) + 1;
+  rows = static_cast<int>(height * inverse_cell_size) + 1;
+
+  /*********************
+  ** Bucketing
+  **********************/
+  // two passes, count and then fill, so the buckets are one flat array
+  cell_offsets.assign(columns * rows + 1, 0);
+  std::vector<int> cells;
+  for (int pass = 0; pass < 2; ++pass)
+  {
+    std::vector<int> fill;
+    if (pass == 1)
+    {
+      for (unsigned int cell = 1; cell < cell_offsets.size(); ++cell)
+      {
+        cell_offsets[cell] += cell_offsets[cell - 1];
+      }
+      cell_segments.resize(cell_offsets.back());
+      fill.assign(cell_offsets.begin(), cell_offsets.end() - 1);
+    }
+    for (int i = 0; i < number_of_segments; ++i)
+    {
+      cellsCrossed(i, cells);
+      for (unsigned int k = 0; k < cells.size(); ++k)
+      {
+        if (pass == 0)
+        {
+          ++cell_offsets[cells[k] + 1];
+        }
+        else
+        {
+          cell_segments[fill[cells[k]]++] = i;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Walks the grid along the segment (Amanatides & Woo), so long diagonal
+ * segments only land in the cells they actually pass through rather than
+ * every cell of their bounding box. Where the segment passes through (or
+ * within rounding of) a corner, both of the corner's side cells are taken
+ * too - the search relies on every cell holding a piece of the segment
+ * listing it.
+ */
+void TrajectoryIndex::cellsCrossed(const int& segment, std::vector<int>& cells) const
+{
+  cells.clear();
+  const float x_start = (x_starts[segment] - x_min) * inverse_cell_size;
+  const float y_start = (y_starts[segment] - y_min) * inverse_cell_size;
+  const float x_delta = x_deltas[segment] * inverse_cell_size;
+  const float y_delta = y_deltas[segment] * inverse_cell_size;
+  int column = std::min(std::max(static_cast<int>(std::floor(x_start)), 0), columns - 1);
+  int row = std::min(std::max(static_cast<int>(std::floor(y_start)), 0), rows - 1);
+  const int last_column = std::min(std::max(static_cast<int>(std::floor(x_start + x_delta)), 0), columns - 1);
+  const int last_row = std::min(std::max(static_cast<int>(std::floor(y_start + y_delta)), 0), rows - 1);
+  const int column_step = ( last_column > column ) ? 1 : -1;
+  const int row_step = ( last_row > row ) ? 1 : -1;
+  // parameter along the segment at the next column/row boundary, and between boundaries
+  const float infinity = std::numeric_limits<float>::infinity();
+  const float t_column_delta = ( x_delta != 0.0f ) ? std::abs(1.0f / x_delta) : infinity;
+  const float t_row_delta = ( y_delta != 0.0f ) ? std::abs(1.0f / y_delta) : infinity;
+  float t_column = ( x_delta > 0.0f ) ? (column + 1 - x_start) * t_column_delta : (x_start - column) * t_column_delta;
+  float t_row = ( y_delta > 0.0f ) ? (row + 1 - y_start) * t_row_delta : (y_start - row) * t_row_delta;
+  // a thousandth of a cell, in units of the segment's parameter
+  const float corner = 1e-3f / std::max(std::max(std::abs(x_delta), std::abs(y_delta)), 1.0f);
+  cells.push_back(row * columns + column);
+  // every step moves closer to the last cell, so this always ends there
+  while ((column != last_column) || (row != last_row))
+  {
+    const bool columns_left = ( column != last_column );
+    const bool rows_left = ( row != last_row );
+    if (columns_left && rows_left && (std::abs(t_column - t_row) < corner))
+    {
+      cells.push_back(row * columns + column + column_step);
+      cells.push_back((row + row_step) * columns + column);
+      column += column_step;
+      row += row_step;
+      t_column += t_column_delta;
+      t_row += t_row_delta;
+    }
+    else if (columns_left && (!rows_left || (t_column < t_row)))
+    {
+      column += column_step;
+      t_column += t_column_delta;
+    }
+    else
+    {
+      row += row_step;
+      t_row += t_row_delta;
+    }
+    cells.push_back(row * columns + column);
+  }
+}
+
+int TrajectoryIndex::nearestSegment(const Position2D& position) const
+{
+  float squared_distance;
+  if (columns == 0)
+  {
+    return scan(getX(position), getY(position), 0, number_of_segments, squared_distance);
+  }
+  return search(getX(position), getY(position), squared_distance);
+}
+
+int TrajectoryIndex::nearestSegment(const Position2D& position, const int& previous, const int& window) const
+{
+  if (number_of_segments == 0)
+  {
+    return -1;
+  }
+  const float x = getX(position);
+  const float y = getY(position);
+  const int hint = std::min(std::max(previous, 0), number_of_segments - 1);
+  int first = std::max(hint - window, 0);
+  int last = std::min(hint + window + 1, number_of_segments);
+  float squared_distance;
+  int nearest = scan(x, y, first, last, squared_distance);
+  // slide down the path while the closest is still on the window's edge
+  while ((nearest == first) && (first > 0))
+  {
+    last = first;
+    first = std::max(first - window, 0);
+    float candidate_squared_distance;
+    const int candidate = scan(x, y, first, last, candidate_squared_distance);
+    if (candidate_squared_distance >= squared_distance)
+    {
+      break;
+    }
+    nearest = candidate;
+    squared_distance = candidate_squared_distance;
+  }
+  // and likewise up the path
+  last = std::min(hint + window + 1, number_of_segments);
+  while ((nearest == last - 1) && (last < number_of_segments))
+  {
+    first = last;
+    last = std::min(last + window, number_of_segments);
+    float candidate_squared_distance;
+    const int candidate = scan(x, y, first, last, candidate_squared_distance);
+    if (candidate_squared_distance >= squared_distance)
+    {
+      break;
+    }
+    nearest = candidate;
+    squared_distance = candidate_squared_distance;
+  }
+  return nearest;
+}
+
+double TrajectoryIndex::distance(const Position2D& position) const
+{
+  float squared_distance;
+  if (columns == 0)
+  {
+    scan(getX(position), getY(position), 0, number_of_segments, squared_distance);
+  }
+  else
+  {
+    search(getX(position), getY(position), squared_distance);
+  }
+  return std::sqrt(static_cast<double>(squared_distance));
+}
+
+double TrajectoryIndex::distance(const Pose2D& pose) const
+{
+  return distance(getPosition(pose));
+}
+
+double TrajectoryIndex::squaredDistance(const Position2D& position, const int& segment) const
+{
+  ecl_assert_throw( (segment >= 0) && (segment < number_of_segments), StandardException(LOC, OutOfRangeError));
+  const float x = getX(position);
+  const float y = getY(position);
+  const float t = std::min(std::max(((x - x_starts[segment]) * x_deltas[segment] + (y - y_starts[segment]) * y_deltas[segment])
+                                    * inverse_squared_lengths[segment], 0.0f), 1.0f);
+  const float dx = x_starts[segment] + t * x_deltas[segment] - x;
+  const float dy = y_starts[segment] + t * y_deltas[segment] - y;
+  return dx * dx + dy * dy;
+}
+
+/**
+ * Brute force over segments [first, last), eight at a time, then a
+ * scalar tail.
+ */
+int TrajectoryIndex::scan(const float& x, const float& y, const int& first, const int& last, float& squared_distance) const
+{
+  int nearest = -1;
+  squared_distance = std::numeric_limits<float>::infinity();
+  const int blocks_end = last - (last - first) % Block::SizeAtCompileTime;
+  for (int i = first; i < blocks_end; i += Block::SizeAtCompileTime)
+  {
+    const Block x_offsets = x - x_starts.segment<Block::SizeAtCompileTime>(i);
+    const Block y_offsets = y - y_starts.segment<Block::SizeAtCompileTime>(i);
+    const Block x_block_deltas = x_deltas.segment<Block::SizeAtCompileTime>(i);
+    const Block y_block_deltas = y_deltas.segment<Block::SizeAtCompileTime>(i);
+    const Block t = ((x_offsets * x_block_deltas + y_offsets * y_block_deltas)
+        * inverse_squared_lengths.segment<Block::SizeAtCompileTime>(i)).max(0.0f).min(1.0f);
+    const Block squared_distances = (t * x_block_deltas - x_offsets).square() + (t * y_block_deltas - y_offsets).square();
+    int index;
+    const float block_minimum = squared_distances.minCoeff(&index);
+    if (block_minimum < squared_distance)
+    {
+      squared_distance = block_minimum;
+      nearest = i + index;
+    }
+  }
+  for (int i = blocks_end; i < last; ++i)
+  {
+    const float x_offset = x - x_starts[i];
+    const float y_offset = y - y_starts[i];
+    const float t = std::min(std::max((x_offset * x_deltas[i] + y_offset * y_deltas[i]) * inverse_squared_lengths[i], 0.0f), 1.0f);
+    const float dx = t * x_deltas[i] - x_offset;
+    const float dy = t * y_deltas[i] - y_offset;
+    const float candidate = dx * dx + dy * dy;
+    if (candidate < squared_distance)
+    {
+      squared_distance = candidate;
+      nearest = i;
+    }
+  }
+  return nearest;
+}
+
+void TrajectoryIndex::searchCell(const float& x, const float& y, const int& cell, int& nearest, float& squared_distance) const
+{
+  for (int k = cell_offsets[cell]; k < cell_offsets[cell + 1]; ++k)
+  {
+    const int i = cell_segments[k];
+    const float x_offset = x - x_starts[i];
+    const float y_offset = y - y_starts[i];
+    const float t = std::min(std::max((x_offset * x_deltas[i] + y_offset * y_deltas[i]) * inverse_squared_lengths[i], 0.0f), 1.0f);
+    const float dx = t * x_deltas[i] - x_offset;
+    const float dy = t * y_deltas[i] - y_offset;
+    const float candidate = dx * dx + dy * dy;
+    if ((candidate < squared_distance) || ((candidate == squared_distance) && (i < nearest)))
+    {
+      squared_distance = candidate;
+      nearest = i;
+    }
+  }
+}
+
+/**
+ * Visits the grid in square rings around the query's cell. Anything not
+ * yet visited lies beyond the sides of the visited square (those sides
+ * that aren't the edge of the grid), so the search can stop once the
+ * closest side is further away than the best hit so far.
+ */
+int TrajectoryIndex::search(const float& x, const float& y, float& squared_distance) const
+{
+  const int column = std::min(std::max(static_cast<int>(std::floor((x - x_min) * inverse_cell_size)), 0), columns - 1);
+  const int row = std::min(std::max(static_cast<int>(std::floor((y - y_min) * inverse_cell_size)), 0), rows - 1);
+  int nearest = -1;
+  squared_distance = std::numeric_limits<float>::infinity();
+  for (int ring = 0; ; ++ring)
+  {
+    const int left = column - ring;
+    const int right = column + ring;
+    const int bottom = row - ring;
+    const int top = row + ring;
+    if (ring == 0)
+    {
+      searchCell(x, y, row * columns + column, nearest, squared_distance);
+    }
+    else
+    {
+      for (int c = std::max(left, 0); c <= std::min(right, columns - 1); ++c)
+      {
+        if (bottom >= 0)
+        {
+          searchCell(x, y, bottom * columns + c, nearest, squared_distance);
+        }
+        if (top < rows)
+        {
+          searchCell(x, y, top * columns + c, nearest, squared_distance);
+        }
+      }
+      for (int r = std::max(bottom + 1, 0); r <= std::min(top - 1, rows - 1); ++r)
+      {
+        if (left >= 0)
+        {
+          searchCell(x, y, r * columns + left, nearest, squared_distance);
+        }
+        if (right < columns)
+        {
+          searchCell(x, y, r * columns + right, nearest, squared_distance);
+        }
+      }
+    }
+    float bound = std::numeric_limits<float>::infinity();
+    if (left > 0)
+    {
+      bound = std::min(bound, x - (x_min + left * cell_size));
+    }
+    if (right < columns - 1)
+    {
+      bound = std::min(bound, x_min + (right + 1) * cell_size - x);
+    }
+    if (bottom > 0)
+    {
+      bound = std::min(bound, y - (y_min + bottom * cell_size));
+    }
+    if (top < rows - 1)
+    {
+      bound = std::min(bound, y_min + (top + 1) * cell_size - y);
+    }
+    if ((bound == std::numeric_limits<float>::infinity()) || (bound * bound >= squared_distance))
+    {
+      break;
+    }
+  }
+  return nearest;
+}
+
+/*****************************************************************************
+** Trailers
+*****************************************************************************/
+
+} // namespace odometry
+} // namespace ecl
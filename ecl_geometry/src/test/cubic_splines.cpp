@@ -165,6 +165,60 @@ TEST(CubicSplinesTests,naturalSpline) {
 //    }
 }
 
+TEST(CubicSplinesTests,lookupAndBatches) {
+    // many knots, compare against evaluating the segment polynomials directly
+    // (the coefficients are for absolute x, so expect cancellation errors far out)
+    const unsigned int n = 200;
+    Array<double> x_set(n);
+    Array<double> y_set(n);
+    for ( unsigned int i = 0; i < n; ++i ) {
+        x_set[i] = i + 0.3*( i % 3 );
+        y_set[i] = ( i % 7 ) - 3.0;
+    }
+    CubicSpline cubic = CubicSpline::Natural(x_set, y_set);
+    const Array<CubicPolynomial> &polynomials = cubic.polynomials();
+    const unsigned int samples = 1000;
+    Array<double> xs(samples);
+    for ( unsigned int i = 0; i < samples; ++i ) {
+        xs[i] = x_set.front() + i*(x_set.back() - x_set.front())/(samples - 1);
+    }
+    // the knots themselves belong to the segment on their left
+    for ( unsigned int i = 1; i < n; ++i ) {
+        EXPECT_NEAR(y_set[i], cubic(x_set[i]), 1e-6);
+        EXPECT_NEAR(polynomials[i-1].derivative(x_set[i]), cubic.derivative(x_set[i]), 1e-6);
+    }
+    EXPECT_NEAR(y_set[0], cubic(x_set[0]), 1e-6);
+    // in order, reversed and scattered lookups
+    for ( unsigned int pass = 0; pass < 3; ++pass ) {
+        for ( unsigned int j = 0; j < samples; ++j ) {
+            const unsigned int i = ( pass == 0 ) ? j : ( ( pass == 1 ) ? samples - 1 - j : ( j*7919 ) % samples );
+            const double x = xs[i];
+            unsigned int segment = 0;
+            while ( x > x_set[segment+1] ) { ++segment; }
+            EXPECT_NEAR(polynomials[segment](x), cubic(x), 1e-6);
+            EXPECT_NEAR(polynomials[segment].derivative(x), cubic.derivative(x), 1e-6);
+            EXPECT_NEAR(polynomials[segment].dderivative(x), cubic.dderivative(x), 1e-6);
+        }
+    }
+    // batches, in order and not
+    Array<double> ys;
+    cubic.evaluate(xs, ys);
+    ASSERT_EQ(samples, ys.size());
+    for ( unsigned int i = 0; i < samples; ++i ) {
+        EXPECT_NEAR(cubic(xs[i]), ys[i], 1e-6);
+    }
+    Array<double> scattered(5);
+    scattered << 150.0, 2.0, 2.5, 199.0, 0.0;
+    cubic.evaluate(scattered, ys);
+    ASSERT_EQ(5u, ys.size());
+    for ( unsigned int i = 0; i < 5; ++i ) {
+        EXPECT_NEAR(cubic(scattered[i]), ys[i], 1e-6);
+    }
+    // copies carry their own lookups
+    CubicSpline copy = cubic;
+    EXPECT_NEAR(cubic(100.5), copy(100.5), 1e-12);
+}
+
 /*****************************************************************************
 ** Main program
 *****************************************************************************/
@@ -12,9 +12,13 @@
 ** Includes
 *****************************************************************************/
 
+#include <algorithm>
+#include <cmath>
 #include <ecl/config/macros.hpp>
 #include <gtest/gtest.h>
 #include "../../include/ecl/geometry/odometry_helper.hpp"
+#include "../../include/ecl/geometry/trajectory_buffer.hpp"
+#include "../../include/ecl/geometry/trajectory_index.hpp"
 
 /*****************************************************************************
 ** Using
@@ -166,9 +170,120 @@ using namespace ecl::odometry;
 
     setAt(*odom_traj, 1, getFront(*odom_traj));
     EXPECT_EQ(getAt(*odom_traj, 1), getFront(*odom_traj));
+
+    Trajectory2D addition(3, 2);
+    addition << 1.0, 2.0,
+                3.0, 4.0,
+                5.0, 6.0;
+    addAtEnd(*trajectory, addition);
+    EXPECT_EQ(5, size(trajectory));
+    EXPECT_EQ(getAt(addition, 0), getAt(*trajectory, 3));
+    EXPECT_EQ(getBack(addition), getBack(*trajectory));
   }
 #endif
 
+  TEST(OdometryTests,trajectoryBuffers) {
+    Odom2DTrajectoryBuffer trail;
+    EXPECT_TRUE(trail.empty());
+    EXPECT_TRUE(empty(trail.view()));
+    for (int i = 0; i < 1000; ++i) {
+      Odom2D odom;
+      odom << i, -i, 0.0, 1.0, 0.0, 0.1;
+      trail.push_back(odom);
+    }
+    EXPECT_EQ(1000, trail.size());
+    EXPECT_LE(1000, trail.capacity());
+    EXPECT_EQ(1000, size(trail.view()));
+    EXPECT_EQ(999.0f, getX(getBack(trail.view())));
+    EXPECT_EQ(-10.0f, getY(getAt(trail.view(), 10)));
+    Trajectory2D poses = getPoses(trail.view());
+    EXPECT_EQ(getPose(getAt(trail.view(), 500)), getAt(poses, 500));
+
+    Trajectory2DBuffer window(100, SlidingWindow);
+    EXPECT_EQ(100, window.capacity());
+    for (int i = 0; i < 1050; ++i) {
+      window.push_back(Pose2D(i, 0.0, 0.0));
+      EXPECT_EQ(std::min(i + 1, 100), window.size());
+      EXPECT_EQ(static_cast<float>(i), getX(getBack(window.view())));
+      EXPECT_EQ(static_cast<float>(std::max(i - 99, 0)), getX(getFront(window.view())));
+    }
+    window.append(poses.leftCols(30));
+    EXPECT_EQ(100, window.size());
+    EXPECT_EQ(980.0f, getX(getFront(window.view())));
+    EXPECT_EQ(getAt(poses, 29), getBack(window.view()));
+    window.append(poses);
+    EXPECT_EQ(100, window.size());
+    EXPECT_EQ(getBack(poses), getBack(window.view()));
+    EXPECT_EQ(getAt(poses, 900), getFront(window.view()));
+    EXPECT_EQ(distance(Position2D(500.0, 0.0), Trajectory2D(window.view())), distance(Position2D(500.0, 0.0), window.view()));
+    window.clear();
+    EXPECT_TRUE(window.empty());
+  }
+
+  /**
+   * A spiral, so the grid gets used and most of the path is far away.
+   */
+  TEST(OdometryTests,trajectoryIndex) {
+    Trajectory2D spiral(3, 2000);
+    for (int i = 0; i < size(spiral); ++i) {
+      const float angle = 0.01f * i;
+      spiral.col(i) << (1.0f + angle) * std::cos(angle), (1.0f + angle) * std::sin(angle), angle;
+    }
+    TrajectoryIndex index(spiral);
+    EXPECT_EQ(size(spiral) - 1, index.segments());
+    Trajectory2D short_path = spiral.leftCols(20);
+    TrajectoryIndex short_index(short_path);
+    for (int i = 0; i < 400; ++i) {
+      Position2D position(-25.0f + 0.13f * i, 30.0f - 0.17f * i);
+      EXPECT_NEAR(distance(position, spiral), index.distance(position), 1e-4);
+      EXPECT_NEAR(distance(position, short_path), short_index.distance(position), 1e-4);
+      EXPECT_NEAR(index.distance(position), std::sqrt(index.squaredDistance(position, index.nearestSegment(position))), 1e-4);
+    }
+    // follow the path from the inside out, slightly off to one side
+    int segment = index.nearestSegment(getPosition(getFront(spiral)));
+    EXPECT_EQ(0, segment);
+    for (int i = 0; i < size(spiral); i += 7) {
+      Position2D position = getPosition(getAt(spiral, i)) * 1.01f;
+      segment = index.nearestSegment(position, segment);
+      EXPECT_GE(1, std::abs(segment - i));
+    }
+    // one pose
+    TrajectoryIndex point(spiral.leftCols(1));
+    EXPECT_EQ(1, point.segments());
+    EXPECT_NEAR(1.0, point.distance(Position2D(1.0f, 1.0f)), 1e-6);
+    TrajectoryIndex empty_index;
+    EXPECT_EQ(-1, empty_index.nearestSegment(Position2D(0.0f, 0.0f)));
+  }
+
+  /**
+   * Long diagonal segments cross many cells (exactly through their corners
+   * here), the grid has to find them from any of those cells.
+   */
+  TEST(OdometryTests,trajectoryIndexDiagonals) {
+    Trajectory2D path(3, 201);
+    for (int i = 0; i < 100; ++i) {
+      path.col(i) << 0.5f * i, 0.5f * (i % 2), 0.0f;
+    }
+    path.col(100) << 1000.0f, 1000.0f, 0.0f; // from (49.5, 0.5) way up to the corner
+    for (int i = 101; i < size(path); ++i) {
+      path.col(i) << 1000.0f - 0.5f * (i - 100), 1000.0f - 0.5f * (i % 2), 0.0f;
+    }
+    path.col(size(path) - 1) << 0.0f, 0.0f, 0.0f; // and back down the exact diagonal
+    TrajectoryIndex index(path);
+    for (int i = 0; i < 1000; ++i) {
+      const float along = 1.0f * i;
+      const float off = 0.37f * ((i % 7) - 3);
+      Position2D on_diagonal(along + off, along - off);
+      Position2D near_first(49.5f + 0.95f * along + off, 0.5f + 0.9995f * along - off);
+      EXPECT_NEAR(distance(on_diagonal, path), index.distance(on_diagonal), 1e-3);
+      EXPECT_NEAR(distance(near_first, path), index.distance(near_first), 1e-3);
+    }
+    for (int i = 0; i < 400; ++i) {
+      Position2D position(-50.0f + 2.7f * i, 1050.0f - 2.9f * i);
+      EXPECT_NEAR(distance(position, path), index.distance(position), 1e-3);
+    }
+  }
+
 /*****************************************************************************
 ** Main program
 *****************************************************************************/
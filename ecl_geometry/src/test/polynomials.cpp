@@ -11,6 +11,7 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 #include <gtest/gtest.h>
 #include <ecl/formatters/floats.hpp>
 #include <ecl/formatters/strings.hpp>
@@ -174,6 +175,39 @@ TEST(PolynomialTests,division) {
 	EXPECT_DOUBLE_EQ(0.0, remainder);
 }
 
+TEST(PolynomialTests,batchEvaluation) {
+	QuinticPolynomial p;
+	p.coefficients() << 1.0, -2.0, 0.5, 3.0, -1.5, 0.25;
+	Polynomial<4> first = p.derivative();
+	Polynomial<3> second = first.derivative();
+	const std::size_t n = 37; // not a whole number of simd blocks
+	std::vector<double> x(n), values(n), first_derivatives(n), second_derivatives(n);
+	for ( std::size_t i = 0; i < n; ++i ) {
+		x[i] = -2.0 + 0.1*i;
+	}
+	p.evaluate(&x[0], n, &values[0], &first_derivatives[0], &second_derivatives[0]);
+	for ( std::size_t i = 0; i < n; ++i ) {
+		EXPECT_NEAR(p(x[i]), values[i], 1e-12);
+		EXPECT_NEAR(first(x[i]), first_derivatives[i], 1e-12);
+		EXPECT_NEAR(second(x[i]), second_derivatives[i], 1e-12);
+		EXPECT_NEAR(first(x[i]), p.derivative(x[i]), 1e-12);
+		EXPECT_NEAR(second(x[i]), p.dderivative(x[i]), 1e-12);
+	}
+	// values only, and partial outputs
+	std::vector<double> only_values(n), only_second(n);
+	p.evaluate(&x[0], n, &only_values[0]);
+	p.evaluate(&x[0], n, NULL, NULL, &only_second[0]);
+	for ( std::size_t i = 0; i < n; ++i ) {
+		EXPECT_DOUBLE_EQ(values[i], only_values[i]);
+		EXPECT_DOUBLE_EQ(second_derivatives[i], only_second[i]);
+	}
+	Polynomial<0> constant;
+	constant.coefficients() << 2.0;
+	constant.evaluate(&x[0], n, &values[0], &first_derivatives[0]);
+	EXPECT_EQ(2.0, values[n-1]);
+	EXPECT_EQ(0.0, first_derivatives[n-1]);
+}
+
 /*****************************************************************************
 ** Main program
 *****************************************************************************/
@@ -22,8 +22,10 @@
     #define replace_qt_emit
 #endif
 
+#include "ipc/message_channel.hpp"
 #include "ipc/semaphore.hpp"
 #include "ipc/shared_memory.hpp"
+#include "ipc/topic_registry.hpp"
 
 #ifdef replace_qt_emit
     #define emit
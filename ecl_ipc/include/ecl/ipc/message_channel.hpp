@@ -0,0 +1,29 @@
+/**
+ * @file /include/ecl/ipc/message_channel.hpp
+ *
+ * @brief Lock-free message channel between processes.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_IPC_MESSAGE_CHANNEL_HPP_
+#define ECL_IPC_MESSAGE_CHANNEL_HPP_
+
+/*****************************************************************************
+** Platform Detection
+*****************************************************************************/
+
+#include <ecl/config/ecl.hpp> // ECL_ macros
+
+/*****************************************************************************
+** Cross Platform Implementation
+*****************************************************************************/
+
+#if defined(ECL_IS_POSIX)
+  #include "message_channel_pos.hpp"
+#endif
+
+#endif /* ECL_IPC_MESSAGE_CHANNEL_HPP_ */
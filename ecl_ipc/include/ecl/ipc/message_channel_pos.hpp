@@ -0,0 +1,246 @@
+/**
+ * @file /include/ecl/ipc/message_channel_pos.hpp
+ *
+ * @brief Posix (linux) shared memory message channel.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_IPC_MESSAGE_CHANNEL_POS_HPP_
+#define ECL_IPC_MESSAGE_CHANNEL_POS_HPP_
+
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#include <ecl/config/ecl.hpp>
+#include "shared_memory_pos.hpp"
+#if defined(ECL_HAS_POSIX_SHARED_MEMORY) && defined(__linux__)
+
+/*****************************************************************************
+** Ecl Functionality Defines
+*****************************************************************************/
+
+#ifndef ECL_HAS_MESSAGE_CHANNEL
+  #define ECL_HAS_MESSAGE_CHANNEL
+#endif
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <atomic>
+#include <string>
+#include <stdint.h>
+#include <ecl/config/macros.hpp>
+#include <ecl/exceptions/standard_exception.hpp>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+namespace ipc {
+
+/*****************************************************************************
+** Interface [MessageChannelHeader]
+*****************************************************************************/
+/**
+ * @brief Layout of the start of a message channel's shared memory segment.
+ *
+ * The ring of records follows immediately after. Indices are absolute
+ * (never wrapped) byte positions, masked on access.
+ */
+struct MessageChannelHeader {
+	static const uint32_t magic_number = 0xEC1C4A11;
+	static const uint32_t current_version = 1;
+
+	uint32_t magic;
+	uint32_t version;
+	uint64_t capacity;
+	std::atomic<uint32_t> ready;            // set once the creator has initialised the header
+	alignas(64) std::atomic<uint64_t> head; // reserved by producers
+	alignas(64) std::atomic<uint64_t> tail; // released by the consumer
+	alignas(64) std::atomic<uint32_t> sequence; // futex word, bumped on every commit
+	std::atomic<uint32_t> waiters;
+};
+
+/**
+ * @brief Each record in the ring starts with this.
+ *
+ * Records (header and payload) are padded to multiples of eight bytes.
+ * The consumer zeroes everything it releases, so a zero state always
+ * means 'not yet committed'.
+ */
+struct MessageRecordHeader {
+	enum State {
+		Free = 0,
+		Committed = 1,
+		Padding = 2
+	};
+	uint32_t length;
+	std::atomic<uint32_t> state;
+};
+
+} // namespace ipc
+
+/*****************************************************************************
+** Interface [MessageChannel]
+*****************************************************************************/
+/**
+ * @brief Lock-free, variable length message channel in shared memory.
+ *
+ * A ring buffer of variable length records living in a named posix shared
+ * memory segment for passing messages between processes (or threads)
+ * without copying through the kernel.
+ *
+ * - Any number of producers may write (reservation is a compare and swap
+ *   on the head index, records are committed individually).
+ * - Only one consumer may read. Messages are delivered in reservation order.
+ * - A consumer with nothing to read can sleep on a futex in the segment
+ *   (wait()) instead of polling. Producers only make the wake up system
+ *   call when someone is actually waiting.
+ *
+ * Producers can either copy a message in with write() or fill it in place
+ * via reserve()/commit(). Likewise the consumer can copy out with read()
+ * or process it in place via front()/pop().
+ *
+ * The segment starts with a header (magic number, version, capacity and
+ * the head/tail/futex words each on their own cache line). The first
+ * instance creates and initialises it, later instances validate it.
+ *
+ * <b>Usage</b>:
+ *
+ * @code
+ * // driver process
+ * MessageChannel channel("driver_to_planner", 64*1024);
+ * channel.write(&state, sizeof(state));
+ *
+ * // planner process
+ * MessageChannel channel("driver_to_planner", 64*1024);
+ * unsigned long length;
+ * for (;;) {
+ *   channel.wait();
+ *   while ( const char *message = channel.front(length) ) {
+ *     process(message, length);
+ *     channel.pop();
+ *   }
+ * }
+ * @endcode
+ *
+ * @sa ecl::SharedMemory.
+ */
+class ECL_PUBLIC MessageChannel : public ipc::SharedMemoryBase {
+public:
+	/*********************
+	** C&D
+	**********************/
+	/**
+	 * @brief Create (or connect to) the named channel.
+	 *
+	 * @param name : unique string identifier for the channel (no slashes).
+	 * @param capacity : bytes in the ring, rounded up to a power of two (all ends must agree).
+	 *
+	 * @exception StandardException : throws if the segment couldn't be opened, mapped or didn't match.
+	 */
+	MessageChannel(const std::string &name, const unsigned long &capacity = 64*1024);
+	/**
+	 * @brief Unmaps the segment, the creator also unlinks its name.
+	 */
+	virtual ~MessageChannel();
+
+	/*********************
+	** Producers
+	**********************/
+	/**
+	 * @brief Reserve space for a message to be filled in place.
+	 *
+	 * Every reservation must be committed, the consumer can't pass it until it is.
+	 *
+	 * @param length : length of the message.
+	 * @return char* : where to write the message, NULL if the channel is full or it's too long.
+	 */
+	char* reserve(const unsigned long &length);
+	/**
+	 * @brief Publish a reserved message and wake the consumer if it is waiting.
+	 *
+	 * @param message : pointer returned by reserve().
+	 */
+	void commit(char *message);
+	/**
+	 * @brief Copy a message into the channel.
+	 *
+	 * @param message : the message.
+	 * @param length : its length.
+	 * @return bool : false if the channel is full or the message too long (nothing is written).
+	 */
+	bool write(const char *message, const unsigned long &length);
+
+	/*********************
+	** Consumer
+	**********************/
+	/**
+	 * @brief Peek at the next message, in place.
+	 *
+	 * @param length : set to the message's length.
+	 * @return const char* : the message, NULL if there is none.
+	 */
+	const char* front(unsigned long &length);
+	/**
+	 * @brief Release the message returned by front().
+	 */
+	void pop();
+	/**
+	 * @brief Copy the next message out of the channel.
+	 *
+	 * @param message : buffer to copy into.
+	 * @param length : size of the buffer.
+	 * @return long : message length, 0 if empty, -1 if the buffer is too small (the message stays).
+	 */
+	long read(char *message, const unsigned long &length);
+	/**
+	 * @brief Sleep until there is a message (or the timeout expires).
+	 *
+	 * @param timeout_ms : maximum time to wait, negative waits indefinitely.
+	 * @return bool : true if there is something to read.
+	 */
+	bool wait(const long &timeout_ms = -1);
+
+	/*********************
+	** Queries
+	**********************/
+	/**
+	 * @brief Bytes in the ring.
+	 */
+	unsigned long capacity() const { return mask + 1; }
+	/**
+	 * @brief Largest message that can be written.
+	 */
+	unsigned long maxMessageSize() const { return ( mask + 1 )/2 - sizeof(ipc::MessageRecordHeader); }
+	/**
+	 * @brief Snapshot of whether there is a message to read.
+	 */
+	bool empty();
+
+private:
+	ipc::MessageRecordHeader* record(const uint64_t &index) {
+		return reinterpret_cast<ipc::MessageRecordHeader*>(ring + ( index & mask ));
+	}
+	static uint64_t padded(const unsigned long &length) {
+		return ( sizeof(ipc::MessageRecordHeader) + length + 7 ) & ~static_cast<uint64_t>(7);
+	}
+	void release(const uint64_t &index, const uint64_t &length);
+
+	unsigned long size; // of the whole segment
+	uint64_t mask;
+	ipc::MessageChannelHeader *header;
+	char *ring;
+};
+
+} // namespace ecl
+
+#endif /* ECL_HAS_POSIX_SHARED_MEMORY && __linux__ */
+#endif /* ECL_IPC_MESSAGE_CHANNEL_POS_HPP_ */
@@ -0,0 +1,29 @@
+/**
+ * @file /include/ecl/ipc/topic_registry.hpp
+ *
+ * @brief Registry of topic subscribers shared between processes.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_IPC_TOPIC_REGISTRY_HPP_
+#define ECL_IPC_TOPIC_REGISTRY_HPP_
+
+/*****************************************************************************
+** Platform Detection
+*****************************************************************************/
+
+#include <ecl/config/ecl.hpp> // ECL_ macros
+
+/*****************************************************************************
+** Cross Platform Implementation
+*****************************************************************************/
+
+#if defined(ECL_IS_POSIX)
+  #include "topic_registry_pos.hpp"
+#endif
+
+#endif /* ECL_IPC_TOPIC_REGISTRY_HPP_ */
@@ -0,0 +1,187 @@
+/**
+ * @file /include/ecl/ipc/topic_registry_pos.hpp
+ *
+ * @brief Posix (linux) shared memory registry of topic subscribers.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_IPC_TOPIC_REGISTRY_POS_HPP_
+#define ECL_IPC_TOPIC_REGISTRY_POS_HPP_
+
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#include <ecl/config/ecl.hpp>
+#include "message_channel_pos.hpp"
+#ifdef ECL_HAS_MESSAGE_CHANNEL
+
+/*****************************************************************************
+** Ecl Functionality Defines
+*****************************************************************************/
+
+#ifndef ECL_HAS_TOPIC_REGISTRY
+  #define ECL_HAS_TOPIC_REGISTRY
+#endif
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <atomic>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <ecl/config/macros.hpp>
+#include <ecl/exceptions/standard_exception.hpp>
+#include "shared_memory_pos.hpp"
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+namespace ipc {
+
+/*****************************************************************************
+** Interface [TopicRegistryHeader]
+*****************************************************************************/
+/**
+ * @brief A subscription in the registry.
+ *
+ * Zero filled (Free) until claimed. The names are null terminated.
+ */
+struct TopicRegistryEntry {
+	enum State {
+		Free = 0,
+		Claimed = 1, // being filled in
+		Active = 2
+	};
+	static const unsigned int max_name_length = 64; /**< @brief Including the terminating null. **/
+
+	std::atomic<uint32_t> state;
+	int32_t pid;
+	uint64_t payload_size;
+	uint64_t capacity;
+	char topic[max_name_length];
+	char channel[max_name_length];
+};
+
+/**
+ * @brief Layout of the registry's shared memory segment.
+ */
+struct TopicRegistryHeader {
+	static const uint32_t magic_number = 0xEC1C7091;
+	static const uint32_t current_version = 1;
+	static const unsigned int number_of_entries = 256;
+
+	uint32_t magic;
+	uint32_t version;
+	std::atomic<uint32_t> ready;         // set once the creator has initialised the header
+	alignas(64) std::atomic<uint64_t> generation; // bumped on every change of subscriptions
+	TopicRegistryEntry entries[number_of_entries];
+};
+
+/**
+ * @brief A subscriber's channel, as found in the registry.
+ */
+struct TopicSubscriber {
+	std::string channel;    /**< @brief Name of the subscriber's message channel. **/
+	unsigned long capacity; /**< @brief Capacity of that channel. **/
+};
+
+} // namespace ipc
+
+/*****************************************************************************
+** Interface [TopicRegistry]
+*****************************************************************************/
+/**
+ * @brief Registry of topic subscribers shared by all processes on the machine.
+ *
+ * Lets publishers in one process discover the message channels of
+ * subscribers in others. Each subscription is an entry in a fixed table
+ * in a named shared memory segment, claimed and released with atomic
+ * operations, so there is no lock for a crashed process to leave held.
+ *
+ * Every change bumps a generation counter, so publishers only need to
+ * look up their subscribers again when it moves. Lookups also reclaim
+ * the entries of processes that died without unsubscribing (and unlink
+ * their channels).
+ *
+ * The segment outlives the processes using it (it is never unlinked),
+ * it's small and a later process will pick up where they left off.
+ *
+ * @sa MessageChannel.
+ */
+class ECL_PUBLIC TopicRegistry : public ipc::SharedMemoryBase {
+public:
+	/**
+	 * @brief Create (or connect to) the named registry.
+	 *
+	 * @param name : unique string identifier for the registry (no slashes).
+	 *
+	 * @exception StandardException : throws if the segment couldn't be opened, mapped or didn't match.
+	 */
+	TopicRegistry(const std::string &name = "ecl_sigslots_registry");
+	/**
+	 * @brief Unmaps the segment (it is never unlinked).
+	 */
+	virtual ~TopicRegistry();
+
+	/**
+	 * @brief Register a subscriber's channel.
+	 *
+	 * @param topic : the topic subscribed to.
+	 * @param channel : name of the subscriber's message channel.
+	 * @param payload_size : size of the payloads expected.
+	 * @param capacity : capacity of the subscriber's message channel.
+	 * @return int : the entry (for unsubscribe()), -1 if the registry is full.
+	 *
+	 * @exception StandardException : throws if a name is too long [debug mode only].
+	 */
+	int subscribe(const std::string &topic, const std::string &channel, const unsigned long &payload_size, const unsigned long &capacity);
+	/**
+	 * @brief Release a subscription.
+	 *
+	 * @param entry : as returned by subscribe().
+	 */
+	void unsubscribe(const int &entry);
+	/**
+	 * @brief Look up the channels subscribed to a topic.
+	 *
+	 * Subscribers expecting a different payload size are skipped.
+	 *
+	 * @param topic : the topic to look up.
+	 * @param payload_size : size of the payloads to be published.
+	 * @param subscribers : filled with the subscribers' channels.
+	 */
+	void subscribers(const std::string &topic, const unsigned long &payload_size, std::vector<ipc::TopicSubscriber> &subscribers);
+	/**
+	 * @brief Counter bumped by every change to the subscriptions.
+	 *
+	 * @return uint64_t : the current generation.
+	 */
+	uint64_t generation() const { return ( header == NULL ) ? 0 : header->generation.load(std::memory_order_acquire); }
+
+	/**
+	 * @brief Name for a new channel, unique on this machine.
+	 *
+	 * @param prefix : what to start the name with.
+	 * @return string : prefix_pid_count.
+	 */
+	static std::string uniqueName(const std::string &prefix);
+
+private:
+	bool reclaimIfDead(ipc::TopicRegistryEntry &entry);
+
+	ipc::TopicRegistryHeader *header;
+};
+
+} // namespace ecl
+
+#endif /* ECL_HAS_MESSAGE_CHANNEL */
+#endif /* ECL_IPC_TOPIC_REGISTRY_POS_HPP_ */
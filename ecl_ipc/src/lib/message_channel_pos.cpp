@@ -0,0 +1,308 @@
+/**
+ * @file /src/lib/message_channel_pos.cpp
+ *
+ * @brief Posix (linux) shared memory message channel implementation.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include "../../include/ecl/ipc/message_channel_pos.hpp"
+
+#ifdef ECL_HAS_MESSAGE_CHANNEL
+
+#include <cstring>
+#include <ctime>
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <ecl/exceptions/macros.hpp>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ipc::MessageChannelHeader;
+using ipc::MessageRecordHeader;
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+namespace {
+
+/**
+ * Not FUTEX_PRIVATE - the word is shared between processes.
+ */
+int futex_wait(std::atomic<uint32_t> *word, const uint32_t &expected, const timespec *timeout) {
+	return syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT, expected, timeout, NULL, 0);
+}
+
+int futex_wake(std::atomic<uint32_t> *word) {
+	return syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE, 1, NULL, NULL, 0);
+}
+
+long now_ms() {
+	timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec*1000L + time.tv_nsec/1000000L;
+}
+
+} // namespace
+
+/*****************************************************************************
+** Implementation [MessageChannel][C&D]
+*****************************************************************************/
+
+MessageChannel::MessageChannel(const std::string &name, const unsigned long &capacity) :
+	ipc::SharedMemoryBase(std::string("/")+name),
+	size(0),
+	mask(0),
+	header(NULL),
+	ring(NULL)
+{
+	uint64_t ring_size = 64;
+	while ( ring_size < capacity ) { ring_size <<= 1; }
+	mask = ring_size - 1;
+	size = sizeof(MessageChannelHeader) + ring_size;
+
+	int descriptor = open();
+	if ( descriptor == -1 ) {
+		ecl_throw(ipc::openSharedSectionException(LOC));
+		return;
+	}
+	if ( shared_memory_manager ) {
+		// inflating also zero fills, which the ring relies on
+		if ( ftruncate(descriptor, size) < 0 ) {
+			::close(descriptor);
+			unlink();
+			ecl_throw(StandardException(LOC,OpenError,"Message channel created, but inflation to the desired size failed."));
+			return;
+		}
+	} else {
+		// the creator might not have inflated it yet
+		struct stat status;
+		for ( unsigned int i = 0; ( fstat(descriptor, &status) == 0 ) && ( status.st_size < static_cast<off_t>(size) ) && ( i < 1000 ); ++i ) {
+			usleep(1000);
+		}
+		if ( status.st_size < static_cast<off_t>(size) ) {
+			::close(descriptor);
+			ecl_throw(StandardException(LOC,ConfigurationError,"Message channel exists, but is smaller than the requested capacity."));
+			return;
+		}
+	}
+	void *address = mmap(0, size, PROT_READ|PROT_WRITE, MAP_SHARED, descriptor, 0);
+	::close(descriptor);
+	if ( address == MAP_FAILED ) {
+		if ( shared_memory_manager ) {
+			shared_memory_manager = false;
+			unlink();
+		}
+		ecl_throw(ipc::memoryMapException(LOC));
+		return;
+	}
+	header = static_cast<MessageChannelHeader*>(address);
+	ring = static_cast<char*>(address) + sizeof(MessageChannelHeader);
+	if ( shared_memory_manager ) {
+		header->magic = MessageChannelHeader::magic_number;
+		header->version = MessageChannelHeader::current_version;
+		header->capacity = ring_size;
+		header->ready.store(1, std::memory_order_release);
+	} else {
+		for ( unsigned int i = 0; ( header->ready.load(std::memory_order_acquire) == 0 ) && ( i < 1000 ); ++i ) {
+			usleep(1000);
+		}
+		if ( ( header->ready.load(std::memory_order_acquire) == 0 ) ||
+		     ( header->magic != MessageChannelHeader::magic_number ) ||
+		     ( header->version != MessageChannelHeader::current_version ) ||
+		     ( header->capacity != ring_size ) ) {
+			munmap(address, size);
+			header = NULL;
+			ring = NULL;
+			ecl_throw(StandardException(LOC,ConfigurationError,"Shared memory segment is not a message channel of this version and capacity."));
+			return;
+		}
+	}
+}
+
+MessageChannel::~MessageChannel() {
+	if ( header != NULL ) {
+		munmap(header, size);
+	}
+	if ( shared_memory_manager ) {
+		unlink();
+	}
+}
+
+/*****************************************************************************
+** Implementation [MessageChannel][Producers]
+*****************************************************************************/
+
+char* MessageChannel::reserve(const unsigned long &length) {
+	if ( ( header == NULL ) || ( length > maxMessageSize() ) ) {
+		return NULL;
+	}
+	const uint64_t needed = padded(length);
+	uint64_t head = header->head.load(std::memory_order_relaxed);
+	uint64_t padding;
+	for (;;) {
+		const uint64_t tail = header->tail.load(std::memory_order_acquire);
+		// records never wrap, pad out the end of the ring if necessary
+		const uint64_t to_end = capacity() - ( head & mask );
+		padding = ( to_end < needed ) ? to_end : 0;
+		if ( ( tail > head ) || ( head + padding + needed - tail > capacity() ) ) {
+			const uint64_t latest = header->head.load(std::memory_order_relaxed);
+			if ( latest == head ) {
+				return NULL; // full
+			}
+			head = latest; // was stale
+			continue;
+		}
+		if ( header->head.compare_exchange_weak(head, head + padding + needed, std::memory_order_acq_rel, std::memory_order_relaxed) ) {
+			break;
+		}
+	}
+	if ( padding != 0 ) {
+		MessageRecordHeader *filler = record(head);
+		filler->length = padding - sizeof(MessageRecordHeader);
+		filler->state.store(MessageRecordHeader::Padding, std::memory_order_release);
+		head += padding;
+	}
+	MessageRecordHeader *reserved = record(head);
+	reserved->length = length;
+	return reinterpret_cast<char*>(reserved + 1);
+}
+
+void MessageChannel::commit(char *message) {
+	MessageRecordHeader *committed = reinterpret_cast<MessageRecordHeader*>(message) - 1;
+	committed->state.store(MessageRecordHeader::Committed, std::memory_order_release);
+	// sequentially consistent with the consumer's waiters/sequence handling in wait()
+	header->sequence.fetch_add(1);
+	if ( header->waiters.load() != 0 ) {
+		futex_wake(&header->sequence);
+	}
+}
+
+bool MessageChannel::write(const char *message, const unsigned long &length) {
+	char *reserved = reserve(length);
+	if ( reserved == NULL ) {
+		return false;
+	}
+	memcpy(reserved, message, length);
+	commit(reserved);
+	return true;
+}
+
+/*****************************************************************************
+** Implementation [MessageChannel][Consumer]
+*****************************************************************************/
+
+const char* MessageChannel::front(unsigned long &length) {
+	if ( header == NULL ) {
+		return NULL;
+	}
+	uint64_t tail = header->tail.load(std::memory_order_relaxed);
+	MessageRecordHeader *next = record(tail);
+	uint32_t state = next->state.load(std::memory_order_acquire);
+	if ( state == MessageRecordHeader::Padding ) {
+		const uint64_t skip = sizeof(MessageRecordHeader) + next->length;
+		release(tail, skip);
+		tail += skip;
+		next = record(tail);
+		state = next->state.load(std::memory_order_acquire);
+	}
+	if ( state != MessageRecordHeader::Committed ) {
+		return NULL;
+	}
+	length = next->length;
+	return reinterpret_cast<const char*>(next + 1);
+}
+
+void MessageChannel::pop() {
+	unsigned long length;
+	if ( front(length) != NULL ) {
+		release(header->tail.load(std::memory_order_relaxed), padded(length));
+	}
+}
+
+long MessageChannel::read(char *message, const unsigned long &length) {
+	unsigned long message_length;
+	const char *next = front(message_length);
+	if ( next == NULL ) {
+		return 0;
+	}
+	if ( message_length > length ) {
+		return -1;
+	}
+	memcpy(message, next, message_length);
+	pop();
+	return message_length;
+}
+
+bool MessageChannel::wait(const long &timeout_ms) {
+	if ( header == NULL ) {
+		return false;
+	}
+	if ( !empty() ) {
+		return true;
+	}
+	const long deadline = now_ms() + timeout_ms;
+	header->waiters.fetch_add(1);
+	for (;;) {
+		const uint32_t sequence = header->sequence.load();
+		if ( !empty() ) {
+			break;
+		}
+		if ( timeout_ms < 0 ) {
+			futex_wait(&header->sequence, sequence, NULL);
+		} else {
+			const long remaining = deadline - now_ms();
+			if ( remaining <= 0 ) {
+				break;
+			}
+			timespec timeout = { remaining/1000, (remaining % 1000)*1000000L };
+			futex_wait(&header->sequence, sequence, &timeout);
+		}
+	}
+	header->waiters.fetch_sub(1);
+	return !empty();
+}
+
+bool MessageChannel::empty() {
+	if ( header == NULL ) {
+		return true;
+	}
+	uint64_t tail = header->tail.load(std::memory_order_acquire);
+	MessageRecordHeader *next = record(tail);
+	uint32_t state = next->state.load(std::memory_order_acquire);
+	if ( state == MessageRecordHeader::Padding ) {
+		next = record(tail + sizeof(MessageRecordHeader) + next->length);
+		state = next->state.load(std::memory_order_acquire);
+	}
+	return ( state != MessageRecordHeader::Committed );
+}
+
+/**
+ * Zeroes the record (so stale bytes can't pass for a committed state later)
+ * before handing the space back to the producers.
+ */
+void MessageChannel::release(const uint64_t &index, const uint64_t &length) {
+	memset(ring + ( index & mask ), 0, length);
+	header->tail.store(index + length, std::memory_order_release);
+}
+
+} // namespace ecl
+
+#endif /* ECL_HAS_MESSAGE_CHANNEL */
@@ -0,0 +1,210 @@
+/**
+ * @file /src/lib/topic_registry_pos.cpp
+ *
+ * @brief Posix (linux) shared memory registry of topic subscribers.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include "../../include/ecl/ipc/topic_registry_pos.hpp"
+
+#ifdef ECL_HAS_TOPIC_REGISTRY
+
+#include <cstring>
+#include <errno.h>
+#include <signal.h>
+#include <sstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <ecl/exceptions/macros.hpp>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ipc::TopicRegistryEntry;
+using ipc::TopicRegistryHeader;
+using ipc::TopicSubscriber;
+
+/*****************************************************************************
+** Implementation [TopicRegistry][C&D]
+*****************************************************************************/
+
+TopicRegistry::TopicRegistry(const std::string &name) :
+	ipc::SharedMemoryBase(std::string("/")+name),
+	header(NULL)
+{
+	const off_t size = sizeof(TopicRegistryHeader);
+	int descriptor = open();
+	if ( descriptor == -1 ) {
+		ecl_throw(ipc::openSharedSectionException(LOC));
+		return;
+	}
+	if ( shared_memory_manager ) {
+		// inflating also zero fills, so every entry starts out free
+		if ( ftruncate(descriptor, size) < 0 ) {
+			::close(descriptor);
+			unlink();
+			ecl_throw(StandardException(LOC,OpenError,"Topic registry created, but inflation to the desired size failed."));
+			return;
+		}
+	} else {
+		// the creator might not have inflated it yet
+		struct stat status;
+		for ( unsigned int i = 0; ( fstat(descriptor, &status) == 0 ) && ( status.st_size < size ) && ( i < 1000 ); ++i ) {
+			usleep(1000);
+		}
+		if ( status.st_size < size ) {
+			::close(descriptor);
+			ecl_throw(StandardException(LOC,ConfigurationError,"Shared memory segment exists, but is too small to be a topic registry."));
+			return;
+		}
+	}
+	void *address = mmap(0, size, PROT_READ|PROT_WRITE, MAP_SHARED, descriptor, 0);
+	::close(descriptor);
+	if ( address == MAP_FAILED ) {
+		if ( shared_memory_manager ) {
+			unlink();
+		}
+		ecl_throw(ipc::memoryMapException(LOC));
+		return;
+	}
+	header = static_cast<TopicRegistryHeader*>(address);
+	if ( shared_memory_manager ) {
+		header->magic = TopicRegistryHeader::magic_number;
+		header->version = TopicRegistryHeader::current_version;
+		header->ready.store(1, std::memory_order_release);
+	} else {
+		for ( unsigned int i = 0; ( header->ready.load(std::memory_order_acquire) == 0 ) && ( i < 1000 ); ++i ) {
+			usleep(1000);
+		}
+		if ( ( header->ready.load(std::memory_order_acquire) == 0 ) ||
+		     ( header->magic != TopicRegistryHeader::magic_number ) ||
+		     ( header->version != TopicRegistryHeader::current_version ) ) {
+			munmap(address, size);
+			header = NULL;
+			ecl_throw(StandardException(LOC,ConfigurationError,"Shared memory segment is not a topic registry of this version."));
+			return;
+		}
+	}
+}
+
+TopicRegistry::~TopicRegistry() {
+	if ( header != NULL ) {
+		munmap(header, sizeof(TopicRegistryHeader));
+	}
+}
+
+/*****************************************************************************
+** Implementation [TopicRegistry]
+*****************************************************************************/
+
+int TopicRegistry::subscribe(const std::string &topic, const std::string &channel, const unsigned long &payload_size, const unsigned long &capacity) {
+	ecl_assert_throw( ( topic.size() < TopicRegistryEntry::max_name_length ) && ( channel.size() < TopicRegistryEntry::max_name_length ),
+	                  StandardException(LOC,InvalidInputError,"Topic and channel names must be shorter than 64 characters."));
+	if ( header == NULL ) {
+		return -1;
+	}
+	for ( unsigned int i = 0; i < TopicRegistryHeader::number_of_entries; ++i ) {
+		TopicRegistryEntry &entry = header->entries[i];
+		uint32_t expected = TopicRegistryEntry::Free;
+		if ( !entry.state.compare_exchange_strong(expected, TopicRegistryEntry::Claimed) ) {
+			continue;
+		}
+		entry.pid = getpid();
+		entry.payload_size = payload_size;
+		entry.capacity = capacity;
+		strncpy(entry.topic, topic.c_str(), TopicRegistryEntry::max_name_length - 1);
+		entry.topic[TopicRegistryEntry::max_name_length - 1] = '\0';
+		strncpy(entry.channel, channel.c_str(), TopicRegistryEntry::max_name_length - 1);
+		entry.channel[TopicRegistryEntry::max_name_length - 1] = '\0';
+		entry.state.store(TopicRegistryEntry::Active, std::memory_order_release);
+		header->generation.fetch_add(1);
+		return i;
+	}
+	return -1;
+}
+
+void TopicRegistry::unsubscribe(const int &entry) {
+	if ( ( header == NULL ) || ( entry < 0 ) || ( entry >= static_cast<int>(TopicRegistryHeader::number_of_entries) ) ) {
+		return;
+	}
+	header->entries[entry].pid = 0; // a claimed entry without a pid is never reclaimed
+	header->entries[entry].state.store(TopicRegistryEntry::Free, std::memory_order_release);
+	header->generation.fetch_add(1);
+}
+
+void TopicRegistry::subscribers(const std::string &topic, const unsigned long &payload_size, std::vector<TopicSubscriber> &subscribers) {
+	subscribers.clear();
+	if ( header == NULL ) {
+		return;
+	}
+	for ( unsigned int i = 0; i < TopicRegistryHeader::number_of_entries; ++i ) {
+		TopicRegistryEntry &entry = header->entries[i];
+		const uint32_t state = entry.state.load(std::memory_order_acquire);
+		if ( ( state == TopicRegistryEntry::Free ) || reclaimIfDead(entry) ) {
+			continue;
+		}
+		if ( ( state != TopicRegistryEntry::Active ) ||
+		     ( entry.payload_size != payload_size ) ||
+		     ( strncmp(entry.topic, topic.c_str(), TopicRegistryEntry::max_name_length) != 0 ) ) {
+			continue;
+		}
+		TopicSubscriber subscriber;
+		subscriber.channel = std::string(entry.channel, strnlen(entry.channel, TopicRegistryEntry::max_name_length));
+		subscriber.capacity = entry.capacity;
+		subscribers.push_back(subscriber);
+	}
+}
+
+std::string TopicRegistry::uniqueName(const std::string &prefix) {
+	static std::atomic<unsigned int> count(0);
+	std::ostringstream name;
+	name << prefix << "_" << getpid() << "_" << count.fetch_add(1);
+	return name.str();
+}
+
+/**
+ * Frees the entry (and unlinks its channel) if its process is gone.
+ *
+ * Claiming it first keeps anyone else from reusing it while it is being
+ * freed, which also lets us check it still belongs to the dead process.
+ * Entries left claimed by a process that died while subscribing are
+ * never reclaimed, that window is a handful of instructions.
+ */
+bool TopicRegistry::reclaimIfDead(TopicRegistryEntry &entry) {
+	const int32_t pid = entry.pid;
+	if ( ( pid <= 0 ) || ( kill(pid, 0) == 0 ) || ( errno != ESRCH ) ) {
+		return false;
+	}
+	uint32_t expected = TopicRegistryEntry::Active;
+	if ( !entry.state.compare_exchange_strong(expected, TopicRegistryEntry::Claimed) ) {
+		return true; // already being freed or reused
+	}
+	if ( entry.pid != pid ) {
+		// reused by a live process in the meantime, put it back
+		entry.state.store(TopicRegistryEntry::Active, std::memory_order_release);
+		header->generation.fetch_add(1); // others may have skipped it while claimed
+		return false;
+	}
+	const std::string channel = std::string("/") + std::string(entry.channel, strnlen(entry.channel, TopicRegistryEntry::max_name_length));
+	shm_unlink(channel.c_str());
+	entry.pid = 0;
+	entry.state.store(TopicRegistryEntry::Free, std::memory_order_release);
+	header->generation.fetch_add(1);
+	return true;
+}
+
+} // namespace ecl
+
+#endif /* ECL_HAS_TOPIC_REGISTRY */
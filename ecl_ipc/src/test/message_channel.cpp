@@ -0,0 +1,213 @@
+/**
+ * @file /src/test/message_channel.cpp
+ *
+ * @brief Unit Test for the shared memory message channel.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <gtest/gtest.h>
+#include <ecl/exceptions/standard_exception.hpp>
+#include "../../include/ecl/ipc/message_channel.hpp"
+
+#ifdef ECL_HAS_MESSAGE_CHANNEL
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::MessageChannel;
+using ecl::StandardException;
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+struct Header {
+	unsigned int producer;
+	unsigned int sequence;
+};
+
+const unsigned int messages_per_producer = 20000;
+
+/**
+ * Variable length payload, filled with a pattern that depends on the sequence.
+ */
+unsigned int payload_length(const unsigned int &sequence) { return ( sequence*37 ) % 300; }
+
+bool check(const char *message, const unsigned long &length, unsigned int expected[]) {
+	Header header;
+	memcpy(&header, message, sizeof(Header));
+	if ( ( header.sequence != expected[header.producer] ) || ( length != sizeof(Header) + payload_length(header.sequence) ) ) {
+		return false;
+	}
+	for ( unsigned int i = sizeof(Header); i < length; ++i ) {
+		if ( message[i] != static_cast<char>(header.sequence + i) ) {
+			return false;
+		}
+	}
+	++expected[header.producer];
+	return true;
+}
+
+/**
+ * Runs in a forked child - no gtest macros, the exit code is the result.
+ */
+void produce(const std::string &name, const unsigned int &producer) {
+	try {
+		MessageChannel channel(name, 16*1024);
+		char message[sizeof(Header) + 300];
+		for ( unsigned int sequence = 0; sequence < messages_per_producer; ++sequence ) {
+			Header header = { producer, sequence };
+			memcpy(message, &header, sizeof(Header));
+			const unsigned int length = sizeof(Header) + payload_length(sequence);
+			for ( unsigned int i = sizeof(Header); i < length; ++i ) {
+				message[i] = static_cast<char>(sequence + i);
+			}
+			while ( !channel.write(message, length) ) {
+				usleep(10); // full
+			}
+		}
+	} catch ( const StandardException &e ) {
+		std::cout << e.what() << std::endl;
+		_exit(1);
+	}
+	_exit(0);
+}
+
+/*****************************************************************************
+** Tests
+*****************************************************************************/
+
+TEST(MessageChannelTests,wrapAround) {
+	try {
+		MessageChannel channel("ecl_test_channel_wrap", 1024);
+		EXPECT_EQ(1024u, channel.capacity());
+		EXPECT_FALSE(channel.write("x", channel.maxMessageSize() + 1));
+		char buffer[512];
+		unsigned int expected[1] = { 0 };
+		for ( unsigned int sequence = 0; sequence < 1000; ++sequence ) {
+			const unsigned int length = sizeof(Header) + payload_length(sequence);
+			char *message = channel.reserve(length); // in place
+			ASSERT_TRUE(message != NULL);
+			Header header = { 0, sequence };
+			memcpy(message, &header, sizeof(Header));
+			for ( unsigned int i = sizeof(Header); i < length; ++i ) {
+				message[i] = static_cast<char>(sequence + i);
+			}
+			EXPECT_TRUE(channel.empty() || ( sequence % 2 == 1 ));
+			channel.commit(message);
+			if ( sequence % 2 == 1 ) { // let two accumulate
+				long n = channel.read(buffer, 512);
+				ASSERT_GT(n, 0);
+				EXPECT_TRUE(check(buffer, n, expected));
+				unsigned long in_place_length;
+				const char *in_place = channel.front(in_place_length);
+				ASSERT_TRUE(in_place != NULL);
+				EXPECT_TRUE(check(in_place, in_place_length, expected));
+				channel.pop();
+			}
+		}
+		EXPECT_TRUE(channel.empty());
+		EXPECT_EQ(0, channel.read(buffer, 512));
+		EXPECT_FALSE(channel.wait(10));
+		// fill it
+		unsigned int written = 0;
+		while ( channel.write(buffer, 100) ) { ++written; }
+		EXPECT_GE(written, 1024u/112u - 1); // less one if the end of the ring had to be padded out
+		EXPECT_LE(written, 1024u/112u);
+		EXPECT_EQ(-1, channel.read(buffer, 10));
+	} catch ( const StandardException &e ) {
+		std::cout << "Shared memory is not available, skipping [" << e.what() << "]" << std::endl;
+	}
+}
+
+TEST(MessageChannelTests,mismatch) {
+	try {
+		MessageChannel channel("ecl_test_channel_mismatch", 1024);
+		bool thrown = false;
+		try {
+			MessageChannel other("ecl_test_channel_mismatch", 512);
+		} catch ( const StandardException &e ) {
+			thrown = true;
+		}
+		EXPECT_TRUE(thrown);
+	} catch ( const StandardException &e ) {
+		std::cout << "Shared memory is not available, skipping [" << e.what() << "]" << std::endl;
+	}
+}
+
+TEST(MessageChannelTests,processes) {
+	const std::string name("ecl_test_channel_processes");
+	const unsigned int number_of_producers = 2;
+	MessageChannel *channel = NULL;
+	try {
+		channel = new MessageChannel(name, 16*1024);
+	} catch ( const StandardException &e ) {
+		std::cout << "Shared memory is not available, skipping [" << e.what() << "]" << std::endl;
+		return;
+	}
+	pid_t producers[number_of_producers];
+	for ( unsigned int i = 0; i < number_of_producers; ++i ) {
+		producers[i] = fork();
+		ASSERT_GE(producers[i], 0);
+		if ( producers[i] == 0 ) {
+			produce(name, i);
+		}
+	}
+	unsigned int expected[number_of_producers] = { 0, 0 };
+	unsigned int received = 0;
+	bool ok = true;
+	while ( ok && ( received < number_of_producers*messages_per_producer ) ) {
+		if ( !channel->wait(5000) ) {
+			break;
+		}
+		unsigned long length;
+		while ( const char *message = channel->front(length) ) {
+			ok = ok && check(message, length, expected);
+			channel->pop();
+			++received;
+		}
+	}
+	EXPECT_TRUE(ok);
+	EXPECT_EQ(number_of_producers*messages_per_producer, received);
+	for ( unsigned int i = 0; i < number_of_producers; ++i ) {
+		int status = -1;
+		waitpid(producers[i], &status, 0);
+		EXPECT_TRUE(WIFEXITED(status) && ( WEXITSTATUS(status) == 0 ));
+	}
+	delete channel;
+}
+
+/*****************************************************************************
+** Main program
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+
+	testing::InitGoogleTest(&argc,argv);
+	return RUN_ALL_TESTS();
+}
+
+#else
+
+/*****************************************************************************
+** Alternative Main
+*****************************************************************************/
+
+int main(int /* argc */, char ** /* argv */) {
+	std::cout << std::endl;
+	std::cout << "Message channels are not supported on this platform." << std::endl;
+	std::cout << std::endl;
+	return 0;
+}
+
+#endif /* ECL_HAS_MESSAGE_CHANNEL */
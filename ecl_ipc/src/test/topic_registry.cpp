@@ -0,0 +1,126 @@
+/**
+ * @file /src/test/topic_registry.cpp
+ *
+ * @brief Unit Test for the shared memory topic registry.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <fcntl.h>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <gtest/gtest.h>
+#include <ecl/exceptions/standard_exception.hpp>
+#include "../../include/ecl/ipc/message_channel.hpp"
+#include "../../include/ecl/ipc/topic_registry.hpp"
+
+#ifdef ECL_HAS_TOPIC_REGISTRY
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::MessageChannel;
+using ecl::StandardException;
+using ecl::TopicRegistry;
+using ecl::ipc::TopicSubscriber;
+
+/*****************************************************************************
+** Tests
+*****************************************************************************/
+
+TEST(TopicRegistryTests,subscriptions) {
+	try {
+		TopicRegistry registry("ecl_test_registry");
+		std::vector<TopicSubscriber> subscribers;
+		const uint64_t generation = registry.generation();
+		const int odometry = registry.subscribe("odometry", "odometry_channel", 48, 1024);
+		const int small = registry.subscribe("odometry", "small_channel", 24, 1024);
+		const int scan = registry.subscribe("scan", "scan_channel", 4320, 65536);
+		EXPECT_LE(0, odometry);
+		EXPECT_LE(0, small);
+		EXPECT_LE(0, scan);
+		EXPECT_EQ(generation + 3, registry.generation());
+		TopicRegistry other("ecl_test_registry"); // another handle on the same segment
+		other.subscribers("odometry", 48, subscribers);
+		ASSERT_EQ(1u, subscribers.size()); // the other one doesn't match the payload
+		EXPECT_EQ(std::string("odometry_channel"), subscribers[0].channel);
+		EXPECT_EQ(1024u, subscribers[0].capacity);
+		registry.unsubscribe(odometry);
+		registry.unsubscribe(small);
+		registry.unsubscribe(scan);
+		EXPECT_EQ(generation + 6, other.generation());
+		other.subscribers("odometry", 48, subscribers);
+		EXPECT_TRUE(subscribers.empty());
+		EXPECT_NE(TopicRegistry::uniqueName("channel"), TopicRegistry::uniqueName("channel"));
+	} catch ( const StandardException &e ) {
+		std::cout << "Shared memory is not available, skipping [" << e.what() << "]" << std::endl;
+	}
+}
+
+TEST(TopicRegistryTests,deadProcesses) {
+	TopicRegistry *registry = NULL;
+	try {
+		registry = new TopicRegistry("ecl_test_registry");
+	} catch ( const StandardException &e ) {
+		std::cout << "Shared memory is not available, skipping [" << e.what() << "]" << std::endl;
+		return;
+	}
+	const std::string channel_name("ecl_test_registry_orphan");
+	pid_t child = fork();
+	ASSERT_GE(child, 0);
+	if ( child == 0 ) {
+		// subscribe, then die without cleaning up
+		TopicRegistry registry("ecl_test_registry");
+		MessageChannel *channel = new MessageChannel(channel_name, 1024);
+		(void)channel;
+		_exit(( registry.subscribe("orphans", channel_name, 8, 1024) >= 0 ) ? 0 : 1);
+	}
+	int status = -1;
+	waitpid(child, &status, 0);
+	ASSERT_TRUE(WIFEXITED(status) && ( WEXITSTATUS(status) == 0 ));
+	const uint64_t generation = registry->generation();
+	std::vector<TopicSubscriber> subscribers;
+	registry->subscribers("orphans", 8, subscribers);
+	EXPECT_TRUE(subscribers.empty());
+	EXPECT_LT(generation, registry->generation());
+	const int descriptor = shm_open(("/" + channel_name).c_str(), O_RDWR, 0);
+	EXPECT_EQ(-1, descriptor); // the orphaned channel was unlinked
+	if ( descriptor != -1 ) {
+		close(descriptor);
+		shm_unlink(("/" + channel_name).c_str());
+	}
+	delete registry;
+}
+
+/*****************************************************************************
+** Main program
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+
+	testing::InitGoogleTest(&argc,argv);
+	return RUN_ALL_TESTS();
+}
+
+#else
+
+/*****************************************************************************
+** Alternative Main
+*****************************************************************************/
+
+int main(int /* argc */, char ** /* argv */) {
+	std::cout << std::endl;
+	std::cout << "Topic registries are not supported on this platform." << std::endl;
+	std::cout << std::endl;
+	return 0;
+}
+
+#endif /* ECL_HAS_TOPIC_REGISTRY */
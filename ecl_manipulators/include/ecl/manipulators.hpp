@@ -23,6 +23,7 @@
 #include "manipulators/types.hpp"
 #include "manipulators/waypoint.hpp"
 #include "manipulators/trajectory.hpp"
+#include "manipulators/trajectory_cursor.hpp"
 
 
 #endif /*ECL_MANIPULATORS_HPP_*/
@@ -40,6 +40,81 @@
 
 namespace ecl {
 
+/*****************************************************************************
+** Forward Declarations
+*****************************************************************************/
+
+class TrajectoryCursor;
+
+/*****************************************************************************
+** Interface [TrajectoryPiece]
+*****************************************************************************/
+/**
+ * @brief A single interval of a joint trajectory.
+ *
+ * Either a polynomial (quintic, lower degrees padded out) or a tension
+ * function. The interpolations flatten each joint's spline functions into
+ * a sequence of these so they can be evaluated directly, without the
+ * virtual calls and nested domain searches of the generic spline
+ * functions.
+ *
+ * @sa TrajectoryCursor.
+ **/
+class TrajectoryPiece {
+    public:
+        /**
+         * @brief Polynomial piece.
+         *
+         * @param end_time : the end of this piece's interval.
+         * @param polynomial : the polynomial for the interval.
+         */
+        TrajectoryPiece(const double &end_time, const QuinticPolynomial &polynomial) :
+            end(end_time),
+            tension(0.0),
+            is_polynomial(true)
+        {
+            for ( unsigned int i = 0; i < 6; ++i ) {
+                coefficients[i] = polynomial.coefficients()[i];
+            }
+        }
+        /**
+         * @brief Tension function piece.
+         *
+         * @param end_time : the end of this piece's interval.
+         * @param function : the tension function for the interval.
+         * @param tau : the tension parameter.
+         */
+        TrajectoryPiece(const double &end_time, const TensionFunction &function, const double &tau) :
+            end(end_time),
+            tension(tau),
+            tension_function(function),
+            is_polynomial(false)
+        {}
+
+        /**
+         * @brief Position, velocity and acceleration at the specified time.
+         */
+        void evaluate(const double &time, double &position, double &velocity, double &acceleration) const {
+            if ( is_polynomial ) {
+                double half_acceleration = 0.0;
+                position = coefficients[5];
+                velocity = 0.0;
+                geometry::Horner<5>::derivatives(coefficients, time, position, velocity, half_acceleration);
+                acceleration = 2.0*half_acceleration;
+            } else {
+                tension_function.evaluate(tension, time, position, velocity, acceleration);
+            }
+        }
+
+        double end; /**< @brief End of the piece's interval (it starts where the previous piece ends). **/
+
+    private:
+        double coefficients[6];
+        double tension;
+        TensionFunction tension_function;
+        bool is_polynomial;
+};
+
 /*****************************************************************************
 ** Interface [Trajectory][PrimaryTemplate]
 *****************************************************************************/
@@ -102,6 +177,7 @@ class Trajectory<JointAngles> {
         Trajectory(const unsigned int& dimension, const char* name_identifier = "") :
             name(name_identifier),
             spline_functions(dimension),
+            pieces(dimension),
             max_accelerations(Array<double>::Constant(dimension,0.0))
         {}
 
@@ -140,6 +216,7 @@ class Trajectory<JointAngles> {
         void redimension(const unsigned int &dim) {
         	clear();
         	spline_functions.resize(dim);
+        	pieces.resize(dim);
         	max_accelerations = Array<double>::Constant(dim,0.0);
         }
 
@@ -334,9 +411,12 @@ class Trajectory<JointAngles> {
         const double& duration() const { return trajectory_duration; }
         Parameter<std::string> name; /**< @brief String name identifier. **/
 
+        friend class TrajectoryCursor;
+
     private:
         std::vector< WayPoint<JointAngles> > waypoints;
         Array< std::vector<GenericSplineFunction*> > spline_functions;
+        Array< std::vector<TrajectoryPiece> > pieces; // the spline functions, flattened
         Array< double> max_accelerations;
         double trajectory_duration;
 
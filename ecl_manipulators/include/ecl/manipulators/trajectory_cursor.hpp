@@ -0,0 +1,115 @@
+/**
+ * @file /include/ecl/manipulators/trajectory_cursor.hpp
+ *
+ * @brief Real time sampling of joint angle trajectories.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_MANIPULATORS_TRAJECTORY_CURSOR_HPP_
+#define ECL_MANIPULATORS_TRAJECTORY_CURSOR_HPP_
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <vector>
+#include <ecl/containers/array.hpp>
+#include <ecl/exceptions/macros.hpp>
+#include <ecl/exceptions/standard_exception.hpp>
+#include "trajectory.hpp"
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Interface [TrajectoryCursor]
+*****************************************************************************/
+/**
+ * @brief Samples every joint of a trajectory at once, for steadily increasing times.
+ *
+ * Sampling a trajectory through its operator(), derivative() and
+ * dderivative() searches from the start of the trajectory (and through
+ * virtual spline functions) for every joint, every derivative and every
+ * call. The cursor instead takes a copy of the trajectory's flattened
+ * pieces on construction and remembers the active piece of each joint,
+ * so sampling at monotonically increasing times (e.g. a control loop
+ * playing back the trajectory) only ever steps forward a piece now and
+ * then. Sampling does no virtual calls and no allocations, so it is safe
+ * to use in real time threads.
+ *
+ * Times going backwards are fine too, they just restart the search from
+ * the beginning of the trajectory.
+ *
+ * <b>Usage:</b>
+ *
+ * @code
+ * trajectory.tensionSplineInterpolation(4.0);
+ * TrajectoryCursor cursor(trajectory);
+ * Array<double> positions(7), velocities(7), accelerations(7);
+ * for ( double t = 0.0; t <= cursor.duration(); t += 0.001 ) {
+ *     cursor.sample(t, positions, velocities, accelerations);
+ *     // command the arm
+ * }
+ * @endcode
+ *
+ * @sa Trajectory.
+ **/
+class TrajectoryCursor {
+    public:
+        /**
+         * @brief Copies the (interpolated) trajectory's pieces.
+         *
+         * The cursor doesn't refer back to the trajectory, so it remains
+         * valid if the trajectory is later changed or destroyed.
+         *
+         * @param trajectory : an interpolated trajectory.
+         * @exception : StandardException : throws if the trajectory hasn't been interpolated yet [debug mode only].
+         */
+        TrajectoryCursor(const Trajectory<JointAngles> &trajectory);
+
+        /**
+         * @brief Position, velocity and acceleration of every joint at the specified time.
+         *
+         * Times beyond the end of the trajectory are clamped to the end.
+         *
+         * @param time : time since the start of the trajectory.
+         * @param positions : preallocated with the trajectory's dimension, filled in.
+         * @param velocities : preallocated with the trajectory's dimension, filled in.
+         * @param accelerations : preallocated with the trajectory's dimension, filled in.
+         * @exception : StandardException : throws if time is negative or the arrays are the wrong size [debug mode only].
+         */
+        void sample(const double &time, Array<double> &positions, Array<double> &velocities, Array<double> &accelerations);
+        /**
+         * @brief Rewind to the start of the trajectory.
+         */
+        void reset();
+
+        /**
+         * @brief Number of joints being sampled.
+         *
+         * @return unsigned int : number of joints.
+         */
+        unsigned int dimension() const { return active.size(); }
+        /**
+         * @brief Total trajectory duration (in seconds).
+         *
+         * @return const double& : the time required for the entire trajectory.
+         */
+        const double& duration() const { return trajectory_duration; }
+
+    private:
+        Array< std::vector<TrajectoryPiece> > pieces;
+        Array<unsigned int> active;
+        double trajectory_duration;
+};
+
+} // namespace ecl
+
+#endif /* ECL_MANIPULATORS_TRAJECTORY_CURSOR_HPP_ */
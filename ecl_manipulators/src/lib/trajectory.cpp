@@ -11,6 +11,7 @@
  *****************************************************************************/
 
 #include <ecl/linear_algebra.hpp> // has to be first (eigen stdvector defn).
+#include <algorithm>
 #include "../../include/ecl/manipulators/waypoint.hpp"
 #include "../../include/ecl/manipulators/trajectory.hpp"
 #include <ecl/geometry/function_math.hpp>
@@ -64,54 +65,76 @@ void Trajectory<JointAngles>::tensionSplineInterpolation(const double &tension)
   Array<QuinticPolynomial> leading_quintics(dimension()), trailing_quintics(dimension());
 
   /******************************************
-   ** Roughly Generate Tension Spline
+   ** Stretch Durations for Max Accelerations
    *******************************************/
+  // - tension splines have high accelerations at the joins.
+  // - inbetween the joins, the acceleration goes towards zero.
+  // - so we just check the size of the acceleration at the joins to find trouble spots.
+  // These come straight out of the tridiagonal solve, no need to generate the splines.
+  // Offending segments are stretched by the factor that would fix them if the accelerations
+  // scaled with 1/duration^2 (a newton step on that model) rather than creeping up by 10%.
+  Array<double> waypoint_times(n + 1), values(n + 1), stretches(n);
+  Array<double> worst_ratios(n + 1);
+  Array<unsigned int> worst_joints(n + 1);
   bool splines_constrained = false;
   while (!splines_constrained)
   {
-    tension_splines = generateTensionSplines(tension, 0.0);
-    /*********************
-     ** Check Max Accel
-     **********************/
-    Array<double> domain = tension_splines[0].domain();
-    splines_constrained = true; // This changes to false if we break the max accel constraint
-    // - tension splines have high accelerations at the joins.
-    // - inbetween the joins, the acceleration goes towards zero.
-    // - so we just check the size of the acceleration at the joins to find trouble spots.
-    for (unsigned int i = 1; i < domain.size() - 1; ++i)
-    { // Natural spline, first and last accelerations are always zero, so dont worry about them
-      for (unsigned int j = 0; j < dimension(); ++j)
+    waypoint_times[0] = 0.0;
+    for (unsigned int i = 1; i < n + 1; ++i)
+    {
+      waypoint_times[i] = waypoint_times[i - 1] + waypoints[i - 1].duration();
+    }
+    for (unsigned int i = 0; i < n + 1; ++i)
+    {
+      worst_ratios[i] = 0.0;
+    }
+    for (unsigned int j = 0; j < dimension(); ++j)
+    {
+      for (unsigned int i = 0; i < n + 1; ++i)
       {
-        double accel = fabs(tension_splines[j].dderivative(domain[i]));
-        /*********************
-         ** Debugging
-         **********************/
-//                std::cout << "Accel checking" << std::endl;
-//                std::cout << "  Domain: " << domain << std::endl;
-//                std::cout << "  Accel[" << i << "," << j << "]: " << accel << std::endl;
-//                sleep(1);
-        if (accel > max_accelerations[j])
+        values[i] = waypoints[i].angles()[j];
+      }
+      blueprints::C2TensionSpline blueprint(waypoint_times, values, tension);
+      const Array<double> &accelerations = blueprint.secondDerivatives();
+      for (unsigned int i = 1; i < n; ++i)
+      { // Natural spline, first and last accelerations are always zero, so dont worry about them
+        double ratio = fabs(accelerations[i]) / max_accelerations[j];
+        if (ratio > worst_ratios[i])
         {
-          splines_constrained = false;
-          double slope_before = fabs(
-              (waypoints[i].angles()[j] - waypoints[i - 1].angles()[j]) / waypoints[i - 1].duration());
-          double slope_after = fabs(
-              (waypoints[i + 1].angles()[j] - waypoints[i].angles()[j]) / waypoints[i].duration());
-//                    std::cout << "  Slope_Before[" << i << "," << j << "]: " << slope_before << std::endl;
-//                    std::cout << "  Slope_After [" << i << "," << j << "]: " << slope_after << std::endl;
-          if (slope_before > slope_after)
-          {
-            waypoints[i - 1].duration(waypoints[i - 1].duration() * 1.1); // 10% increase
-          }
-          else
-          {
-            waypoints[i].duration(waypoints[i].duration() * 1.1); // 10% increase
-          }
-//                    i = domain.size(); // Force it to restart <-- This doesn't actually work so well - dampen the whole curve at once instead of gradually from one end!
-          break;
+          worst_ratios[i] = ratio;
+          worst_joints[i] = j;
         }
       }
     }
+    splines_constrained = true; // This changes to false if we break the max accel constraint
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      stretches[i] = 1.0;
+    }
+    for (unsigned int i = 1; i < n; ++i)
+    {
+      if (worst_ratios[i] > 1.0)
+      {
+        splines_constrained = false;
+        unsigned int j = worst_joints[i];
+        double slope_before = fabs(
+            (waypoints[i].angles()[j] - waypoints[i - 1].angles()[j]) / waypoints[i - 1].duration());
+        double slope_after = fabs(
+            (waypoints[i + 1].angles()[j] - waypoints[i].angles()[j]) / waypoints[i].duration());
+        // at least 1% so it doesn't crawl in on the bound, at most double so one bad join can't blow up
+        double stretch = std::min(std::max(sqrt(worst_ratios[i]), 1.01), 2.0);
+        // neighbouring joins may both want to stretch the same segment, only do it once
+        unsigned int segment = (slope_before > slope_after) ? i - 1 : i;
+        stretches[segment] = std::max(stretches[segment], stretch);
+      }
+    }
+    for (unsigned int i = 0; i < n; ++i)
+    {
+      if (stretches[i] != 1.0)
+      {
+        waypoints[i].duration(waypoints[i].duration() * stretches[i]);
+      }
+    }
   }
   /******************************************
    ** Check rates are set for head/tail
@@ -130,6 +153,10 @@ void Trajectory<JointAngles>::tensionSplineInterpolation(const double &tension)
   /******************************************
    ** Make the pre pseudo point.
    *******************************************/
+  // The tension spline gets moved to the right by t to give us some space to insert a quintic.
+  // That only translates it, so sample the unmoved spline at t rather than generating a moved
+  // one for every t. It only needs regenerating if the first duration changes.
+  tension_splines = generateTensionSplines(tension, 0.0);
   double leading_quintic_time = 0.0;
   bool quintic_constrained = false;
   while (!quintic_constrained)
@@ -138,13 +165,11 @@ void Trajectory<JointAngles>::tensionSplineInterpolation(const double &tension)
     for (unsigned int i = 1; i <= 5; ++i)
     {
       double t = i * waypoints[0].duration() / 10;
-      // move the tension spline to the right, i.e. give us some space to insert a quintic
-      tension_splines = generateTensionSplines(tension, t); // t <-- is the initial time to start the tension spline
       for (unsigned int j = 0; j < dimension(); ++j)
       {
         // find the right side boundary conditions for the quintic we want to insert
-        double y_dot = tension_splines[j].derivative(2 * t);
-        double y = tension_splines[j](2 * t);
+        double y_dot = tension_splines[j].derivative(t);
+        double y = tension_splines[j](t);
         // the left side boundary conditions for the quintic
         double y_0 = waypoints[0].angles()[j];
         double y_0_dot = waypoints[0].rates()[j];
@@ -189,6 +214,7 @@ void Trajectory<JointAngles>::tensionSplineInterpolation(const double &tension)
       { // give up, go back to start of while loop with increased duration
 //				std::cout << "Quintic unconstrained, increasing the first duration : " << waypoints[0].duration() << std::endl;
         waypoints[0].duration(waypoints[0].duration() * 1.1); // 10% increase
+        tension_splines = generateTensionSplines(tension, 0.0);
         break; // from the for loop
       }
     }
@@ -200,10 +226,10 @@ void Trajectory<JointAngles>::tensionSplineInterpolation(const double &tension)
   double trailing_quintic_time_0 = 0.0;
   double trailing_quintic_time_f = 0.0;
   quintic_constrained = false;
+  tension_splines = generateTensionSplines(tension, leading_quintic_time / 2);
   while (!quintic_constrained)
   {
     quintic_constrained = true;
-    tension_splines = generateTensionSplines(tension, leading_quintic_time / 2);
     for (unsigned int i = 1; i <= 5; ++i)
     {
       double t = i * waypoints[n - 1].duration() / 10;
@@ -255,6 +281,7 @@ void Trajectory<JointAngles>::tensionSplineInterpolation(const double &tension)
       if (!quintic_constrained)
       { // give up, go back to start of while loop with increased duration
         waypoints[n - 1].duration(waypoints[n - 1].duration() * 1.1); // 10% increase
+        tension_splines = generateTensionSplines(tension, leading_quintic_time / 2);
         break;
       }
     }
@@ -276,6 +303,24 @@ void Trajectory<JointAngles>::tensionSplineInterpolation(const double &tension)
                                                                tension_splines[j]);
     spline_functions[j][2] = new SplineFunction<QuinticPolynomial>(trailing_quintic_time_0, trailing_quintic_time_f,
                                                                    trailing_quintics[j]);
+    // flattened, only the tension functions between the quintics
+    const Array<double> &domain = tension_splines[j].domain();
+    const Array<TensionFunction> &functions = tension_splines[j].functions();
+    pieces[j].push_back(TrajectoryPiece(leading_quintic_time, leading_quintics[j]));
+    for (unsigned int i = 0; i < functions.size(); ++i)
+    {
+      if (domain[i + 1] <= leading_quintic_time)
+      {
+        continue;
+      }
+      pieces[j].push_back(TrajectoryPiece(std::min(domain[i + 1], trailing_quintic_time_0), functions[i], tension));
+      if (domain[i + 1] >= trailing_quintic_time_0)
+      {
+        break;
+      }
+    }
+    pieces[j].back().end = trailing_quintic_time_0;
+    pieces[j].push_back(TrajectoryPiece(trailing_quintic_time_f, trailing_quintics[j]));
   }
   (void) result; // for unused variable warnings, in case the asserts weren't triggered
 }
@@ -369,6 +414,12 @@ void Trajectory<JointAngles>::linearSplineInterpolation()
   for (unsigned int j = 0; j < dimension(); ++j)
   {
     spline_functions[j][0] = new SplineFunction<SmoothLinearSpline>(0.0, splines[j].domain().back(), splines[j]);
+    const Array<double> &domain = splines[j].domain();
+    Array<QuinticPolynomial> polynomials = splines[j].polynomials();
+    for (unsigned int i = 0; i < polynomials.size(); ++i)
+    {
+      pieces[j].push_back(TrajectoryPiece(domain[i + 1], polynomials[i]));
+    }
   }
 }
 
@@ -508,6 +559,7 @@ void Trajectory<JointAngles>::clearSplines()
       }
     }
     spline_functions[joint].clear();
+    pieces[joint].clear();
   }
 }
 
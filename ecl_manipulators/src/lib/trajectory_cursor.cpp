@@ -0,0 +1,70 @@
+/**
+ * @file /src/lib/trajectory_cursor.cpp
+ *
+ * @brief Real time sampling of joint angle trajectories.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <ecl/linear_algebra.hpp> // has to be first (eigen stdvector defn).
+#include "../../include/ecl/manipulators/trajectory_cursor.hpp"
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Implementation [TrajectoryCursor]
+*****************************************************************************/
+
+TrajectoryCursor::TrajectoryCursor(const Trajectory<JointAngles> &trajectory) :
+    pieces(trajectory.pieces),
+    active(Array<unsigned int>::Constant(trajectory.dimension(), 0)),
+    trajectory_duration(trajectory.duration())
+{
+  for (unsigned int joint = 0; joint < pieces.size(); ++joint)
+  {
+    ecl_assert_throw( !pieces[joint].empty(),
+                     StandardException(LOC, ConfigurationError, "The trajectory has not been interpolated yet."));
+  }
+}
+
+void TrajectoryCursor::sample(const double &time, Array<double> &positions, Array<double> &velocities,
+                              Array<double> &accelerations)
+{
+  ecl_assert_throw( time >= 0.0, StandardException(LOC,OutOfRangeError));
+  ecl_assert_throw(
+      ( positions.size() == dimension() ) && ( velocities.size() == dimension() ) && ( accelerations.size() == dimension() ),
+      StandardException(LOC, InvalidInputError, "The output arrays must match the trajectory's dimension."));
+  for (unsigned int joint = 0; joint < pieces.size(); ++joint)
+  {
+    const std::vector<TrajectoryPiece> &joint_pieces = pieces[joint];
+    const unsigned int last = joint_pieces.size() - 1;
+    unsigned int &index = active[joint];
+    if ( ( index > 0 ) && ( time <= joint_pieces[index - 1].end ) )
+    {
+      index = 0; // went backwards, search again from the start
+    }
+    while ( ( index < last ) && ( time > joint_pieces[index].end ) )
+    {
+      ++index;
+    }
+    const double t = ( time > joint_pieces[last].end ) ? joint_pieces[last].end : time;
+    joint_pieces[index].evaluate(t, positions[joint], velocities[joint], accelerations[joint]);
+  }
+}
+
+void TrajectoryCursor::reset()
+{
+  for (unsigned int joint = 0; joint < active.size(); ++joint)
+  {
+    active[joint] = 0;
+  }
+}
+
+} // namespace ecl
@@ -20,6 +20,7 @@
 #include <ecl/geometry/spline_function.hpp>
 #include "../../include/ecl/manipulators/waypoint.hpp"
 #include "../../include/ecl/manipulators/trajectory.hpp"
+#include "../../include/ecl/manipulators/trajectory_cursor.hpp"
 
 
 /*****************************************************************************
@@ -37,6 +38,7 @@ using ecl::GenericSplineFunction;
 using ecl::SplineFunction;
 using ecl::JointAngles;
 using ecl::Trajectory;
+using ecl::TrajectoryCursor;
 using ecl::WayPoint;
 
 /*****************************************************************************
@@ -48,6 +50,48 @@ TEST(TrajectoryTests,allEggsInOneBasket) {
 	SUCCEED();
 }
 
+void expectCursorMatches(Trajectory<JointAngles> &trajectory) {
+	TrajectoryCursor cursor(trajectory);
+	EXPECT_EQ(trajectory.dimension(), cursor.dimension());
+	EXPECT_EQ(trajectory.duration(), cursor.duration());
+	Array<double> positions(2), velocities(2), accelerations(2);
+	const double period = 0.001;
+	for ( double t = 0.0; t <= trajectory.duration(); t += period ) {
+		cursor.sample(t, positions, velocities, accelerations);
+		for ( unsigned int j = 0; j < 2; ++j ) {
+			ASSERT_NEAR(trajectory(j,t), positions[j], 1e-9);
+			ASSERT_NEAR(trajectory.derivative(j,t), velocities[j], 1e-9);
+			ASSERT_NEAR(trajectory.dderivative(j,t), accelerations[j], 1e-8);
+		}
+	}
+	// backwards, and clamped at the end
+	const double times[] = { 0.5*trajectory.duration(), 0.1, trajectory.duration() + 0.00005 };
+	for ( unsigned int i = 0; i < 3; ++i ) {
+		const double t = ( times[i] > trajectory.duration() ) ? trajectory.duration() : times[i];
+		cursor.sample(times[i], positions, velocities, accelerations);
+		for ( unsigned int j = 0; j < 2; ++j ) {
+			EXPECT_NEAR(trajectory(j,t), positions[j], 1e-9);
+			EXPECT_NEAR(trajectory.derivative(j,t), velocities[j], 1e-9);
+		}
+	}
+}
+
+TEST(TrajectoryTests,cursor) {
+	Trajectory<JointAngles> trajectory(2);
+	WayPoint<JointAngles> waypoint(2);
+	const double angles[5][2] = { {1.0, 1.0}, {2.0, 0.0}, {1.0, 5.0}, {3.0, 3.0}, {4.0, 2.0} };
+	for ( unsigned int i = 0; i < 5; ++i ) {
+		waypoint.angles() << angles[i][0], angles[i][1];
+		waypoint.nominalRates(1.0);
+		trajectory.append(waypoint);
+	}
+	trajectory.maxAccelerations(5);
+	trajectory.tensionSplineInterpolation(4.0);
+	expectCursorMatches(trajectory);
+	trajectory.linearSplineInterpolation();
+	expectCursorMatches(trajectory);
+}
+
 /*****************************************************************************
 ** Main program
 *****************************************************************************/
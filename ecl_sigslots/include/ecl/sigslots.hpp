@@ -27,6 +27,8 @@
 
 #include "sigslots/signal.hpp"
 #include "sigslots/slot.hpp"
+#include "sigslots/ipc_signal.hpp"
+#include "sigslots/ipc_slot.hpp"
 
 #ifdef replace_qt_emit
     #define emit
@@ -0,0 +1,71 @@
+/**
+ * @file /ecl_sigslots/include/ecl/sigslots/callbacks.hpp
+ *
+ * @brief Functions loaded into sigslots.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_SIGSLOTS_CALLBACKS_HPP_
+#define ECL_SIGSLOTS_CALLBACKS_HPP_
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+namespace sigslots {
+
+/*****************************************************************************
+** Interface [Callbacks]
+*****************************************************************************/
+/**
+ * @brief Not for direct use, the function loaded into a sigslot.
+ *
+ * Unlike the UnaryFunction objects, these take the data by const reference
+ * so emitting to any number of slots doesn't copy it. It is only copied if
+ * the slot's own function takes it by value.
+ */
+template <typename Data>
+class Callback {
+public:
+	virtual ~Callback() {}
+	virtual void operator()(const Data& data) = 0; /**< @brief Run the function. **/
+};
+
+/**
+ * @brief Not for direct use, a global/static function loaded into a sigslot.
+ */
+template <typename Data>
+class FreeCallback : public Callback<Data> {
+public:
+	FreeCallback(void (*f)(Data)) : function(f) {}
+	void operator()(const Data& data) { function(data); }
+private:
+	void (*function)(Data);
+};
+
+/**
+ * @brief Not for direct use, a member function loaded into a sigslot.
+ *
+ * @tparam C : the member function's class type.
+ * @tparam Data : the sigslot's data type.
+ * @tparam Argument : the member function's argument type.
+ */
+template <typename C, typename Data, typename Argument = Data>
+class MemberCallback : public Callback<Data> {
+public:
+	MemberCallback(void (C::*f)(Argument), C &c) : function(f), instance(c) {}
+	void operator()(const Data& data) { (instance.*function)(data); }
+private:
+	void (C::*function)(Argument);
+	C &instance;
+};
+
+} // namespace sigslots
+} // namespace ecl
+
+#endif /* ECL_SIGSLOTS_CALLBACKS_HPP_ */
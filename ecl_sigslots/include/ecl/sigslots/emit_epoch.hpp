@@ -0,0 +1,129 @@
+/**
+ * @file /ecl_sigslots/include/ecl/sigslots/emit_epoch.hpp
+ *
+ * @brief Grace periods for reclaiming subscriber snapshots.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_SIGSLOTS_EMIT_EPOCH_HPP_
+#define ECL_SIGSLOTS_EMIT_EPOCH_HPP_
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <atomic>
+#include <thread>
+#include <ecl/config/macros.hpp>
+#include <ecl/threads/mutex.hpp>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+namespace sigslots {
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+/**
+ * @brief Number of emits the calling thread is currently inside (of any type).
+ *
+ * A thread that is emitting can't wait for emits to finish (it would be
+ * waiting on itself), so connections made from inside slots defer their
+ * reclamation instead.
+ */
+inline unsigned int& emitDepth() {
+	static thread_local unsigned int depth = 0;
+	return depth;
+}
+
+/*****************************************************************************
+** Interface [EmitEpoch]
+*****************************************************************************/
+/**
+ * @brief Not for direct use, tracks emits in flight for the sigslots of one type.
+ *
+ * Emits read a signal's subscriber snapshot without locking. Connecting
+ * or disconnecting swaps in a new snapshot, but may only delete the old one
+ * once every emit that could still be reading it has finished - a grace
+ * period, read-copy-update style.
+ *
+ * Emits register on one of two counters, chosen by the parity of the
+ * epoch. Waiting for a grace period flips the epoch so that new emits
+ * register on the other counter, waits for the old one to drain and then
+ * does the same again the other way round.
+ */
+class ECL_LOCAL EmitEpoch {
+public:
+	EmitEpoch() : epoch(0) {
+		readers[0] = 0;
+		readers[1] = 0;
+	}
+
+	/**
+	 * @brief Register an emit.
+	 * @return unsigned int : the counter to pass back to leave().
+	 */
+	unsigned int enter() {
+		const unsigned int parity = epoch.load() & 1;
+		readers[parity].fetch_add(1); // sequentially consistent, before the snapshot is loaded
+		++emitDepth();
+		return parity;
+	}
+	/**
+	 * @brief Unregister an emit.
+	 * @param parity : as returned by enter().
+	 */
+	void leave(const unsigned int& parity) {
+		--emitDepth();
+		readers[parity].fetch_sub(1, std::memory_order_release);
+	}
+	/**
+	 * @brief Wait until every emit that started before this call has finished.
+	 *
+	 * Must not be called from inside an emit.
+	 */
+	void synchronise() {
+		mutex.lock(); // the two flips only cover both counters if waiters take turns
+		for ( unsigned int i = 0; i < 2; ++i ) {
+			const unsigned int parity = epoch.load() & 1;
+			epoch.store(parity ^ 1);
+			while ( readers[parity].load() != 0 ) { // sequentially consistent, after the snapshot swap
+				std::this_thread::yield();
+			}
+		}
+		mutex.unlock();
+	}
+
+private:
+	std::atomic<unsigned int> epoch;
+	std::atomic<unsigned long> readers[2];
+	Mutex mutex;
+};
+
+/*****************************************************************************
+** Interface [EmitGuard]
+*****************************************************************************/
+/**
+ * @brief Keeps an emit registered for its scope (even if a slot throws).
+ */
+class ECL_LOCAL EmitGuard {
+public:
+	EmitGuard(EmitEpoch &epoch) : emit_epoch(epoch), parity(epoch.enter()) {}
+	~EmitGuard() { emit_epoch.leave(parity); }
+
+private:
+	EmitEpoch &emit_epoch;
+	const unsigned int parity;
+};
+
+} // namespace sigslots
+} // namespace ecl
+
+#endif /* ECL_SIGSLOTS_EMIT_EPOCH_HPP_ */
@@ -0,0 +1,164 @@
+/**
+ * @file /ecl_sigslots/include/ecl/sigslots/executor.hpp
+ *
+ * @brief Threads that run queued slots.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_SIGSLOTS_EXECUTOR_HPP_
+#define ECL_SIGSLOTS_EXECUTOR_HPP_
+
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#include <ecl/config/ecl.hpp>
+#if defined(ECL_HAS_POSIX_THREADS)
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <atomic>
+#include <vector>
+#include <ecl/config/macros.hpp>
+#include <ecl/exceptions/macros.hpp>
+#include <ecl/exceptions/standard_exception.hpp>
+#include <ecl/threads/mpmc_queue.hpp>
+#include <ecl/threads/priority.hpp>
+#include <ecl/threads/thread.hpp>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+namespace sigslots {
+
+/*****************************************************************************
+** Interface [QueuedWork]
+*****************************************************************************/
+/**
+ * @brief Not for direct use, a queued slot as seen by its executor.
+ */
+class ECL_LOCAL QueuedWork {
+public:
+	virtual ~QueuedWork() {}
+	/**
+	 * @brief Process the slot's queued payloads.
+	 *
+	 * Called by one executor thread at a time, for as long as the slot
+	 * stays scheduled.
+	 */
+	virtual void drain() = 0;
+};
+
+template <typename Data> class SlotQueue;
+
+} // namespace sigslots
+
+/*****************************************************************************
+** Interface [SlotExecutor]
+*****************************************************************************/
+/**
+ * @brief Threads that run queued slots, away from the emitting thread.
+ *
+ * Slots are normally run by the thread that emits, so a slow slot holds up
+ * the emitter. A slot constructed with an executor instead queues a copy of
+ * each payload it receives and leaves it to one of the executor's threads
+ * to run its function.
+ *
+ * A slot with queued payloads is scheduled on the executor once (not once
+ * per payload), and only one thread drains it at a time, so a queued slot
+ * sees its payloads in order and is never run concurrently with itself.
+ * Separate slots are drained in parallel when there is more than one
+ * thread.
+ *
+ * <b>Usage:</b>
+ *
+ * @code
+ * SlotExecutor executor(1, BackgroundPriority);
+ * Slot<const Odom&> visualiser(&Visualiser::update, viz, executor, 4, DropOldest);
+ * visualiser.connect("odometry");
+ * @endcode
+ *
+ * Slots queueing on an executor must be destroyed before it is.
+ *
+ * @sa Slot, QueueOverflowPolicy.
+ */
+class ECL_PUBLIC SlotExecutor {
+public:
+	static const unsigned int max_slots = 1024; /**< @brief Limit on the number of queued slots on one executor. **/
+
+	/**
+	 * @brief Spawn the executor's threads.
+	 *
+	 * @param number_of_threads : number of threads running queued slots.
+	 * @param priority : priority for those threads.
+	 *
+	 * @exception StandardException : throws if a thread could not be spawned [debug mode only].
+	 */
+	SlotExecutor(const unsigned int &number_of_threads = 1, const Priority &priority = DefaultPriority) :
+		number_of_slots(0)
+	{
+		for ( unsigned int i = 0; i < number_of_threads; ++i ) {
+			threads.push_back(new Thread(&SlotExecutor::run, *this, priority));
+		}
+	}
+	/**
+	 * @brief Stop and join the threads.
+	 *
+	 * Slots still queued when the executor is destroyed are not run.
+	 */
+	virtual ~SlotExecutor() {
+		for ( unsigned int i = 0; i < threads.size(); ++i ) {
+			ready.push(NULL); // one stop request for each thread
+		}
+		for ( unsigned int i = 0; i < threads.size(); ++i ) {
+			threads[i]->join();
+			delete threads[i];
+		}
+	}
+
+	unsigned int size() const { return threads.size(); } /**< @brief Number of threads. **/
+	unsigned int slots() const { return number_of_slots.load(std::memory_order_relaxed); } /**< @brief Number of slots queueing on this executor. **/
+
+private:
+	template <typename Data> friend class sigslots::SlotQueue;
+
+	/**
+	 * Each slot is on the ready queue at most once, so the limit on slots
+	 * guarantees there is always room to schedule one.
+	 */
+	void attach() {
+		const unsigned int count = number_of_slots.fetch_add(1) + 1;
+		ecl_assert_throw( count <= max_slots, StandardException(LOC, OutOfRangeError, "Too many queued slots on one executor."));
+		(void)count;
+	}
+	void detach() { number_of_slots.fetch_sub(1); }
+	void schedule(sigslots::QueuedWork *work) { ready.push(work); }
+
+	void run() {
+		sigslots::QueuedWork *work;
+		for (;;) {
+			ready.pop(work);
+			if ( work == NULL ) {
+				return;
+			}
+			work->drain();
+		}
+	}
+
+	MpmcQueue<sigslots::QueuedWork*, 2*max_slots> ready; // slots with payloads waiting
+	std::atomic<unsigned int> number_of_slots;
+	std::vector<Thread*> threads;
+};
+
+} // namespace ecl
+
+#endif /* ECL_HAS_POSIX_THREADS */
+#endif /* ECL_SIGSLOTS_EXECUTOR_HPP_ */
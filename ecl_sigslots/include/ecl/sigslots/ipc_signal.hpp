@@ -0,0 +1,185 @@
+/**
+ * @file /ecl_sigslots/include/ecl/sigslots/ipc_signal.hpp
+ *
+ * @brief Signals that reach slots in other processes.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_SIGSLOTS_IPC_SIGNAL_HPP_
+#define ECL_SIGSLOTS_IPC_SIGNAL_HPP_
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <ecl/ipc/topic_registry.hpp>
+
+#ifdef ECL_HAS_TOPIC_REGISTRY
+
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <ecl/config/macros.hpp>
+#include <ecl/errors/compile_time_assert.hpp>
+#include <ecl/ipc/message_channel.hpp>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Interface [IpcSignal]
+*****************************************************************************/
+/**
+ * @brief Signal that emits to IpcSlot's in other processes.
+ *
+ * Connects by topic name just like Signal, but the topic is looked up in a
+ * TopicRegistry shared by every process on the machine and the data is
+ * copied into each subscriber's MessageChannel (a shared memory ring
+ * with futex wakeups). The data must therefore be trivially copyable
+ * - no pointers, strings or containers.
+ *
+ * Subscribers are looked up once and then again only when the registry's
+ * generation counter moves, so an emit is one atomic load plus a copy
+ * into each channel. Emitting never blocks: if a subscriber's channel
+ * is full, the data is dropped for that subscriber and counted in
+ * dropped().
+ *
+ * Unlike Signal, emitting is not thread safe - give each thread its
+ * own IpcSignal.
+ *
+ * @code
+ * struct Odometry { double x, y, heading; };
+ *
+ * ecl::IpcSignal<const Odometry&> signal("odometry");
+ * signal.emit(odometry); // reaches IpcSlot<const Odometry&>("odometry") in any process
+ * @endcode
+ *
+ * @sa IpcSlot, TopicRegistry, MessageChannel.
+ */
+template <typename Data>
+class ECL_PUBLIC IpcSignal {
+public:
+	typedef typename std::remove_cv<typename std::remove_reference<Data>::type>::type Payload; /**< @brief The type actually copied across. **/
+
+	/**
+	 * @brief Publish to the named topic.
+	 *
+	 * @param topic : the topic name, shorter than 64 characters.
+	 * @param registry : name of the registry segment (only needs changing for tests).
+	 *
+	 * @exception StandardException : throws if the registry couldn't be opened.
+	 */
+	IpcSignal(const std::string &topic, const std::string &registry = "ecl_sigslots_registry") :
+		topic_name(topic),
+		topic_registry(registry),
+		generation(0),
+		stale(true),
+		dropped_count(0)
+	{
+		ecl_compile_time_assert(std::is_trivially_copyable<Payload>::value);
+	}
+	/**
+	 * @brief Closes the subscribers' channels (they stay with their subscribers).
+	 */
+	virtual ~IpcSignal() {
+		close();
+	}
+
+	/**
+	 * @brief Copy the data to every subscriber.
+	 *
+	 * @param data : the data to emit.
+	 * @return unsigned int : the number of subscribers it reached.
+	 */
+	unsigned int emit(Data data) {
+		if ( stale || ( topic_registry.generation() != generation ) ) {
+			refresh();
+		}
+		unsigned int reached = 0;
+		for ( unsigned int i = 0; i < channels.size(); ++i ) {
+			if ( channels[i].second->write(reinterpret_cast<const char*>(&data), sizeof(Payload)) ) {
+				++reached;
+			} else {
+				// full - now and then look again in case the subscriber died without anyone noticing
+				if ( ( dropped_count++ % 256 ) == 0 ) {
+					stale = true;
+				}
+			}
+		}
+		return reached;
+	}
+
+	/**
+	 * @brief Number of subscribers found on the last emit.
+	 */
+	unsigned int subscribers() const { return channels.size(); }
+	/**
+	 * @brief Number of messages dropped because a subscriber's channel was full.
+	 */
+	unsigned long dropped() const { return dropped_count; }
+	/**
+	 * @brief The topic emitted to.
+	 */
+	const std::string& topic() const { return topic_name; }
+
+private:
+	IpcSignal(const IpcSignal&); // non-copyable, owns the channel handles
+	IpcSignal& operator=(const IpcSignal&);
+
+	/**
+	 * @brief Look the subscribers up again, keeping the channels already open.
+	 */
+	void refresh() {
+		generation = topic_registry.generation(); // before the lookup, so a change during it isn't missed
+		topic_registry.subscribers(topic_name, sizeof(Payload), found);
+		std::vector< std::pair<std::string, MessageChannel*> > refreshed;
+		for ( unsigned int i = 0; i < found.size(); ++i ) {
+			MessageChannel *channel = NULL;
+			for ( unsigned int j = 0; j < channels.size(); ++j ) {
+				if ( ( channels[j].second != NULL ) && ( channels[j].first == found[i].channel ) ) {
+					channel = channels[j].second;
+					channels[j].second = NULL;
+					break;
+				}
+			}
+			if ( channel == NULL ) {
+				try {
+					channel = new MessageChannel(found[i].channel, found[i].capacity);
+				} catch ( const StandardException &e ) {
+					continue; // the subscriber went away since the lookup
+				}
+			}
+			refreshed.push_back(std::make_pair(found[i].channel, channel));
+		}
+		close();
+		channels.swap(refreshed);
+		stale = false;
+	}
+	void close() {
+		for ( unsigned int i = 0; i < channels.size(); ++i ) {
+			delete channels[i].second;
+		}
+		channels.clear();
+	}
+
+	std::string topic_name;
+	TopicRegistry topic_registry;
+	uint64_t generation;
+	bool stale;
+	unsigned long dropped_count;
+	std::vector<ipc::TopicSubscriber> found;
+	std::vector< std::pair<std::string, MessageChannel*> > channels;
+};
+
+} // namespace ecl
+
+#endif /* ECL_HAS_TOPIC_REGISTRY */
+#endif /* ECL_SIGSLOTS_IPC_SIGNAL_HPP_ */
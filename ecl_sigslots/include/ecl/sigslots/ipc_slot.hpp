@@ -0,0 +1,190 @@
+/**
+ * @file /ecl_sigslots/include/ecl/sigslots/ipc_slot.hpp
+ *
+ * @brief Slots that receive from signals in other processes.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_SIGSLOTS_IPC_SLOT_HPP_
+#define ECL_SIGSLOTS_IPC_SLOT_HPP_
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <ecl/ipc/topic_registry.hpp>
+
+#ifdef ECL_HAS_TOPIC_REGISTRY
+
+#include <atomic>
+#include <sched.h>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <ecl/config/macros.hpp>
+#include <ecl/errors/compile_time_assert.hpp>
+#include <ecl/exceptions/macros.hpp>
+#include <ecl/exceptions/standard_exception.hpp>
+#include <ecl/ipc/message_channel.hpp>
+#include <ecl/threads/thread.hpp>
+#include "callbacks.hpp"
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Interface [IpcSlot]
+*****************************************************************************/
+/**
+ * @brief Slot that receives from IpcSignal's in other processes.
+ *
+ * Creates its own MessageChannel, registers it against the topic in the
+ * TopicRegistry and runs the function in a thread of its own that sleeps
+ * on the channel until something arrives. Publishers only find subscribers
+ * whose data is the same size, so mismatched types on a topic don't
+ * connect, but beyond that it is up to you to use the same type at both
+ * ends.
+ *
+ * The function must take the data (by value or const reference) and is
+ * never run concurrently with itself.
+ *
+ * @code
+ * void odometryCallback(const Odometry &odometry) { ... }
+ *
+ * ecl::IpcSlot<const Odometry&> slot(odometryCallback, "odometry");
+ * @endcode
+ *
+ * @sa IpcSignal, TopicRegistry, MessageChannel.
+ */
+template <typename Data>
+class ECL_PUBLIC IpcSlot {
+public:
+	typedef typename std::remove_cv<typename std::remove_reference<Data>::type>::type Payload; /**< @brief The type actually copied across. **/
+
+	/**
+	 * @brief Subscribe a global/static function to the named topic.
+	 *
+	 * @param f : the global/static function.
+	 * @param topic : the topic name, shorter than 64 characters.
+	 * @param capacity : bytes in the slot's channel (messages take sizeof(Data) + 8, rounded up to 8).
+	 * @param registry : name of the registry segment (only needs changing for tests).
+	 *
+	 * @exception StandardException : throws if the channel or registry couldn't be opened or the registry is full.
+	 */
+	IpcSlot(void (*f)(Data), const std::string &topic, const unsigned long &capacity = 64*1024, const std::string &registry = "ecl_sigslots_registry") :
+		callback(new sigslots::FreeCallback<Data>(f)),
+		channel(NULL),
+		topic_registry(registry),
+		entry(-1),
+		received_count(0)
+	{
+		subscribe(topic, capacity);
+	}
+	/**
+	 * @brief Subscribe a member function to the named topic.
+	 *
+	 * @param f : the member function.
+	 * @param c : the class instance.
+	 * @param topic : the topic name, shorter than 64 characters.
+	 * @param capacity : bytes in the slot's channel (messages take sizeof(Data) + 8, rounded up to 8).
+	 * @param registry : name of the registry segment (only needs changing for tests).
+	 *
+	 * @exception StandardException : throws if the channel or registry couldn't be opened or the registry is full.
+	 */
+	template<typename C>
+	IpcSlot(void (C::*f)(Data), C &c, const std::string &topic, const unsigned long &capacity = 64*1024, const std::string &registry = "ecl_sigslots_registry") :
+		callback(new sigslots::MemberCallback<C,Data>(f,c)),
+		channel(NULL),
+		topic_registry(registry),
+		entry(-1),
+		received_count(0)
+	{
+		subscribe(topic, capacity);
+	}
+	/**
+	 * @brief Unsubscribes, then stops the thread once it has run what already arrived.
+	 */
+	virtual ~IpcSlot() {
+		topic_registry.unsubscribe(entry);
+		// an empty message tells the thread to stop, make room for it if need be
+		const char stop = 0;
+		while ( !channel->write(&stop, 0) ) {
+			sched_yield();
+		}
+		thread.join();
+		delete channel;
+		delete callback;
+	}
+
+	/**
+	 * @brief Number of times the function has been run.
+	 */
+	unsigned long received() const { return received_count.load(std::memory_order_relaxed); }
+
+private:
+	IpcSlot(const IpcSlot&); // non-copyable, owns the channel and thread
+	IpcSlot& operator=(const IpcSlot&);
+
+	void subscribe(const std::string &topic, const unsigned long &capacity) {
+		ecl_compile_time_assert(std::is_trivially_copyable<Payload>::value);
+		const std::string name = TopicRegistry::uniqueName("ecl_sigslots");
+		try {
+			channel = new MessageChannel(name, capacity);
+		} catch ( ... ) {
+			delete callback;
+			throw;
+		}
+		entry = topic_registry.subscribe(topic, name, sizeof(Payload), channel->capacity());
+		if ( entry < 0 ) {
+			delete channel;
+			delete callback;
+			ecl_throw(StandardException(LOC,OutOfResourcesError,"The topic registry is full."));
+		}
+		thread.start(&IpcSlot<Data>::run, *this);
+	}
+
+	void run() {
+		// trivially copyable needn't mean default constructible
+		typename std::aligned_storage<sizeof(Payload), alignof(Payload)>::type storage;
+		const Payload &payload = *reinterpret_cast<const Payload*>(&storage);
+		for (;;) {
+			unsigned long length = 0;
+			const char *message = channel->front(length);
+			if ( message == NULL ) {
+				channel->wait();
+				continue;
+			}
+			if ( length == 0 ) {
+				channel->pop();
+				return;
+			}
+			if ( length != sizeof(Payload) ) {
+				channel->pop(); // not ours, see the class documentation
+				continue;
+			}
+			memcpy(&storage, message, sizeof(Payload));
+			channel->pop();
+			(*callback)(payload);
+			received_count.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	sigslots::Callback<Data> *callback;
+	MessageChannel *channel;
+	TopicRegistry topic_registry;
+	int entry;
+	std::atomic<unsigned long> received_count;
+	Thread thread;
+};
+
+} // namespace ecl
+
+#endif /* ECL_HAS_TOPIC_REGISTRY */
+#endif /* ECL_SIGSLOTS_IPC_SLOT_HPP_ */
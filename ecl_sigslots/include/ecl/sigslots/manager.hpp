@@ -19,12 +19,16 @@
 *****************************************************************************/
 
 #include <iostream>
-#include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 #include <ecl/exceptions/standard_exception.hpp>
 #include <ecl/config/macros.hpp>
+#include <ecl/threads/mutex.hpp>
 #include <ecl/utilities/void.hpp>
+#include "emit_epoch.hpp"
 #include "topic.hpp"
+#include "topic_handle.hpp"
 
 /*****************************************************************************
 ** Namespaces
@@ -43,6 +47,12 @@ namespace ecl {
  * class. However, it may be useful for debugging to actually check the number
  * of connections with the printStatistics() method.
  *
+ * Topics are looked up by their interned id (see TopicHandle) in a hash
+ * table, so connecting and disconnecting are constant time no matter how
+ * many topics there are. All changes are serialised by a mutex, which emits
+ * never take, so topics can be rewired on any thread while signals are
+ * emitting.
+ *
  * @tparam Data : the type of sigslots this manager looks after.
  */
 template<typename Data = Void>
@@ -58,10 +68,12 @@ public:
 	 */
 	static void printStatistics() {
 		std::cout << "Topics" << std::endl;
-		typename std::map< std::string, Topic<Data> >::iterator iter;
+		mutex().lock();
+		typename Topics::iterator iter;
 		for ( iter = topics().begin(); iter != topics().end(); ++iter ) {
 			std::cout << iter->second;
 		}
+		mutex().unlock();
 	}
 
 private:
@@ -69,6 +81,24 @@ private:
 	 * @brief A list of subscribers (slots) to a given topic.
 	 */
 	typedef typename Topic<Data>::Subscribers Subscribers;
+	/**
+	 * @brief Flattened list of the slots a signal emits to.
+	 */
+	typedef typename Topic<Data>::Snapshot Snapshot;
+	/**
+	 * @brief Snapshots and destroyed sigslots, waiting to be deleted.
+	 *
+	 * Destroyed sigslots are kept around with the snapshots, since emits
+	 * that still have them in a snapshot look at them (and skip them).
+	 */
+	struct Retired {
+		std::vector<const Snapshot*> snapshots;
+		std::vector<SigSlot<Data>*> sigslots;
+	};
+	/**
+	 * @brief The topic registry, keyed by interned topic id.
+	 */
+	typedef std::unordered_map<unsigned int, Topic<Data> > Topics;
 
 	/**
 	 * Connects the signal to the topic if it already exists, or creates
@@ -79,14 +109,8 @@ private:
 	 * @param sigslot : sigslot that will be publishing.
 	 * @return const Subscribers& : a reference to the subscriber list.
 	 */
-	static const Subscribers* connectSignal(const std::string& topic, SigSlot<Data>* sigslot) {
-		// Try and insert a new topic in case it doesn't already exist
-		// In any case, we always get the iterator back (to new or existing)
-		//
-		// Maybe improve the efficiency of this by specifying position
-		// refer to http://www.cplusplus.com/reference/stl/map/insert/
-		std::pair< typename std::map< std::string, Topic<Data> >::iterator,bool> ret = topics().insert( std::pair< std::string, Topic<Data> >(topic, Topic<Data>(topic)) );
-		Topic<Data>& current_topic = (ret.first)->second;
+	static const Subscribers* connectSignal(const TopicHandle& topic, SigSlot<Data>* sigslot) {
+		Topic<Data>& current_topic = findOrCreate(topic);
 		current_topic.addPublisher(sigslot);
 		return current_topic.subscribers();
 	}
@@ -97,16 +121,12 @@ private:
 	 *
 	 * @param topic : topic to subscribe (listen) to.
 	 * @param sigslot : sigslot that will be subscribing (listening).
+	 * @param retired : collects the publishers' old snapshots.
 	 */
-	static void connectSlot(const std::string& topic, SigSlot<Data>* sigslot) {
-		// Try and insert a new topic in case it doesn't already exist
-		// In any case, we always get the iterator back (to new or existing)
-		//
-		// Maybe improve the efficiency of this by specifying position
-		// refer to http://www.cplusplus.com/reference/stl/map/insert/
-		std::pair< typename std::map< std::string, Topic<Data> >::iterator,bool> ret = topics().insert(std::pair< std::string, Topic<Data> >(topic, Topic<Data>(topic)) );
-		Topic<Data>& current_topic = (ret.first)->second;
+	static void connectSlot(const TopicHandle& topic, SigSlot<Data>* sigslot, Retired& retired) {
+		Topic<Data>& current_topic = findOrCreate(topic);
 		current_topic.addSubscriber(sigslot);
+		refreshPublishers(current_topic, retired);
 	}
 
 	/**
@@ -116,15 +136,91 @@ private:
 	 *
 	 * @param topic : topic that the sigslot must be disconnected from.
 	 * @param sigslot : the sigslots that is to be disconnected.
+	 * @param retired : collects the publishers' old snapshots.
 	 */
-	static void disconnect(const std::string& topic, SigSlot<Data>* sigslot) {
-		typename std::map<std::string, Topic<Data> >::iterator iter = topics().find(topic);
-		if ( iter != topics().end() ) {
-			iter->second.disconnect(sigslot);
+	static void disconnect(const TopicHandle& topic, SigSlot<Data>* sigslot, Retired& retired) {
+		typename Topics::iterator iter = topics().find(topic.id());
+		if ( iter == topics().end() ) {
+			return;
 		}
+		iter->second.disconnect(sigslot);
 		if ( iter->second.empty() ) {
 			topics().erase(iter);
+		} else {
+			refreshPublishers(iter->second, retired);
+		}
+	}
+
+	/**
+	 * @brief Find the topic, creating it if it doesn't already exist.
+	 *
+	 * Unordered map nodes don't move, so the topic (and its subscriber
+	 * list, which signals hold on to) stays put as other topics come and go.
+	 *
+	 * @param topic : the topic's handle.
+	 * @return Topic : the new or existing topic.
+	 */
+	static Topic<Data>& findOrCreate(const TopicHandle& topic) {
+		typename Topics::iterator iter = topics().find(topic.id());
+		if ( iter == topics().end() ) {
+			iter = topics().insert(typename Topics::value_type(topic.id(), Topic<Data>(topic.name()))).first;
+		}
+		return iter->second;
+	}
+
+	/**
+	 * @brief Rebuild the snapshots of all the signals publishing to a topic.
+	 *
+	 * @param topic : the topic whose subscribers changed.
+	 * @param retired : collects the publishers' old snapshots.
+	 */
+	static void refreshPublishers(const Topic<Data>& topic, Retired& retired) {
+		typename std::set<SigSlot<Data>*>::const_iterator iter;
+		for ( iter = topic.publishers().begin(); iter != topic.publishers().end(); ++iter ) {
+			retired.snapshots.push_back((*iter)->refresh());
+		}
+	}
+
+	/**
+	 * @brief Delete snapshots and sigslots once no emit can be reading them anymore.
+	 *
+	 * Waits for a grace period, unless called from inside an emit (of any
+	 * type - a slot connecting, disconnecting or destroying), in which case
+	 * they are left for the next caller that can wait. Waiting there could
+	 * deadlock with another thread doing the same. Call without the lock.
+	 *
+	 * @param retired : snapshots that have been swapped out and destroyed sigslots.
+	 */
+	static void reclaim(Retired& retired) {
+		mutex().lock();
+		if ( sigslots::emitDepth() != 0 ) {
+			append(deferred(), retired);
+			mutex().unlock();
+			return;
+		}
+		append(retired, deferred());
+		mutex().unlock();
+		epoch().synchronise();
+		for ( unsigned int i = 0; i < retired.snapshots.size(); ++i ) {
+			delete retired.snapshots[i];
 		}
+		for ( unsigned int i = 0; i < retired.sigslots.size(); ++i ) {
+			delete retired.sigslots[i];
+		}
+		retired.snapshots.clear();
+		retired.sigslots.clear();
+	}
+	/**
+	 * @brief Move everything from one retired list to another.
+	 *
+	 * @param to : the list to append to.
+	 * @param from : the list to empty.
+	 */
+	static void append(Retired& to, Retired& from) {
+		to.snapshots.insert(to.snapshots.end(), from.snapshots.begin(), from.snapshots.end());
+		to.sigslots.insert(to.sigslots.end(), from.sigslots.begin(), from.sigslots.end());
+		from.snapshots.clear();
+		from.sigslots.clear();
 	}
 
 	/**
@@ -133,8 +229,8 @@ private:
 	 * @param topic : topic to check.
 	 * @return bool : success/failure of the request.
 	 */
-	static bool isTopic(const std::string& topic) {
-		return !( topics().find(topic) == topics().end() );
+	static bool isTopic(const TopicHandle& topic) {
+		return !( topics().find(topic.id()) == topics().end() );
 	}
 
 	/**
@@ -142,12 +238,39 @@ private:
 	 *
 	 * Simple trick to avoid the explicit instantiation in a library.
 	 *
-	 * @return map : a handle to the string id/topic database.
+	 * @return Topics : a handle to the topic id/topic database.
 	 */
-	static std::map< std::string, Topic<Data> >& topics() {
-		static std::map< std::string, Topic<Data> > topic_list;
+	static Topics& topics() {
+		static Topics topic_list;
 		return topic_list;
 	}
+	/**
+	 * @brief Serialises connecting and disconnecting (emits don't lock).
+	 *
+	 * @return Mutex : guards the topics and every sigslot's connections.
+	 */
+	static Mutex& mutex() {
+		static Mutex topics_mutex;
+		return topics_mutex;
+	}
+	/**
+	 * @brief Emits in flight for sigslots of this type.
+	 *
+	 * @return EmitEpoch : the grace period tracker.
+	 */
+	static sigslots::EmitEpoch& epoch() {
+		static sigslots::EmitEpoch emit_epoch;
+		return emit_epoch;
+	}
+	/**
+	 * @brief Snapshots and sigslots retired from inside emits, deleted by the next reclaim().
+	 *
+	 * @return Retired : the snapshots and sigslots waiting for a grace period.
+	 */
+	static Retired& deferred() {
+		static Retired deferred_snapshots;
+		return deferred_snapshots;
+	}
 
 	/**
 	 * @brief Provides a list of subscribers (listeners) associated with a topic.
@@ -159,14 +282,14 @@ private:
 	 * @param topic : the topic to check for.
 	 * @return Subscribers : a set of pointers to subscribers of a topic.
 	 */
-	static const Subscribers& subscribers(const std::string& topic) {
-		typename std::map< std::string, Topic<Data> >::const_iterator iter = topics().find(topic);
+	static const Subscribers& subscribers(const TopicHandle& topic) {
+		typename Topics::const_iterator iter = topics().find(topic.id());
 		/*
 		 * Note that this is called only by SigSlotsManager::connectSignal which
 		 * makes sure the topic name exists, so we don't need to do any error
 		 * handling here.
 		 */
-		// ecl_assert_throw( iter != topics().end(), StandardException(LOC,InvalidInputError,std::string("No sigslots topic with name:")+topic) );
+		// ecl_assert_throw( iter != topics().end(), StandardException(LOC,InvalidInputError,std::string("No sigslots topic with name:")+topic.name()) );
 		return *iter->second.subscribers();
 	}
 
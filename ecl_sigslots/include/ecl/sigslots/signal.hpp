@@ -58,7 +58,7 @@ public:
 	/**
 	 * @brief Creates a signal and connects.
 	 */
-	Signal(const std::string &topic) : sigslot(NULL) {
+	Signal(const TopicHandle &topic) : sigslot(NULL) {
 		sigslot = new SigSlot<Data>();
 		connect(topic);
 	}
@@ -89,7 +89,7 @@ public:
 	~Signal() {
 		sigslot->decrHandles();
 		if ( sigslot->handles() == 0 ) {
-			delete sigslot;
+			SigSlot<Data>::destroy(sigslot);
 		}
 	}
 
@@ -106,18 +106,24 @@ public:
 	 * This contacts the sigslots manager to connect the signal to the
 	 * specified topic - creating the topic if it is not yet existing.
 	 *
-	 * @param topic : the topic to connect to.
+	 * @param topic : the topic (name or handle) to connect to.
 	 */
-	void connect(const std::string& topic) { sigslot->connectSignal(topic); }
+	void connect(const TopicHandle& topic) { sigslot->connectSignal(topic); }
 	/**
 	 * @brief Connect as a slot, with the emit function loaded.
 	 *
 	 * This allows the signal to act as a relaying signal (effectively
 	 * a slot with the emit() function loaded.
 	 *
-	 * @param topic : the topic to connect to.
+	 * @param topic : the topic (name or handle) to connect to.
 	 */
-	void connectAsSlot(const std::string& topic) { sigslot->connectSlot(topic); }
+	void connectAsSlot(const TopicHandle& topic) { sigslot->connectSlot(topic); }
+	/**
+	 * @brief Disconnect the signal from the specified topic.
+	 *
+	 * @param topic : the topic to disconnect from.
+	 */
+	void disconnect(const TopicHandle& topic) { sigslot->disconnect(topic); }
 	/**
 	 * @brief Disconnect the signal from all topics.
 	 *
@@ -128,11 +134,16 @@ public:
 	/**
 	 * @brief The primary purpose of the signal, to emit!
 	 *
-	 * Emits a signal with the specified data.
+	 * Emits a signal with the specified data. The data is passed by
+	 * reference all the way through to the slots and is safe to emit
+	 * while other threads connect and disconnect. It is only copied for
+	 * slots whose functions take it by value - for large payloads, use
+	 * slots taking a const reference (or signal a shared pointer to
+	 * immutable data).
 	 *
 	 * @param data : the data to emit.
 	 */
-	void emit(Data data) { sigslot->emit(data); }
+	void emit(const Data& data) { sigslot->emit(data); }
 
 private:
 	SigSlot<Data>* sigslot;
@@ -167,7 +178,7 @@ public:
 	/**
 	 * @brief Creates a signal and connects.
 	 */
-	Signal(const std::string &topic) : sigslot(NULL) {
+	Signal(const TopicHandle &topic) : sigslot(NULL) {
 		sigslot = new SigSlot<Void>();
 		connect(topic);
 	}
@@ -204,7 +215,7 @@ public:
 	~Signal() {
 		sigslot->decrHandles();
 		if ( sigslot->handles() == 0 ) {
-			delete sigslot;
+			SigSlot<Void>::destroy(sigslot);
 		}
 	}
 	/**
@@ -213,18 +224,24 @@ public:
 	 * This contacts the sigslots manager to connect the signal to the
 	 * specified topic - creating the topic if it is not yet existing.
 	 *
-	 * @param topic : the topic to connect to.
+	 * @param topic : the topic (name or handle) to connect to.
 	 */
-	void connect(const std::string& topic) { sigslot->connectSignal(topic); }
+	void connect(const TopicHandle& topic) { sigslot->connectSignal(topic); }
 	/**
 	 * @brief Connect as a slot, with the emit function loaded.
 	 *
 	 * This allows the signal to act as a relaying signal (effectively
 	 * a slot with the emit() function loaded.
 	 *
-	 * @param topic : the topic to connect to.
+	 * @param topic : the topic (name or handle) to connect to.
+	 */
+	void connectAsSlot(const TopicHandle& topic) { sigslot->connectSlot(topic); }
+	/**
+	 * @brief Disconnect the signal from the specified topic.
+	 *
+	 * @param topic : the topic to disconnect from.
 	 */
-	void connectAsSlot(const std::string& topic) { sigslot->connectSlot(topic); }
+	void disconnect(const TopicHandle& topic) { sigslot->disconnect(topic); }
 	/**
 	 * @brief Disconnect the signal from all topics.
 	 *
@@ -18,20 +18,30 @@
 ** Includes
 *****************************************************************************/
 
+#include <atomic>
 #include <map>
 #include <set>
 #include <string>
+#include <vector>
+#include <ecl/config/ecl.hpp>
 #include <ecl/config/macros.hpp>
-#include <ecl/threads/mutex.hpp>
 #include <ecl/utilities/function_objects.hpp>
 #include <ecl/utilities/void.hpp>
+#include "callbacks.hpp"
 #include "manager.hpp"
+#include "slot_queue.hpp"
+#include "topic_handle.hpp"
 
 /*****************************************************************************
 ** Namespaces
 *****************************************************************************/
 
 namespace ecl {
+namespace sigslots {
+
+template <typename Data> class SlotQueue;
+
+} // namespace sigslots
 
 /*****************************************************************************
 ** Interface [General]
@@ -41,6 +51,16 @@ namespace ecl {
  *
  * This is the workhorse for both signals and slots, providing the implementation
  * for all the functions necessary by both types of frontends.
+ *
+ * Emitting walks a flat snapshot of every slot connected to the signal's
+ * topics. Connecting and disconnecting (which may happen on any thread)
+ * build a new snapshot and swap it in atomically, so emits never lock or
+ * allocate, and once a disconnect returns no emit will call the
+ * disconnected slot again. The data is passed along by const reference.
+ *
+ * Queued slots load a sigslots::SlotQueue as their function, so emitting
+ * to them is the same virtual call, it just copies the data into the queue
+ * instead of running the slot.
  */
 template <typename Data=Void>
 class SigSlot {
@@ -49,7 +69,8 @@ public:
 	** Typedefs
 	**********************/
 	typedef typename Topic<Data>::Subscribers Subscribers; /**< @brief A list of subscribers (slots) to a given topic. **/
-	typedef typename std::map<std::string, const Subscribers*> PublicationMap; /**< @brief Stores publishing topics and their followers. **/
+	typedef typename Topic<Data>::Snapshot Snapshot; /**< @brief All the slots this signal emits to. **/
+	typedef typename std::map<TopicHandle, const Subscribers*> PublicationMap; /**< @brief Stores publishing topics and their followers. **/
 
 	/*********************
 	** C&D
@@ -58,16 +79,16 @@ public:
 	 * Used only by signals where the function callback automatically
 	 * defaults to the emit() function.
 	 */
-	SigSlot() : processing_count(0), number_of_handles(1) {
-		function = new PartiallyBoundUnaryMemberFunction< SigSlot<Data> ,Data,void >( &SigSlot<Data>::emit, *this);
+	SigSlot() : number_of_handles(1), snapshot(new Snapshot()), released(false), queue(NULL) {
+		function = new sigslots::MemberCallback< SigSlot<Data>, Data, const Data& >( &SigSlot<Data>::emit, *this);
 	}
 	/**
 	 * Used by slots loading global or static functions.
 	 *
 	 * @param f : the global/static function.
 	 */
-	SigSlot(void (*f)(Data)) : processing_count(0), number_of_handles(1) {
-		function = new UnaryFreeFunction<Data>(f);
+	SigSlot(void (*f)(Data)) : number_of_handles(1), snapshot(new Snapshot()), released(false), queue(NULL) {
+		function = new sigslots::FreeCallback<Data>(f);
 	}
 	/**
 	 * Used by slots loading a member function.
@@ -77,41 +98,116 @@ public:
 	 * @tparam C : the member function's class type.
 	 */
 	template<typename C>
-	SigSlot(void (C::*f)(Data), C &c) : processing_count(0), number_of_handles(1) {
-		function = new PartiallyBoundUnaryMemberFunction<C,Data,void>(f,c);
+	SigSlot(void (C::*f)(Data), C &c) : number_of_handles(1), snapshot(new Snapshot()), released(false), queue(NULL) {
+		function = new sigslots::MemberCallback<C,Data>(f,c);
+	}
+#if defined(ECL_HAS_POSIX_THREADS)
+	/**
+	 * Used by queued slots loading global or static functions.
+	 *
+	 * @param f : the global/static function.
+	 * @param executor : the executor that runs the function.
+	 * @param queue_size : number of payloads that can be queued.
+	 * @param policy : what to do when the queue is full.
+	 */
+	SigSlot(void (*f)(Data), SlotExecutor &executor, const unsigned int &queue_size, const QueueOverflowPolicy &policy) :
+		number_of_handles(1), snapshot(new Snapshot()), released(false)
+	{
+		queue = new sigslots::SlotQueue<Data>(new sigslots::FreeCallback<Data>(f), executor, queue_size, policy);
+		function = queue;
+	}
+	/**
+	 * Used by queued slots loading a member function.
+	 *
+	 * @param f : the member function to load.
+	 * @param c : the instance for the member function's class.
+	 * @param executor : the executor that runs the function.
+	 * @param queue_size : number of payloads that can be queued.
+	 * @param policy : what to do when the queue is full.
+	 * @tparam C : the member function's class type.
+	 */
+	template<typename C>
+	SigSlot(void (C::*f)(Data), C &c, SlotExecutor &executor, const unsigned int &queue_size, const QueueOverflowPolicy &policy) :
+		number_of_handles(1), snapshot(new Snapshot()), released(false)
+	{
+		queue = new sigslots::SlotQueue<Data>(new sigslots::MemberCallback<C,Data>(f,c), executor, queue_size, policy);
+		function = queue;
 	}
+#endif
 
 	/**
-	 * @brief Disconnects the sigslot completely.
+	 * @brief Disconnect the sigslot completely and delete it once no emit can reach it.
+	 *
+	 * Used by the frontends in place of delete when their last handle goes.
+	 * Like disconnect(), this waits for emits still running with the old
+	 * connections, so nothing will call the sigslot once it returns.
 	 *
-	 * This is a rather elaborate process, it must first disconnect from any signals
-	 * to ensure no new callbacks are instantiated, then check to see that there
-	 * are no callbacks actually running, block if so, then finalise any deletions.
+	 * From inside an emit (e.g. a slot deleting another slot) that wait
+	 * isn't possible. Emits that still have the sigslot in a snapshot skip
+	 * it from then on (the one running on this thread included) and its
+	 * memory goes after the next grace period, but a run already under way
+	 * in another thread finishes after this returns. Don't destroy a sigslot
+	 * from inside one of its own callbacks either, unless it is queued.
+	 *
+	 * @param sigslot : the sigslot to destroy.
+	 */
+	static void destroy(SigSlot<Data> *sigslot) {
+		typename SigSlotsManager<Data>::Retired retired;
+		sigslot->released.store(true, std::memory_order_relaxed); // emits with an old snapshot shouldn't run it
+#if defined(ECL_HAS_POSIX_THREADS)
+		if ( sigslot->queue != NULL ) {
+			sigslot->queue->close(); // nor should its executor
+		}
+#endif
+		SigSlotsManager<Data>::mutex().lock();
+		sigslot->disconnect(retired);
+		SigSlotsManager<Data>::mutex().unlock();
+		retired.sigslots.push_back(sigslot);
+		SigSlotsManager<Data>::reclaim(retired);
+	}
+	/**
+	 * @brief Use destroy(), which disconnects first and deletes after a grace period.
 	 */
 	~SigSlot() {
-		disconnect(); // stop any new processing from connected signals
-		mutex.lock(); // acts like a barrier - holds up here if function still processing stuff.
+#if defined(ECL_HAS_POSIX_THREADS)
+		if ( queue != NULL ) {
+			queue->release(); // waits for its executor to let go
+		} else {
+			delete function;
+		}
+#else
 		delete function;
+#endif
+		delete snapshot.load();
 	}
 
 	const unsigned int& handles() const { return number_of_handles; } /**< @brief Number of copies of this object. **/
 	void incrHandles() { ++number_of_handles; } /**< @brief Increment the counter for the number of copies of this object. **/
 	void decrHandles() { --number_of_handles; } /**< @brief Decrement the counter for the number of copies of this object. **/
 
+#if defined(ECL_HAS_POSIX_THREADS)
+	bool isQueued() const { return queue != NULL; } /**< @brief Function is run on an executor. **/
+	/**
+	 * @brief Counters for a queued slot's queue.
+	 *
+	 * @return SlotQueueStatistics : the counters (all zero if not queued).
+	 */
+	SlotQueueStatistics queueStatistics() const {
+		return ( queue == NULL ) ? SlotQueueStatistics() : queue->statistics();
+	}
+#endif
+
 	/**
 	 * @brief Emit a signal along with the specified data.
 	 *
-	 * This is used by signals when emitting to slots.
+	 * This is used by signals when emitting to slots. It doesn't lock or
+	 * allocate, and doesn't copy the data.
 	 */
-	void emit(Data data) {
-		typename PublicationMap::const_iterator topic_iter;
-		typename Subscribers::const_iterator slots_iter;
-		for ( topic_iter = publications.begin(); topic_iter != publications.end(); ++topic_iter ) {
-			const Subscribers* subscribers = topic_iter->second;
-			for ( slots_iter = subscribers->begin(); slots_iter != subscribers->end(); ++slots_iter ) {
-				SigSlot<Data> *sigslot = *slots_iter;
-				sigslot->process(data);
-			}
+	void emit(const Data& data) {
+		sigslots::EmitGuard guard(SigSlotsManager<Data>::epoch());
+		const Snapshot &subscribers = *snapshot.load();
+		for ( unsigned int i = 0; i < subscribers.size(); ++i ) {
+			subscribers[i]->process(data);
 		}
 	}
 	/**
@@ -120,12 +216,9 @@ public:
 	 * This is used by slots with their loaded functions or relaying
 	 * signals with their emit() methods.
 	 */
-	void process(Data data) {
-		mutex.trylock(); // Only lock if its not already locked.
-		++processing_count;
-		(*function)(data);
-		if ( --processing_count == 0 ) {
-			mutex.unlock();
+	void process(const Data& data) {
+		if ( !released.load(std::memory_order_relaxed) ) { // destroyed after this emit took its snapshot
+			(*function)(data);
 		}
 	}
 	/**
@@ -135,7 +228,7 @@ public:
 	 * connected. If it does exist, it will connect with a set of
 	 * slots also currently linked to the topic.
 	 */
-	void connectSignal(const std::string& topic) {
+	void connectSignal(const TopicHandle& topic) {
 		// Logic:
 		//   - if already publishing to this topic
 		//     - don't do anything
@@ -144,7 +237,13 @@ public:
 		//       - Manager will automatically create a new topic
 		//     - Manager returns the subscribers handle
 		//     - Topic name and subscribers handle are stored locally here in publications
-		publications.insert( std::pair<std::string, const Subscribers*>(topic, SigSlotsManager<Data>::connectSignal(topic,this)) );
+		//     - Rebuild the snapshot of slots to emit to
+		typename SigSlotsManager<Data>::Retired retired;
+		SigSlotsManager<Data>::mutex().lock();
+		publications.insert( typename PublicationMap::value_type(topic, SigSlotsManager<Data>::connectSignal(topic,this)) );
+		retired.snapshots.push_back(refresh());
+		SigSlotsManager<Data>::mutex().unlock();
+		SigSlotsManager<Data>::reclaim(retired);
 	}
 	/**
 	 * @brief Connect a slot to the specified topic.
@@ -153,21 +252,30 @@ public:
 	 * connected. If it does exist, it will pass on its link
 	 * details to any signals also connected to the topic.
 	 */
-	void connectSlot(const std::string& topic) {
-		std::pair< std::set<std::string>::iterator,bool > ret;
-	//	std::cout << "Topic: " << topic << std::endl;
+	void connectSlot(const TopicHandle& topic) {
+		typename SigSlotsManager<Data>::Retired retired;
+		std::pair< std::set<TopicHandle>::iterator,bool > ret;
+		SigSlotsManager<Data>::mutex().lock();
 		ret = subscriptions.insert(topic); // Doesn't matter if it already exists.
 		if ( ret.second ) {
-			SigSlotsManager<Data>::connectSlot(topic,this);
+			SigSlotsManager<Data>::connectSlot(topic,this,retired);
 		} // else { already subscribed to this topic }
+		SigSlotsManager<Data>::mutex().unlock();
+		SigSlotsManager<Data>::reclaim(retired);
 	}
 	/**
 	 * @brief Disconnect the sigslot from the specified topic.
 	 */
-	void disconnect(const std::string &topic) {
-		// std::set<std::string>::const_iterator listen_iter = subscriptions.find(topic);
-		publications.erase(topic); // Doesn't matter if it finds it or not.
-		SigSlotsManager<Void>::disconnect(topic,this);
+	void disconnect(const TopicHandle &topic) {
+		typename SigSlotsManager<Data>::Retired retired;
+		SigSlotsManager<Data>::mutex().lock();
+		subscriptions.erase(topic); // Doesn't matter if it finds it or not.
+		if ( publications.erase(topic) != 0 ) {
+			retired.snapshots.push_back(refresh());
+		}
+		SigSlotsManager<Data>::disconnect(topic,this,retired);
+		SigSlotsManager<Data>::mutex().unlock();
+		SigSlotsManager<Data>::reclaim(retired);
 	}
 	/**
 	 * @brief Disconnect the sigslot from all topics.
@@ -175,28 +283,73 @@ public:
 	 * This completely disconnects the sigslot.
 	 */
 	void disconnect() {
-		std::set<std::string>::iterator iter;
+		typename SigSlotsManager<Data>::Retired retired;
+		SigSlotsManager<Data>::mutex().lock();
+		disconnect(retired);
+		SigSlotsManager<Data>::mutex().unlock();
+		SigSlotsManager<Data>::reclaim(retired);
+	}
+	/**
+	 * @brief Disconnect from all topics, leaving the reclaiming to the caller.
+	 *
+	 * Called with the manager's lock held.
+	 *
+	 * @param retired : collects the old snapshots.
+	 */
+	void disconnect(typename SigSlotsManager<Data>::Retired &retired) {
+		std::set<TopicHandle>::iterator iter;
 		for ( iter = subscriptions.begin(); iter != subscriptions.end(); ++iter ) {
-			SigSlotsManager<Data>::disconnect(*iter, this);
+			SigSlotsManager<Data>::disconnect(*iter, this, retired);
 		}
 		subscriptions.clear();
-		typename std::map<std::string,const Subscribers*>::iterator emit_iter;
+		typename PublicationMap::iterator emit_iter;
 		for ( emit_iter = publications.begin(); emit_iter != publications.end(); ++emit_iter ) {
-			SigSlotsManager<Data>::disconnect(emit_iter->first, this);
+			SigSlotsManager<Data>::disconnect(emit_iter->first, this, retired);
 		}
 		publications.clear();
+		retired.snapshots.push_back(refresh());
+	}
+	/**
+	 * @brief Swap in a new snapshot of the slots connected to this signal's topics.
+	 *
+	 * Called with the manager's lock held whenever the connections change.
+	 *
+	 * @return const Snapshot* : the old snapshot, to be reclaimed by the caller.
+	 */
+	const Snapshot* refresh() {
+		Snapshot *replacement = new Snapshot();
+		typename PublicationMap::const_iterator topic_iter;
+		for ( topic_iter = publications.begin(); topic_iter != publications.end(); ++topic_iter ) {
+			replacement->insert(replacement->end(), topic_iter->second->begin(), topic_iter->second->end());
+		}
+		return snapshot.exchange(replacement);
 	}
 
-	const std::set<std::string>& subscribedTopics() { return subscriptions; }
+	/**
+	 * @brief Names of the topics this sigslot is listening to.
+	 *
+	 * @return set<string> : the topic names.
+	 */
+	std::set<std::string> subscribedTopics() {
+		std::set<std::string> names;
+		SigSlotsManager<Data>::mutex().lock();
+		std::set<TopicHandle>::const_iterator iter;
+		for ( iter = subscriptions.begin(); iter != subscriptions.end(); ++iter ) {
+			names.insert(iter->name());
+		}
+		SigSlotsManager<Data>::mutex().unlock();
+		return names;
+	}
 
 private:
-	Mutex mutex;
-	unsigned int processing_count; // number of running process()'
 	unsigned int number_of_handles; // number of handles to this sigslot (allows copying)
-	std::set<std::string> subscriptions; // topics this sigslot is listening to
+	std::set<TopicHandle> subscriptions; // topics this sigslot is listening to
 	PublicationMap publications; // topics this sigslot is posting to, as well as the subscribers on the other end
+	std::atomic<const Snapshot*> snapshot; // flattened publications, what emit() walks
+	std::atomic<bool> released; // destroyed, emits with an old snapshot skip it
 
-	UnaryFunction<Data,void> *function;
+	sigslots::Callback<Data> *function;
+	sigslots::SlotQueue<Data> *queue; // function, if it is queued
 };
 
 /*****************************************************************************
@@ -215,13 +368,14 @@ class SigSlot<Void> {
 public:
 	// typedef std::set<SigSlot<Void>*> Subscribers
 	typedef Topic<Void>::Subscribers Subscribers; /**< @brief A list of subscribers (slots) to a given topic. **/
-	typedef std::map<std::string, const Subscribers*> PublicationMap; /**< @brief Stores publishing topics and their followers. **/
+	typedef Topic<Void>::Snapshot Snapshot; /**< @brief All the slots this signal emits to. **/
+	typedef std::map<TopicHandle, const Subscribers*> PublicationMap; /**< @brief Stores publishing topics and their followers. **/
 
 	/**
 	 * Used only by signals where the function callback automatically
 	 * defaults to the emit() function.
 	 */
-	SigSlot() : processing_count(0), number_of_handles(1) {
+	SigSlot() : number_of_handles(1), snapshot(new Snapshot()), released(false) {
 		function = new BoundNullaryMemberFunction<SigSlot,void>(&SigSlot::emit,*this);
 	}
 	/**
@@ -229,7 +383,7 @@ public:
 	 *
 	 * @param f : the global/static function.
 	 */
-	SigSlot(VoidFunction f) : processing_count(0), number_of_handles(1) {
+	SigSlot(VoidFunction f) : number_of_handles(1), snapshot(new Snapshot()), released(false) {
 		function = new NullaryFreeFunction<void>(f);
 	}
 	/**
@@ -240,21 +394,41 @@ public:
 	 * @tparam C : the member function's class type.
 	 */
 	template<typename C>
-	SigSlot(void (C::*f)(void), C &c) : processing_count(0), number_of_handles(1) {
+	SigSlot(void (C::*f)(void), C &c) : number_of_handles(1), snapshot(new Snapshot()), released(false) {
 		function = new BoundNullaryMemberFunction<C,void>(f,c);
 	}
 
 	/**
-	 * @brief Disconnects the sigslot completely.
+	 * @brief Disconnect the sigslot completely and delete it once no emit can reach it.
+	 *
+	 * Used by the frontends in place of delete when their last handle goes.
+	 * Like disconnect(), this waits for emits still running with the old
+	 * connections, so nothing will call the sigslot once it returns.
 	 *
-	 * This is a rather elaborate process, it must first disconnect from any signals
-	 * to ensure no new callbacks are instantiated, then check to see that there
-	 * are no callbacks actually running, block if so, then finalise any deletions.
+	 * From inside an emit (e.g. a slot deleting another slot) that wait
+	 * isn't possible. Emits that still have the sigslot in a snapshot skip
+	 * it from then on (the one running on this thread included) and its
+	 * memory goes after the next grace period, but a run already under way
+	 * in another thread finishes after this returns. Don't destroy a sigslot
+	 * from inside one of its own callbacks either.
+	 *
+	 * @param sigslot : the sigslot to destroy.
+	 */
+	static void destroy(SigSlot<Void> *sigslot) {
+		SigSlotsManager<Void>::Retired retired;
+		sigslot->released.store(true, std::memory_order_relaxed); // emits with an old snapshot shouldn't run it
+		SigSlotsManager<Void>::mutex().lock();
+		sigslot->disconnect(retired);
+		SigSlotsManager<Void>::mutex().unlock();
+		retired.sigslots.push_back(sigslot);
+		SigSlotsManager<Void>::reclaim(retired);
+	}
+	/**
+	 * @brief Use destroy(), which disconnects first and deletes after a grace period.
 	 */
 	~SigSlot() {
-		disconnect(); // stop any new processing from connected signals
-		mutex.lock(); // acts like a barrier - holds up here if function still processing stuff.
 		delete function;
+		delete snapshot.load();
 	}
 
 	const unsigned int& handles() const { return number_of_handles; } /**< @brief Number of copies of this object. **/
@@ -264,17 +438,14 @@ public:
 	/**
 	 * @brief Emit a signal.
 	 *
-	 * This is used by signals when emitting to slots.
+	 * This is used by signals when emitting to slots. It doesn't lock or
+	 * allocate.
 	 */
 	void emit() {
-		PublicationMap::const_iterator topic_iter;
-		Subscribers::const_iterator slots_iter;
-		for ( topic_iter = publications.begin(); topic_iter != publications.end(); ++topic_iter ) {
-			const Subscribers* subscribers = topic_iter->second;
-			for ( slots_iter = subscribers->begin(); slots_iter != subscribers->end(); ++slots_iter ) {
-				SigSlot *sigslot = *slots_iter;
-				sigslot->process();
-			}
+		sigslots::EmitGuard guard(SigSlotsManager<Void>::epoch());
+		const Snapshot &subscribers = *snapshot.load();
+		for ( unsigned int i = 0; i < subscribers.size(); ++i ) {
+			subscribers[i]->process();
 		}
 	}
 	/**
@@ -285,11 +456,8 @@ public:
 	 */
 	void process(Void void_arg = Void()) {
 		(void)void_arg;
-		mutex.trylock(); // Only lock if its not already locked.
-		++processing_count;
-		(*function)();
-		if ( --processing_count == 0 ) {
-			mutex.unlock();
+		if ( !released.load(std::memory_order_relaxed) ) { // destroyed after this emit took its snapshot
+			(*function)();
 		}
 	}
 	/**
@@ -299,7 +467,7 @@ public:
 	 * connected. If it does exist, it will connect with a set of
 	 * slots also currently linked to the topic.
 	 */
-	void connectSignal(const std::string& topic) {
+	void connectSignal(const TopicHandle& topic) {
 		// Logic:
 		//   - if already publishing to this topic
 		//     - don't do anything
@@ -308,17 +476,27 @@ public:
 		//       - Manager will automatically create a new topic
 		//     - Manager returns the subscribers handle
 		//     - Topic name and subscribers handle are stored locally here in publications
-		publications.insert( std::pair<std::string, const Subscribers*>(topic, SigSlotsManager<Void>::connectSignal(topic,this)) );
+		//     - Rebuild the snapshot of slots to emit to
+		SigSlotsManager<Void>::Retired retired;
+		SigSlotsManager<Void>::mutex().lock();
+		publications.insert( PublicationMap::value_type(topic, SigSlotsManager<Void>::connectSignal(topic,this)) );
+		retired.snapshots.push_back(refresh());
+		SigSlotsManager<Void>::mutex().unlock();
+		SigSlotsManager<Void>::reclaim(retired);
 	}
 	/**
 	 * @brief Connect a slot to the specified topic.
 	 */
-	void connectSlot(const std::string& topic){
-		std::pair< std::set<std::string>::iterator,bool > ret;
+	void connectSlot(const TopicHandle& topic) {
+		SigSlotsManager<Void>::Retired retired;
+		std::pair< std::set<TopicHandle>::iterator,bool > ret;
+		SigSlotsManager<Void>::mutex().lock();
 		ret = subscriptions.insert(topic); // Doesn't matter if it already exists.
 		if ( ret.second ) {
-			SigSlotsManager<Void>::connectSlot(topic,this);
+			SigSlotsManager<Void>::connectSlot(topic,this,retired);
 		} // else { already subscribed to this topic }
+		SigSlotsManager<Void>::mutex().unlock();
+		SigSlotsManager<Void>::reclaim(retired);
 	}
 	/**
 	 * @brief Disconnect the sigslot from the specified topic.
@@ -327,9 +505,16 @@ public:
 	 * connected. If it does exist, it will pass on its link
 	 * details to any signals also connected to the topic.
 	 */
-	void disconnect(const std::string &topic) {
-		publications.erase(topic); // Doesn't matter if it finds it or not.
-		SigSlotsManager<Void>::disconnect(topic,this);
+	void disconnect(const TopicHandle &topic) {
+		SigSlotsManager<Void>::Retired retired;
+		SigSlotsManager<Void>::mutex().lock();
+		subscriptions.erase(topic); // Doesn't matter if it finds it or not.
+		if ( publications.erase(topic) != 0 ) {
+			retired.snapshots.push_back(refresh());
+		}
+		SigSlotsManager<Void>::disconnect(topic,this,retired);
+		SigSlotsManager<Void>::mutex().unlock();
+		SigSlotsManager<Void>::reclaim(retired);
 	}
 	/**
 	 * @brief Disconnect the sigslot from all topics.
@@ -337,24 +522,54 @@ public:
 	 * This completely disconnects the sigslot.
 	 */
 	void disconnect() {
-		std::set<std::string>::iterator iter;
+		SigSlotsManager<Void>::Retired retired;
+		SigSlotsManager<Void>::mutex().lock();
+		disconnect(retired);
+		SigSlotsManager<Void>::mutex().unlock();
+		SigSlotsManager<Void>::reclaim(retired);
+	}
+	/**
+	 * @brief Disconnect from all topics, leaving the reclaiming to the caller.
+	 *
+	 * Called with the manager's lock held.
+	 *
+	 * @param retired : collects the old snapshots.
+	 */
+	void disconnect(SigSlotsManager<Void>::Retired &retired) {
+		std::set<TopicHandle>::iterator iter;
 		for ( iter = subscriptions.begin(); iter != subscriptions.end(); ++iter ) {
-			SigSlotsManager<Void>::disconnect(*iter, this);
+			SigSlotsManager<Void>::disconnect(*iter, this, retired);
 		}
 		subscriptions.clear();
-		std::map<std::string,const Subscribers*>::iterator emit_iter;
+		PublicationMap::iterator emit_iter;
 		for ( emit_iter = publications.begin(); emit_iter != publications.end(); ++emit_iter ) {
-			SigSlotsManager<Void>::disconnect(emit_iter->first, this);
+			SigSlotsManager<Void>::disconnect(emit_iter->first, this, retired);
 		}
 		publications.clear();
+		retired.snapshots.push_back(refresh());
+	}
+	/**
+	 * @brief Swap in a new snapshot of the slots connected to this signal's topics.
+	 *
+	 * Called with the manager's lock held whenever the connections change.
+	 *
+	 * @return const Snapshot* : the old snapshot, to be reclaimed by the caller.
+	 */
+	const Snapshot* refresh() {
+		Snapshot *replacement = new Snapshot();
+		PublicationMap::const_iterator topic_iter;
+		for ( topic_iter = publications.begin(); topic_iter != publications.end(); ++topic_iter ) {
+			replacement->insert(replacement->end(), topic_iter->second->begin(), topic_iter->second->end());
+		}
+		return snapshot.exchange(replacement);
 	}
 
 private:
-	Mutex mutex;
-	unsigned int processing_count; // number of running process()'
 	unsigned int number_of_handles; // number of handles to this sigslot (allows copying)
-	std::set<std::string> subscriptions; // topics this sigslot is listening to
+	std::set<TopicHandle> subscriptions; // topics this sigslot is listening to
 	PublicationMap publications; // topics this sigslot is posting to, as well as the subscribers on the other end
+	std::atomic<const Snapshot*> snapshot; // flattened publications, what emit() walks
+	std::atomic<bool> released; // destroyed, emits with an old snapshot skip it
 
 	NullaryFunction<void> *function;
 };
@@ -19,6 +19,7 @@
 *****************************************************************************/
 
 #include "sigslot.hpp"
+#include <ecl/config/ecl.hpp>
 #include <ecl/config/macros.hpp>
 #include <ecl/utilities/void.hpp>
 
@@ -40,9 +41,14 @@ namespace ecl {
  * (static or global) function, or a member function. Once initialised, they can
  * be hooked up to a signal.
  *
+ * Slots normally run in the thread that emits. Constructed with a
+ * SlotExecutor, they instead queue the data and have one of the
+ * executor's threads run the function, so a slow slot doesn't hold up the
+ * signal.
+ *
  * Usage examples are provided in the main page's documentation for this package.
  *
- * @sa Signal<Void>, Slot.
+ * @sa Signal<Void>, Slot, SlotExecutor.
  **/
 template <typename Data=Void>
 class ECL_PUBLIC Slot {
@@ -69,7 +75,7 @@ public:
 	 * @param f : the global/static function.
 	 * @param topic : the slot topic name to connect to.
 	 */
-	Slot(void (*f)(Data), const std::string &topic) : sigslot(NULL) {
+	Slot(void (*f)(Data), const TopicHandle &topic) : sigslot(NULL) {
 		sigslot = new SigSlot<Data>(f);
 		connect(topic);
 	}
@@ -100,10 +106,46 @@ public:
 	 * @param topic : the slot topic name to connect to.
 	 */
 	template <typename C>
-	Slot(void (C::*f)(Data), C &c, const std::string& topic) : sigslot(NULL) {
+	Slot(void (C::*f)(Data), C &c, const TopicHandle& topic) : sigslot(NULL) {
 		sigslot = new SigSlot<Data>(f,c);
 		connect(topic);
 	}
+#if defined(ECL_HAS_POSIX_THREADS)
+	/**
+	 * @brief Load with a global/static function, run on an executor.
+	 *
+	 * Emits copy the data into a queue of the specified size and return
+	 * immediately (unless the queue is full and the policy is to block).
+	 *
+	 * @param f : the global/static function.
+	 * @param executor : the executor that runs the function (must outlive the slot).
+	 * @param queue_size : number of payloads that can be queued.
+	 * @param policy : what to do when the queue is full.
+	 *
+	 * @exception StandardException : throws if the queue size is zero or the executor has too many slots [debug mode only].
+	 */
+	Slot(void (*f)(Data), SlotExecutor &executor, const unsigned int &queue_size = 16, const QueueOverflowPolicy &policy = DropOldest) : sigslot(NULL) {
+		sigslot = new SigSlot<Data>(f, executor, queue_size, policy);
+	}
+	/**
+	 * @brief Load with a member function, run on an executor.
+	 *
+	 * Emits copy the data into a queue of the specified size and return
+	 * immediately (unless the queue is full and the policy is to block).
+	 *
+	 * @param f : the member function.
+	 * @param c : the class instance.
+	 * @param executor : the executor that runs the function (must outlive the slot).
+	 * @param queue_size : number of payloads that can be queued.
+	 * @param policy : what to do when the queue is full.
+	 *
+	 * @exception StandardException : throws if the queue size is zero or the executor has too many slots [debug mode only].
+	 */
+	template <typename C>
+	Slot(void (C::*f)(Data), C &c, SlotExecutor &executor, const unsigned int &queue_size = 16, const QueueOverflowPolicy &policy = DropOldest) : sigslot(NULL) {
+		sigslot = new SigSlot<Data>(f, c, executor, queue_size, policy);
+	}
+#endif
 
 	/**
 	 * @brief Copy constructor.
@@ -131,7 +173,7 @@ public:
 	~Slot() {
 		sigslot->decrHandles();
 		if ( sigslot->handles() == 0 ) {
-			delete sigslot;
+			SigSlot<Data>::destroy(sigslot);
 		}
 	}
 	/**
@@ -146,16 +188,36 @@ public:
 	 * Useful for debugging.
 	 * @return set<string> : a set of topic names this slot is listening to.
 	 */
-	const std::set<std::string>& connections() { return sigslot->subscribedTopics(); }
+	std::set<std::string> connections() { return sigslot->subscribedTopics(); }
+#if defined(ECL_HAS_POSIX_THREADS)
+	/**
+	 * @brief Is this slot run on an executor?
+	 *
+	 * @return bool : true if queued, false if run by the emitting thread.
+	 */
+	bool isQueued() const { return sigslot->isQueued(); }
+	/**
+	 * @brief Queue depth, drop and latency counters of a queued slot.
+	 *
+	 * @return SlotQueueStatistics : the counters (all zero for slots that aren't queued).
+	 */
+	SlotQueueStatistics queueStatistics() const { return sigslot->queueStatistics(); }
+#endif
 	/**
 	 * @brief Make a connection to the specified topic.
 	 *
 	 * This contacts the sigslots manager to connect the signal to the
 	 * specified topic - creating the topic if it is not yet existing.
 	 *
-	 * @param topic : the topic to connect to.
+	 * @param topic : the topic (name or handle) to connect to.
+	 */
+	void connect(const TopicHandle& topic) {	sigslot->connectSlot(topic); }
+	/**
+	 * @brief Disconnect the slot from the specified topic.
+	 *
+	 * @param topic : the topic to disconnect from.
 	 */
-	void connect(const std::string& topic) {	sigslot->connectSlot(topic); }
+	void disconnect(const TopicHandle& topic) { sigslot->disconnect(topic); }
 	/**
 	 * @brief Disconnect the slot from all topics.
 	 *
@@ -202,7 +264,7 @@ public:
 	 * @param f : the global/static function.
 	 * @param topic : the slot topic name to connect to.
 	 */
-	Slot(VoidFunction f, const std::string &topic) : sigslot(NULL) {
+	Slot(VoidFunction f, const TopicHandle &topic) : sigslot(NULL) {
 		sigslot = new SigSlot<Void>(f);
 		connect(topic);
 	}
@@ -230,7 +292,7 @@ public:
 	 * @param topic : the slot topic name to connect to.
 	 */
 	template <typename C>
-	Slot(void (C::*f)(void), C &c, const std::string &topic) : sigslot(NULL) {
+	Slot(void (C::*f)(void), C &c, const TopicHandle &topic) : sigslot(NULL) {
 		sigslot = new SigSlot<Void>(f,c);
 		connect(topic);
 	}
@@ -259,7 +321,7 @@ public:
 	~Slot() {
 		sigslot->decrHandles();
 		if ( sigslot->handles() == 0 ) {
-			delete sigslot;
+			SigSlot<Void>::destroy(sigslot);
 		}
 	}
 	/**
@@ -274,9 +336,15 @@ public:
 	 * This contacts the sigslots manager to connect the signal to the
 	 * specified topic - creating the topic if it is not yet existing.
 	 *
-	 * @param topic : the topic to connect to.
+	 * @param topic : the topic (name or handle) to connect to.
+	 */
+	void connect(const TopicHandle& topic) {	sigslot->connectSlot(topic); }
+	/**
+	 * @brief Disconnect the slot from the specified topic.
+	 *
+	 * @param topic : the topic to disconnect from.
 	 */
-	void connect(const std::string& topic) {	sigslot->connectSlot(topic); }
+	void disconnect(const TopicHandle& topic) { sigslot->disconnect(topic); }
 	/**
 	 * @brief Disconnect the slot from all topics.
 	 *
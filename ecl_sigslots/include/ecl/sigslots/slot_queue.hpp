@@ -0,0 +1,415 @@
+/**
+ * @file /ecl_sigslots/include/ecl/sigslots/slot_queue.hpp
+ *
+ * @brief Payload queues for slots run on an executor.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_SIGSLOTS_SLOT_QUEUE_HPP_
+#define ECL_SIGSLOTS_SLOT_QUEUE_HPP_
+
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#include <ecl/config/ecl.hpp>
+#if defined(ECL_HAS_POSIX_THREADS)
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <ecl/config/macros.hpp>
+#include <ecl/exceptions/macros.hpp>
+#include <ecl/exceptions/standard_exception.hpp>
+#include <ecl/threads/condition_variable.hpp>
+#include <ecl/threads/mutex.hpp>
+#include "callbacks.hpp"
+#include "executor.hpp"
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Enums
+*****************************************************************************/
+/**
+ * @brief What an emit does when a queued slot's queue is full.
+ */
+enum QueueOverflowPolicy {
+	DropOldest,  /**< @brief Discard the oldest queued payload to make room. **/
+	DropNewest,  /**< @brief Discard the payload being emitted. **/
+	BlockEmitter /**< @brief Wait for the executor to make room. Nothing is lost, but the slot's function mustn't connect or disconnect sigslots of its type. **/
+};
+
+/*****************************************************************************
+** Interface [SlotQueueStatistics]
+*****************************************************************************/
+/**
+ * @brief Counters for a queued slot, latencies are in nanoseconds.
+ *
+ * Latency is measured from the emit to the executor starting on the
+ * payload. The counters are read one at a time while the slot keeps
+ * running, so they needn't agree with each other exactly.
+ */
+struct SlotQueueStatistics {
+	SlotQueueStatistics() :
+		capacity(0), depth(0), max_depth(0),
+		enqueued(0), processed(0), dropped(0),
+		last_latency(0), max_latency(0), mean_latency(0)
+	{}
+	unsigned int capacity;   /**< @brief Payloads the queue can hold. **/
+	unsigned int depth;      /**< @brief Payloads currently queued. **/
+	unsigned int max_depth;  /**< @brief Most payloads ever queued at once. **/
+	unsigned long enqueued;  /**< @brief Payloads queued by emits. **/
+	unsigned long processed; /**< @brief Payloads the slot's function has been run with. **/
+	unsigned long dropped;   /**< @brief Payloads discarded because the queue was full. **/
+	long last_latency;       /**< @brief Latency of the most recently processed payload. **/
+	long max_latency;        /**< @brief Worst latency so far. **/
+	long mean_latency;       /**< @brief Average latency over all processed payloads. **/
+};
+
+namespace sigslots {
+
+/*****************************************************************************
+** Interface [SlotQueue]
+*****************************************************************************/
+/**
+ * @brief Not for direct use, the function loaded into a queued slot.
+ *
+ * Processing a queued slot copies the payload into a bounded ring and
+ * schedules the slot on its executor, which later runs the slot's real
+ * function. The ring is lock-free (D. Vyukov's bounded mpmc design, as
+ * in MpmcQueue, but sized at run time) since any number of signals may be
+ * emitting to the slot, and DropOldest has the emitters pop as well.
+ *
+ * Scheduling hinges on a count of pending payloads. Emits increment it
+ * after queueing and whichever emit takes it from zero schedules the
+ * slot. The executor decrements it once per payload it takes care of and
+ * stops on reaching zero. Payloads discarded by DropOldest are still
+ * counted (as well as separately, as discarded), the executor just takes
+ * one of those instead of popping. Finding nothing to pop with nothing
+ * discarded means another emit has claimed a cell but not yet filled it,
+ * so the executor waits for it. So the slot is scheduled at most once at a
+ * time, and the final decrement is the executor's last touch, which is
+ * what the destructor waits for.
+ *
+ * The payload type (Data stripped of references and const) must be default
+ * constructible and copy assignable.
+ */
+template <typename Data>
+class ECL_LOCAL SlotQueue : public Callback<Data>, public QueuedWork {
+public:
+	typedef typename std::remove_cv<typename std::remove_reference<Data>::type>::type Payload; /**< @brief What is queued. **/
+
+	/**
+	 * @brief Wrap the slot's function.
+	 *
+	 * @param f : the slot's function (takes ownership).
+	 * @param executor : the executor to run it on.
+	 * @param capacity : number of payloads that can be queued.
+	 * @param policy : what to do when the queue is full.
+	 *
+	 * @exception StandardException : throws if the capacity is zero [debug mode only].
+	 */
+	SlotQueue(Callback<Data> *f, SlotExecutor &executor, const unsigned int &capacity, const QueueOverflowPolicy &policy) :
+		function(f),
+		slot_executor(executor),
+		overflow_policy(policy),
+		cells(capacity),
+		enqueue_position(0),
+		dequeue_position(0),
+		pending(0),
+		discarded(0),
+		closing(false),
+		waiters(0),
+		number_enqueued(0),
+		number_processed(0),
+		number_dropped(0),
+		max_depth(0),
+		last_latency(0),
+		max_latency(0),
+		total_latency(0)
+	{
+		ecl_assert_throw( capacity > 0, StandardException(LOC, InvalidInputError, "A queued slot needs room for at least one payload."));
+		for ( std::size_t i = 0; i < cells.size(); ++i ) {
+			cells[i].sequence.store(i, std::memory_order_relaxed);
+		}
+		slot_executor.attach();
+	}
+	/**
+	 * @brief Discard anything still queued and wait for the executor to let go.
+	 *
+	 * Only called once the sigslot is disconnected, so nothing is being
+	 * queued anymore.
+	 */
+	~SlotQueue() {
+		closing.store(true);
+		while ( pending.load() != 0 ) {
+			std::this_thread::yield();
+		}
+		slot_executor.detach();
+		delete function;
+	}
+
+	/**
+	 * @brief Delete the queue once the executor has let go of it.
+	 *
+	 * The destructor waits for the executor, which it can't do from inside
+	 * the slot's own function (a slot destroying itself). There the delete
+	 * is left to drain(), once it has finished with the queue.
+	 */
+	void release() {
+		if ( draining() == this ) {
+			close();
+			draining() = NULL;
+		} else {
+			delete this;
+		}
+	}
+
+	/**
+	 * @brief Stop running the slot's function, anything still queued is discarded.
+	 *
+	 * For slots destroyed from inside an emit, which can't wait for the
+	 * executor. A run already under way still finishes.
+	 */
+	void close() { closing.store(true); }
+
+	/**
+	 * @brief Queue the payload (this is what emits call).
+	 */
+	void operator()(const Data& data) {
+		const long stamp = now();
+		if ( !enqueue(data, stamp) ) {
+			switch ( overflow_policy ) {
+				case ( DropNewest ) : {
+					number_dropped.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+				case ( DropOldest ) : {
+					while ( !enqueue(data, stamp) ) {
+						if ( dequeue(NULL, NULL) ) {
+							discarded.fetch_add(1);
+							number_dropped.fetch_add(1, std::memory_order_relaxed);
+						}
+					}
+					break;
+				}
+				default : { // BlockEmitter
+					block(data, stamp);
+					break;
+				}
+			}
+		}
+		number_enqueued.fetch_add(1, std::memory_order_relaxed);
+		const unsigned int depth = size();
+		unsigned int deepest = max_depth.load(std::memory_order_relaxed);
+		while ( ( depth > deepest ) && !max_depth.compare_exchange_weak(deepest, depth, std::memory_order_relaxed) ) {}
+		if ( pending.fetch_add(1) == 0 ) {
+			slot_executor.schedule(this);
+		}
+	}
+
+	/**
+	 * @brief Run the slot's function on the queued payloads (this is what the executor calls).
+	 */
+	void drain() {
+		Payload payload;
+		long stamp = 0;
+		draining() = this;
+		do {
+			if ( take(&payload, &stamp) ) {
+				if ( overflow_policy == BlockEmitter ) {
+					wake();
+				}
+				if ( !closing.load(std::memory_order_relaxed) ) {
+					const long latency = now() - stamp;
+					last_latency.store(latency, std::memory_order_relaxed);
+					total_latency.fetch_add(latency, std::memory_order_relaxed);
+					long worst = max_latency.load(std::memory_order_relaxed);
+					while ( ( latency > worst ) && !max_latency.compare_exchange_weak(worst, latency, std::memory_order_relaxed) ) {}
+					(*function)(payload);
+					number_processed.fetch_add(1, std::memory_order_relaxed);
+				}
+			} // else one dropped by an emit after it was counted
+		} while ( pending.fetch_sub(1) != 1 );
+		if ( draining() == NULL ) {
+			delete this; // released by the slot's function
+		}
+		draining() = NULL;
+	}
+
+	/**
+	 * @brief Current values of the counters.
+	 *
+	 * @return SlotQueueStatistics : the counters.
+	 */
+	SlotQueueStatistics statistics() const {
+		SlotQueueStatistics stats;
+		stats.capacity = cells.size();
+		stats.depth = size();
+		stats.max_depth = max_depth.load(std::memory_order_relaxed);
+		stats.enqueued = number_enqueued.load(std::memory_order_relaxed);
+		stats.processed = number_processed.load(std::memory_order_relaxed);
+		stats.dropped = number_dropped.load(std::memory_order_relaxed);
+		stats.last_latency = last_latency.load(std::memory_order_relaxed);
+		stats.max_latency = max_latency.load(std::memory_order_relaxed);
+		stats.mean_latency = ( stats.processed == 0 ) ? 0 : total_latency.load(std::memory_order_relaxed)/static_cast<long>(stats.processed);
+		return stats;
+	}
+
+private:
+	struct Cell {
+		std::atomic<std::size_t> sequence;
+		Payload data;
+		long stamp;
+	};
+
+	/**
+	 * The queue the calling thread is draining, if any. Cleared by
+	 * release() to hand the delete over to drain().
+	 */
+	static SlotQueue*& draining() {
+		static thread_local SlotQueue *queue = NULL;
+		return queue;
+	}
+
+	static long now() {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	unsigned int size() const {
+		const std::size_t tail = dequeue_position.load(std::memory_order_acquire);
+		const std::size_t head = enqueue_position.load(std::memory_order_acquire);
+		return ( head > tail ) ? static_cast<unsigned int>(head - tail) : 0;
+	}
+
+	bool enqueue(const Data &data, const long &stamp) {
+		std::size_t position = enqueue_position.load(std::memory_order_relaxed);
+		Cell *cell;
+		for (;;) {
+			cell = &cells[position % cells.size()];
+			const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+			const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+			if ( difference == 0 ) {
+				if ( enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) ) {
+					break;
+				}
+			} else if ( difference < 0 ) {
+				return false; // full
+			} else {
+				position = enqueue_position.load(std::memory_order_relaxed);
+			}
+		}
+		cell->data = data;
+		cell->stamp = stamp;
+		cell->sequence.store(position + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * Pops into payload/stamp, or just discards if they are null.
+	 */
+	bool dequeue(Payload *payload, long *stamp) {
+		std::size_t position = dequeue_position.load(std::memory_order_relaxed);
+		Cell *cell;
+		for (;;) {
+			cell = &cells[position % cells.size()];
+			const std::size_t sequence = cell->sequence.load(std::memory_order_acquire);
+			const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+			if ( difference == 0 ) {
+				if ( dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) ) {
+					break;
+				}
+			} else if ( difference < 0 ) {
+				return false; // empty
+			} else {
+				position = dequeue_position.load(std::memory_order_relaxed);
+			}
+		}
+		if ( payload != NULL ) {
+			*payload = cell->data;
+			*stamp = cell->stamp;
+		}
+		cell->sequence.store(position + cells.size(), std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * Takes care of one pending payload, either popping it (true) or one
+	 * of those discarded by DropOldest emits (false). Waits out emits that
+	 * have claimed a cell but not filled it yet.
+	 */
+	bool take(Payload *payload, long *stamp) {
+		for (;;) {
+			if ( dequeue(payload, stamp) ) {
+				return true;
+			}
+			unsigned long count = discarded.load();
+			while ( count > 0 ) {
+				if ( discarded.compare_exchange_weak(count, count - 1) ) {
+					return false;
+				}
+			}
+			std::this_thread::yield();
+		}
+	}
+
+	/**
+	 * Waits for room, pairs with wake() as in MpmcQueue.
+	 */
+	void block(const Data &data, const long &stamp) {
+		mutex.lock();
+		waiters.fetch_add(1);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		while ( !enqueue(data, stamp) ) {
+			room.wait(mutex);
+		}
+		waiters.fetch_sub(1);
+		mutex.unlock();
+	}
+	void wake() {
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if ( waiters.load(std::memory_order_relaxed) > 0 ) {
+			mutex.lock();
+			room.notify_all();
+			mutex.unlock();
+		}
+	}
+
+	Callback<Data> *function;
+	SlotExecutor &slot_executor;
+	const QueueOverflowPolicy overflow_policy;
+	std::vector<Cell> cells;
+	std::atomic<std::size_t> enqueue_position;
+	std::atomic<std::size_t> dequeue_position;
+	std::atomic<unsigned long> pending; // payloads the executor has yet to take care of
+	std::atomic<unsigned long> discarded; // pending, but popped by DropOldest emits
+	std::atomic<bool> closing;
+	std::atomic<unsigned int> waiters;
+	Mutex mutex;
+	ConditionVariable room;
+	std::atomic<unsigned long> number_enqueued, number_processed, number_dropped;
+	std::atomic<unsigned int> max_depth;
+	std::atomic<long> last_latency, max_latency, total_latency;
+};
+
+} // namespace sigslots
+} // namespace ecl
+
+#endif /* ECL_HAS_POSIX_THREADS */
+#endif /* ECL_SIGSLOTS_SLOT_QUEUE_HPP_ */
@@ -18,6 +18,7 @@
 
 #include <string>
 #include <set>
+#include <vector>
 #include <ecl/config/macros.hpp>
 
 /*****************************************************************************
@@ -48,6 +49,7 @@ public:
 	** Typedefs
 	**********************/
 	typedef std::set<SigSlot<Data>*> Subscribers;  /**< @brief A list of subscribers (slots) to a given topic. **/
+	typedef std::vector<SigSlot<Data>*> Snapshot;  /**< @brief Flattened, immutable list of everything a signal emits to. **/
 
 	/**
 	 * @brief Uniquely construct with the specified name.
@@ -60,6 +62,11 @@ public:
 	 * @return Subscribers : handle to the list.
 	 */
 	const Subscribers* subscribers() const { return &topic_subscribers; }
+	/**
+	 * @brief List of publishers (signals) to a topic.
+	 * @return std::set : handle to the list.
+	 */
+	const std::set<SigSlot<Data>*>& publishers() const { return topic_publishers; }
 
 	/**
 	 * @brief Add a subscriber.
@@ -0,0 +1,108 @@
+/**
+ * @file /ecl_sigslots/include/ecl/sigslots/topic_handle.hpp
+ *
+ * @brief Interned identifiers for sigslot topics.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_SIGSLOTS_TOPIC_HANDLE_HPP_
+#define ECL_SIGSLOTS_TOPIC_HANDLE_HPP_
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <ecl/config/macros.hpp>
+#include <ecl/threads/mutex.hpp>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Interface [TopicHandle]
+*****************************************************************************/
+/**
+ * @brief Interned name of a sigslots topic.
+ *
+ * Constructing a handle hashes the name and looks it up in (or adds it to)
+ * a process wide table of topic names, once. From then on the handle is
+ * just a small integer id, so connecting and disconnecting by handle does
+ * no string comparisons or hashing at all. Every handle for the same name
+ * has the same id.
+ *
+ * Handles are implicitly constructed from strings, so any of the sigslots
+ * methods taking a handle also take a topic name. Keep a handle around if
+ * you rewire the same topics often, e.g. when loading plugins.
+ *
+ * <b>Usage:</b>
+ *
+ * @code
+ * static const TopicHandle odometry("odometry");
+ * Slot<const Odom&> slot(&Planner::update, planner);
+ * slot.connect(odometry);
+ * @endcode
+ *
+ * Interning is thread safe. Names are never released.
+ */
+class ECL_PUBLIC TopicHandle {
+public:
+	/**
+	 * @brief Intern the topic name.
+	 * @param name : the topic's name.
+	 */
+	TopicHandle(const std::string &name) { intern(name); }
+	/**
+	 * @brief Intern the topic name.
+	 * @param name : the topic's name.
+	 */
+	TopicHandle(const char *name) { intern(std::string(name)); }
+
+	const std::string& name() const { return *topic_name; } /**< @brief The topic's name. **/
+	unsigned int id() const { return topic_id; } /**< @brief Unique (process wide) id for the topic's name. **/
+
+	bool operator==(const TopicHandle &other) const { return topic_id == other.topic_id; } /**< @brief Same topic. **/
+	bool operator!=(const TopicHandle &other) const { return topic_id != other.topic_id; } /**< @brief Different topics. **/
+	bool operator<(const TopicHandle &other) const { return topic_id < other.topic_id; } /**< @brief Orders by id (not by name). **/
+
+private:
+	void intern(const std::string &name) {
+		Table &table = names();
+		table.mutex.lock();
+		std::pair<Names::iterator, bool> ret = table.ids.insert(Names::value_type(name, table.ids.size()));
+		// read through the iterator while still locked, another insert may rehash
+		topic_name = &(ret.first->first); // the key itself doesn't move
+		topic_id = ret.first->second;
+		table.mutex.unlock();
+	}
+
+	typedef std::unordered_map<std::string, unsigned int> Names;
+	struct Table {
+		Mutex mutex;
+		Names ids;
+	};
+	/**
+	 * Function local static, so handles made during static initialisation
+	 * don't find an unconstructed table.
+	 */
+	static Table& names() {
+		static Table table;
+		return table;
+	}
+
+	unsigned int topic_id;
+	const std::string *topic_name;
+};
+
+} // namespace ecl
+
+#endif /* ECL_SIGSLOTS_TOPIC_HANDLE_HPP_ */
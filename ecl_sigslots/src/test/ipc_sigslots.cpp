@@ -0,0 +1,206 @@
+/**
+ * @file /ecl_sigslots/src/test/ipc_sigslots.cpp
+ *
+ * @brief Unit test sigslots between processes.
+ *
+ * @date October 2026
+ **/
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <iostream>
+#include <sched.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <gtest/gtest.h>
+#include <ecl/exceptions/standard_exception.hpp>
+#include "../../include/ecl/sigslots/ipc_signal.hpp"
+#include "../../include/ecl/sigslots/ipc_slot.hpp"
+
+#ifdef ECL_HAS_TOPIC_REGISTRY
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::IpcSignal;
+using ecl::IpcSlot;
+using ecl::StandardException;
+
+/**
+ * @cond DO_NOT_DOXYGEN
+ */
+/*****************************************************************************
+** Classes
+*****************************************************************************/
+
+namespace {
+
+const char registry[] = "ecl_test_sigslots_registry";
+
+struct Odometry {
+	unsigned long sequence;
+	double x, y, heading;
+};
+
+class Checker {
+public:
+	Checker() : count(0), in_order(true) {}
+	void check(const Odometry &odometry) {
+		in_order = in_order && ( odometry.sequence == count ) && ( odometry.x == 0.5*count ) && ( odometry.heading == -1.0 );
+		++count;
+	}
+	unsigned long count;
+	bool in_order;
+};
+
+/*
+ * Forked children can't use the gtest macros, so they just report by
+ * exit code, and both ends step through the test by passing bytes along pipes.
+ */
+void send(int descriptor) {
+	const char byte = 0;
+	if ( write(descriptor, &byte, 1) != 1 ) {
+		_exit(3);
+	}
+}
+
+bool receive(int descriptor) {
+	char byte;
+	return ( read(descriptor, &byte, 1) == 1 );
+}
+
+template <typename F>
+pid_t spawn(F child) {
+	pid_t pid = fork();
+	if ( pid == 0 ) {
+		int code = 2;
+		try {
+			code = child();
+		} catch ( const StandardException &e ) {
+			std::cout << e.what() << std::endl;
+		}
+		_exit(code);
+	}
+	return pid;
+}
+
+int exitCode(pid_t child, int ready[2], int done[2]) {
+	int status = -1;
+	waitpid(child, &status, 0);
+	close(ready[0]); close(ready[1]);
+	close(done[0]); close(done[1]);
+	return ( WIFEXITED(status) ) ? WEXITSTATUS(status) : -1;
+}
+
+bool available() {
+	try {
+		IpcSignal<int> probe("ecl_test_probe", registry);
+		return true;
+	} catch ( const StandardException &e ) {
+		std::cout << "Shared memory is not available, skipping [" << e.what() << "]" << std::endl;
+		return false;
+	}
+}
+
+} // namespace
+
+/**
+ * @endcond
+ */
+
+/*****************************************************************************
+** Tests
+*****************************************************************************/
+
+TEST(IpcSigSlotsTests,delivery) {
+	if ( !available() ) {
+		return;
+	}
+	const unsigned long n = 2000;
+	int ready[2], done[2];
+	ASSERT_EQ(0, pipe(ready));
+	ASSERT_EQ(0, pipe(done));
+	pid_t child = spawn([&]() {
+		Checker checker;
+		{
+			IpcSlot<const Odometry&> slot(&Checker::check, checker, "delivery", 16*1024, registry);
+			send(ready[1]);
+			receive(done[0]);
+		}
+		return ( ( checker.count == n ) && checker.in_order ) ? 0 : 1;
+	});
+	ASSERT_GT(child, 0);
+	ASSERT_TRUE(receive(ready[0]));
+	IpcSignal<const Odometry&> signal("delivery", registry);
+	IpcSignal<int> mismatched("delivery", registry);
+	EXPECT_EQ(0u, mismatched.emit(1)); // a different payload size, not connected
+	for ( unsigned long i = 0; i < n; ++i ) {
+		Odometry odometry = { i, 0.5*i, 0.0, -1.0 };
+		while ( signal.emit(odometry) == 0 ) { // a small channel, let the slot catch up
+			sched_yield();
+		}
+	}
+	EXPECT_EQ(1u, signal.subscribers());
+	send(done[1]);
+	EXPECT_EQ(0, exitCode(child, ready, done)); // all received, in order
+}
+
+TEST(IpcSigSlotsTests,discovery) {
+	if ( !available() ) {
+		return;
+	}
+	IpcSignal<const Odometry&> signal("discovery", registry);
+	Odometry odometry = { 0, 0.0, 0.0, -1.0 };
+	EXPECT_EQ(0u, signal.emit(odometry)); // nobody listening yet
+	int ready[2], done[2];
+	ASSERT_EQ(0, pipe(ready));
+	ASSERT_EQ(0, pipe(done));
+	pid_t child = spawn([&]() {
+		Checker checker;
+		{
+			IpcSlot<const Odometry&> slot(&Checker::check, checker, "discovery", 16*1024, registry);
+			send(ready[1]);
+			receive(done[0]);
+		}
+		send(ready[1]); // unsubscribed
+		receive(done[0]);
+		return ( checker.count == 1 ) ? 0 : 1;
+	});
+	ASSERT_GT(child, 0);
+	ASSERT_TRUE(receive(ready[0]));
+	EXPECT_EQ(1u, signal.emit(odometry)); // picked up the new subscriber
+	send(done[1]);
+	ASSERT_TRUE(receive(ready[0]));
+	EXPECT_EQ(0u, signal.emit(odometry)); // and noticed it leave
+	EXPECT_EQ(0u, signal.subscribers());
+	send(done[1]);
+	EXPECT_EQ(0, exitCode(child, ready, done));
+}
+
+/*****************************************************************************
+** Main program
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+
+	testing::InitGoogleTest(&argc,argv);
+	return RUN_ALL_TESTS();
+}
+
+#else
+
+/*****************************************************************************
+** Alternative Main
+*****************************************************************************/
+
+int main(int /* argc */, char ** /* argv */) {
+	std::cout << std::endl;
+	std::cout << "Sigslots between processes are not supported on this platform." << std::endl;
+	std::cout << std::endl;
+	return 0;
+}
+
+#endif /* ECL_HAS_TOPIC_REGISTRY */
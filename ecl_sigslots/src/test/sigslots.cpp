@@ -11,9 +11,15 @@
 *****************************************************************************/
 
 
+#include <atomic>
+#include <chrono>
 #include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 #include <ecl/exceptions/standard_exception.hpp>
+#include <ecl/threads/thread.hpp>
 #include "../../include/ecl/sigslots/signal.hpp"
 #include "../../include/ecl/sigslots/slot.hpp"
 
@@ -55,6 +61,68 @@ public:
 	int f_count, g_count;
 };
 
+/**
+ * Counts how often it gets copied on the way to the slots.
+ */
+class Payload {
+public:
+	Payload() {}
+	Payload(const Payload &/*other*/) { copies++; }
+	static int copies;
+};
+
+int Payload::copies = 0;
+
+/**
+ * Records what a queued slot is given and which thread runs it. Setting
+ * hold keeps the executor inside the slot until it is cleared.
+ */
+class Recorder {
+public:
+	Recorder() : hold(false), holding(false), count(0) {}
+
+	void record(const int &i) {
+		thread = std::this_thread::get_id();
+		if ( hold ) {
+			holding = true;
+			while ( hold ) {
+				std::this_thread::yield();
+			}
+			holding = false;
+		}
+		values.push_back(i);
+		count++;
+	}
+	void waitFor(const int &n) {
+		while ( count < n ) {
+			std::this_thread::yield();
+		}
+	}
+
+	std::atomic<bool> hold, holding;
+	std::atomic<int> count;
+	std::vector<int> values;
+	std::thread::id thread;
+};
+
+/**
+ * Takes its time being copied (into and out of a queue) if asked to.
+ */
+class SlowPayload {
+public:
+	SlowPayload(const int &i = 0, const bool &copy_slowly = false) : value(i), slow(copy_slowly) {}
+	SlowPayload& operator=(const SlowPayload &other) {
+		if ( other.slow ) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		}
+		value = other.value;
+		slow = other.slow;
+		return *this;
+	}
+	int value;
+	bool slow;
+};
+
 /*****************************************************************************
 ** Functions
 *****************************************************************************/
@@ -74,6 +142,69 @@ void g()
 //    std::cout << "  Global function" << std::endl;;
 }
 
+static std::atomic<int> h_count(0);
+
+void h(const int &/*i*/)
+{
+	h_count++;
+}
+
+/**
+ * Slots on one topic, one of which (the killer) deletes all the others
+ * (the victims) when it runs.
+ */
+class Peers {
+public:
+	Peers() : killer(NULL), count(0) {}
+	~Peers() {
+		kill();
+		delete killer;
+	}
+	void connect(const std::string &topic) {
+		killer = new Slot<const int&>(&Peers::onKill, *this, topic);
+		for ( unsigned int i = 0; i < 8; ++i ) {
+			victims.push_back(new Slot<const int&>(&Peers::onVictim, *this, topic));
+		}
+	}
+	void onKill(const int &/*i*/) { kill(); }
+	void onVictim(const int &/*i*/) { count++; }
+	void kill() {
+		for ( unsigned int i = 0; i < victims.size(); ++i ) {
+			delete victims[i];
+		}
+		victims.clear();
+	}
+
+	Slot<const int&> *killer;
+	std::vector< Slot<const int&>* > victims;
+	std::atomic<int> count;
+};
+
+/**
+ * A queued slot that deletes itself the first time it runs.
+ */
+class SelfDestroyer {
+public:
+	SelfDestroyer(ecl::SlotExecutor &executor) : count(0), destroyed(false) {
+		slot = new Slot<const int&>(&SelfDestroyer::onEmit, *this, executor);
+		slot->connect("self_destroyer");
+	}
+	void onEmit(const int &/*i*/) {
+		count++;
+		delete slot;
+		slot = NULL;
+		destroyed = true;
+	}
+	Slot<const int&> *slot;
+	std::atomic<int> count;
+	std::atomic<bool> destroyed;
+};
+
+void slowPayload(const SlowPayload &/*payload*/) {}
+
+void byValue(Payload /*payload*/) {}
+void byReference(const Payload &/*payload*/) {}
+
 } // namespace tests
 } // namespace signals
 } // namespace ecl
@@ -170,6 +301,300 @@ TEST(SigSlotsTests, disconnect) {
     EXPECT_EQ(2,f_count);
 }
 
+TEST(SigSlotsTests, copies) {
+	Signal<Payload> signal("copies");
+	Slot<Payload> slot0(byValue,"copies");
+	Slot<Payload> slot1(byValue,"copies");
+	Signal<const Payload&> reference_signal("reference_copies");
+	Slot<const Payload&> reference_slot0(byReference,"reference_copies");
+	Slot<const Payload&> reference_slot1(byReference,"reference_copies");
+	Payload payload;
+	Payload::copies = 0;
+	signal.emit(payload);
+	EXPECT_EQ(2,Payload::copies); // one for each slot's function
+	Payload::copies = 0;
+	reference_signal.emit(payload);
+	EXPECT_EQ(0,Payload::copies);
+}
+
+TEST(SigSlotsTests, topicHandles) {
+	const ecl::TopicHandle odometry("odometry");
+	const ecl::TopicHandle scan(std::string("scan"));
+	EXPECT_EQ(odometry, ecl::TopicHandle("odometry"));
+	EXPECT_NE(odometry, scan);
+	EXPECT_EQ(std::string("scan"), scan.name());
+
+	A a, b;
+	Signal<const int&> signal(odometry);
+	Slot<const int&> slot0(&A::f, a, odometry);
+	Slot<const int&> slot1(&A::f, b);
+	slot1.connect("odometry"); // names and handles are interchangeable
+	slot1.connect(scan);
+	EXPECT_EQ(2u, slot1.connections().size());
+	signal.emit(1);
+	EXPECT_EQ(1, a.f_count);
+	EXPECT_EQ(1, b.f_count);
+
+	// rewire
+	slot1.disconnect(odometry);
+	signal.connect(scan);
+	signal.emit(1);
+	EXPECT_EQ(2, a.f_count);
+	EXPECT_EQ(2, b.f_count);
+	signal.disconnect(odometry);
+	signal.emit(1);
+	EXPECT_EQ(2, a.f_count);
+	EXPECT_EQ(3, b.f_count);
+	EXPECT_EQ(1u, slot1.connections().size());
+	EXPECT_EQ(std::string("scan"), *slot1.connections().begin());
+}
+
+/**
+ * Interning from several threads at once, the inserts rehash the table
+ * under each other's feet.
+ */
+TEST(SigSlotsTests, topicHandlesConcurrent) {
+	std::vector<std::thread> threads;
+	std::vector<std::vector<ecl::TopicHandle> > handles(4);
+	for ( unsigned int t = 0; t < handles.size(); ++t ) {
+		threads.push_back(std::thread([t, &handles]() {
+			for ( unsigned int i = 0; i < 2000; ++i ) {
+				handles[t].push_back(ecl::TopicHandle("concurrent_" + std::to_string(i)));
+			}
+		}));
+	}
+	for ( unsigned int t = 0; t < threads.size(); ++t ) {
+		threads[t].join();
+	}
+	for ( unsigned int i = 0; i < 2000; ++i ) {
+		EXPECT_EQ("concurrent_" + std::to_string(i), handles[0][i].name());
+		for ( unsigned int t = 1; t < handles.size(); ++t ) {
+			EXPECT_EQ(handles[0][i], handles[t][i]);
+		}
+	}
+}
+
+TEST(SigSlotsTests, queuedSlots) {
+	ecl::SlotExecutor executor;
+	Recorder recorder;
+	Signal<const int&> signal("queued");
+	Slot<const int&> slot(&Recorder::record, recorder, executor);
+	slot.connect("queued");
+	EXPECT_TRUE(slot.isQueued());
+	for ( int i = 0; i < 10; ++i ) {
+		signal.emit(i);
+	}
+	recorder.waitFor(10);
+	while ( slot.queueStatistics().processed < 10 ) {
+		std::this_thread::yield();
+	}
+	EXPECT_NE(std::this_thread::get_id(), recorder.thread);
+	ASSERT_EQ(10u, recorder.values.size());
+	for ( int i = 0; i < 10; ++i ) {
+		EXPECT_EQ(i, recorder.values[i]);
+	}
+	ecl::SlotQueueStatistics statistics = slot.queueStatistics();
+	EXPECT_EQ(16u, statistics.capacity);
+	EXPECT_EQ(0u, statistics.depth);
+	EXPECT_EQ(10u, statistics.enqueued);
+	EXPECT_EQ(0u, statistics.dropped);
+	EXPECT_LE(1u, statistics.max_depth);
+	EXPECT_LE(statistics.mean_latency, statistics.max_latency);
+	EXPECT_FALSE(Slot<const int&>(f).isQueued());
+}
+
+/**
+ * Hold the executor up in the first payload, then emit ten more at a queue of four.
+ */
+std::vector<int> overflow(const ecl::QueueOverflowPolicy &policy, ecl::SlotQueueStatistics &statistics) {
+	ecl::SlotExecutor executor;
+	Recorder recorder;
+	recorder.hold = true;
+	Signal<const int&> signal("overflow");
+	Slot<const int&> slot(&Recorder::record, recorder, executor, 4, policy);
+	slot.connect("overflow");
+	signal.emit(0);
+	while ( !recorder.holding ) {
+		std::this_thread::yield();
+	}
+	for ( int i = 1; i <= 10; ++i ) {
+		signal.emit(i);
+	}
+	recorder.hold = false;
+	recorder.waitFor(5);
+	while ( slot.queueStatistics().processed < 5 ) {
+		std::this_thread::yield();
+	}
+	statistics = slot.queueStatistics();
+	return recorder.values;
+}
+
+TEST(SigSlotsTests, queueOverflow) {
+	ecl::SlotQueueStatistics statistics;
+	const int newest[] = { 0, 1, 2, 3, 4 };
+	EXPECT_EQ(std::vector<int>(newest, newest + 5), overflow(ecl::DropNewest, statistics));
+	EXPECT_EQ(6u, statistics.dropped);
+	EXPECT_EQ(5u, statistics.enqueued);
+	EXPECT_EQ(4u, statistics.max_depth);
+	const int oldest[] = { 0, 7, 8, 9, 10 };
+	EXPECT_EQ(std::vector<int>(oldest, oldest + 5), overflow(ecl::DropOldest, statistics));
+	EXPECT_EQ(6u, statistics.dropped);
+	EXPECT_EQ(11u, statistics.enqueued);
+	EXPECT_EQ(4u, statistics.max_depth);
+}
+
+/**
+ * Emit more than a blocking queued slot can hold.
+ */
+static std::atomic<bool> emitted(false);
+
+void blockingEmitter() {
+	Signal<const int&> signal("blocking");
+	for ( int i = 0; i <= 10; ++i ) {
+		signal.emit(i);
+	}
+	emitted = true;
+}
+
+TEST(SigSlotsTests, queueBlocking) {
+	ecl::SlotExecutor executor;
+	Recorder recorder;
+	recorder.hold = true;
+	Slot<const int&> slot(&Recorder::record, recorder, executor, 4, ecl::BlockEmitter);
+	slot.connect("blocking");
+	ecl::Thread thread(blockingEmitter);
+	while ( slot.queueStatistics().depth < 4 ) {
+		std::this_thread::yield();
+	}
+	for ( unsigned int i = 0; i < 1000; ++i ) {
+		std::this_thread::yield();
+	}
+	EXPECT_FALSE(emitted); // stuck waiting for room
+	recorder.hold = false;
+	thread.join();
+	EXPECT_TRUE(emitted);
+	recorder.waitFor(11);
+	ASSERT_EQ(11u, recorder.values.size());
+	for ( int i = 0; i <= 10; ++i ) {
+		EXPECT_EQ(i, recorder.values[i]);
+	}
+	EXPECT_EQ(0u, slot.queueStatistics().dropped);
+}
+
+TEST(SigSlotsTests, queueTwoEmitters) {
+	ecl::SlotExecutor executor;
+	Slot<const SlowPayload&> slot(slowPayload, executor, 16, ecl::DropNewest);
+	slot.connect("two_emitters");
+	Signal<const SlowPayload&> slow_signal("two_emitters");
+	Signal<const SlowPayload&> signal("two_emitters");
+	std::thread thread([&slow_signal]() {
+		slow_signal.emit(SlowPayload(1, true));
+	});
+	// the other emitter has claimed the first cell, but is still copying into it
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	signal.emit(SlowPayload(2));
+	thread.join();
+	for ( unsigned int i = 0; ( i < 1000 ) && ( slot.queueStatistics().processed < 2 ); ++i ) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	EXPECT_EQ(2u, slot.queueStatistics().processed);
+	EXPECT_EQ(0u, slot.queueStatistics().depth);
+}
+
+TEST(SigSlotsTests, queueSelfDestroy) {
+	ecl::SlotExecutor executor;
+	SelfDestroyer destroyer(executor);
+	Recorder recorder;
+	Slot<const int&> slot(&Recorder::record, recorder, executor);
+	slot.connect("self_destroyer");
+	Signal<const int&> signal("self_destroyer");
+	signal.emit(1);
+	signal.emit(2); // gone by the time this runs, if it was queued at all
+	while ( !destroyer.destroyed ) {
+		std::this_thread::yield();
+	}
+	recorder.waitFor(2);
+	EXPECT_EQ(1, destroyer.count);
+	signal.emit(3); // the executor is still running the other slot
+	recorder.waitFor(3);
+	EXPECT_EQ(1, destroyer.count);
+	EXPECT_EQ(1u, executor.slots());
+}
+
+/**
+ * Rewire the slots while another thread keeps emitting.
+ */
+static std::atomic<bool> emitting(true);
+
+void emitter() {
+	Signal<const int&> signal("concurrent");
+	while ( emitting ) {
+		signal.emit(1);
+	}
+}
+
+TEST(SigSlotsTests, concurrentConnections) {
+	ecl::Thread thread(emitter);
+	for ( unsigned int i = 0; i < 50; ++i ) {
+		Slot<const int&> slot(h,"concurrent");
+		const int before = h_count;
+		while ( h_count == before ) {
+			std::this_thread::yield(); // until the emitter is using it
+		}
+		Slot<const int&> other_slot(h);
+		other_slot.connect("concurrent");
+		other_slot.disconnect();
+	} // destroyed while the emitter may be running them
+	emitting = false;
+	thread.join();
+	int count = h_count;
+	Signal<const int&> signal("concurrent");
+	signal.emit(1);
+	EXPECT_EQ(count,h_count); // nothing left connected
+	EXPECT_LT(0,count);
+}
+
+TEST(SigSlotsTests, destroyPeersInsideEmit) {
+	Peers peers;
+	peers.connect("peers");
+	Signal<const int&> signal("peers");
+	signal.emit(1); // deletes every victim, including those it hasn't reached yet
+	EXPECT_TRUE(peers.victims.empty());
+	EXPECT_GT(8,peers.count); // only those ahead of the killer ran
+	const int count = peers.count;
+	signal.emit(1);
+	EXPECT_EQ(count,peers.count);
+}
+
+TEST(SigSlotsTests, destroyInsideEmitWhileEmitting) {
+	Peers peers;
+	peers.connect("busy_peers");
+	delete peers.killer;
+	peers.killer = NULL;
+	std::atomic<bool> running(true);
+	std::thread thread([&running]() {
+		Signal<const int&> signal("busy_peers");
+		while ( running ) {
+			signal.emit(1);
+		}
+	});
+	while ( peers.count < 100 ) {
+		std::this_thread::yield(); // until the emitter is using them
+	}
+	// deleted from inside an emit, which can't wait for the other thread
+	Signal<> signal("busy_peers_destroyer");
+	Slot<> destroyer(&Peers::kill, peers);
+	destroyer.connect("busy_peers_destroyer");
+	signal.emit();
+	const int count = peers.count;
+	for ( unsigned int i = 0; i < 100; ++i ) {
+		std::this_thread::yield();
+	}
+	EXPECT_GE(count + 1,peers.count); // at most the run that was under way
+	running = false;
+	thread.join();
+}
+
 /*****************************************************************************
 ** Main program
 *****************************************************************************/
@@ -0,0 +1,260 @@
+/**
+ * @file /include/ecl/streams/log_records.hpp
+ *
+ * @brief Binary (deferred formatting) log records.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_STREAMS_LOG_RECORDS_HPP_
+#define ECL_STREAMS_LOG_RECORDS_HPP_
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <stdint.h>
+#include <ecl/threads/mutex.hpp>
+#include "macros.hpp"
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+namespace log_records {
+
+/*****************************************************************************
+** Format
+*****************************************************************************/
+/*
+ * A binary log is a sequence of records, each starting with its kind:
+ *
+ * - FormatRecord : [kind][uint32 id][uint16 length][format]
+ * - ModeRecord   : [kind][int32 mode][uint16 length][header]
+ * - EntryRecord  : [kind][uint32 format id][int32 mode][uint8 flags]
+ *                  [int64 sec][int32 nsec][uint16 length][arguments]
+ *
+ * Arguments are [uint8 type][raw bytes] (strings are [type][uint16 length][bytes]).
+ * Everything is in host byte order - decode logs on the same architecture.
+ *
+ * Records are never split across flushes (see SharedFile::writeRecord()), so
+ * dropped flushes and other streams sharing the file only ever lose or
+ * interleave whole records.
+ */
+
+/**
+ * @brief Leading byte of each record in a binary log.
+ */
+enum RecordKind {
+	FormatRecord = 0xE0,
+	ModeRecord = 0xE1,
+	EntryRecord = 0xE2
+};
+
+/**
+ * @brief Flags of an entry record, mirrors the LogStream's configuration.
+ */
+enum EntryFlags {
+	StampFlag = 0x01,
+	HeaderFlag = 0x02
+};
+
+/**
+ * @brief Type tag preceding each raw argument.
+ */
+enum ArgumentType {
+	BoolArgument = 1,     /**< @brief 1 byte. **/
+	CharArgument,         /**< @brief 1 byte. **/
+	SignedArgument,       /**< @brief int64_t. **/
+	UnsignedArgument,     /**< @brief uint64_t. **/
+	FloatArgument,        /**< @brief float. **/
+	DoubleArgument,       /**< @brief double. **/
+	StringArgument        /**< @brief uint16_t length, then the characters. **/
+};
+
+const unsigned int max_entry_size = 1024; /**< @brief Arguments beyond this are dropped. **/
+const unsigned int entry_header_size = 1 + 4 + 4 + 1 + 8 + 4 + 2;
+
+/*****************************************************************************
+** Interface [Encoder]
+*****************************************************************************/
+/**
+ * @brief Copies an entry's raw fields and arguments into a flat buffer.
+ *
+ * Used by LogStream's binary logging - nothing is formatted, arguments
+ * are tagged with their type and copied.
+ */
+class Encoder {
+public:
+	Encoder(const unsigned int &format_id, const int &mode, const unsigned char &flags, const long &sec, const long &nsec) :
+		size_(entry_header_size)
+	{
+		const uint32_t id = format_id;
+		const int32_t m = mode;
+		const int64_t s = sec;
+		const int32_t ns = nsec;
+		buffer[0] = static_cast<char>(EntryRecord);
+		memcpy(buffer + 1, &id, 4);
+		memcpy(buffer + 5, &m, 4);
+		buffer[9] = static_cast<char>(flags);
+		memcpy(buffer + 10, &s, 8);
+		memcpy(buffer + 18, &ns, 4);
+	}
+
+	template <typename... Arguments>
+	void encode(const Arguments&... arguments) {
+		int expand[] = { 0, (put(arguments), 0)... };
+		(void) expand;
+		const uint16_t length = static_cast<uint16_t>(size_ - entry_header_size);
+		memcpy(buffer + entry_header_size - 2, &length, 2);
+	}
+
+	const char* data() const { return buffer; }
+	unsigned int size() const { return size_; }
+
+	/*********************
+	** Arguments
+	**********************/
+	void put(const bool &value) { const char c = value ? 1 : 0; raw(BoolArgument, &c, 1); }
+	void put(const char &value) { raw(CharArgument, &value, 1); }
+	void put(const float &value) { raw(FloatArgument, &value, sizeof(float)); }
+	void put(const double &value) { raw(DoubleArgument, &value, sizeof(double)); }
+	void put(const long double &value) { put(static_cast<double>(value)); }
+	void put(const char *value) { string(value, strlen(value)); }
+	void put(const std::string &value) { string(value.c_str(), value.size()); }
+	template <typename T>
+	typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type put(const T &value) {
+		const int64_t v = value;
+		raw(SignedArgument, &v, 8);
+	}
+	template <typename T>
+	typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type put(const T &value) {
+		const uint64_t v = value;
+		raw(UnsignedArgument, &v, 8);
+	}
+
+private:
+	void raw(const ArgumentType &type, const void *bytes, const unsigned int &n) {
+		if ( size_ + 1 + n > max_entry_size ) {
+			size_ = max_entry_size; // drop this and any further arguments
+			return;
+		}
+		buffer[size_] = static_cast<char>(type);
+		memcpy(buffer + size_ + 1, bytes, n);
+		size_ += 1 + n;
+	}
+	void string(const char *s, unsigned long n) {
+		if ( size_ + 3 > max_entry_size ) {
+			size_ = max_entry_size;
+			return;
+		}
+		if ( size_ + 3 + n > max_entry_size ) {
+			n = max_entry_size - size_ - 3; // truncate
+		}
+		const uint16_t length = static_cast<uint16_t>(n);
+		buffer[size_] = static_cast<char>(StringArgument);
+		memcpy(buffer + size_ + 1, &length, 2);
+		memcpy(buffer + size_ + 3, s, n);
+		size_ += 3 + n;
+	}
+
+	unsigned int size_;
+	char buffer[max_entry_size];
+};
+
+} // namespace log_records
+
+/*****************************************************************************
+** Interface [LogFormatRegistry]
+*****************************************************************************/
+/**
+ * @brief Process wide registry of the format strings used by binary log records.
+ *
+ * Each LOG_BINARY call site registers its format once (the id is cached in
+ * a function local static) and log streams write the format into the log
+ * the first time they use it.
+ */
+class ecl_streams_PUBLIC LogFormatRegistry {
+public:
+	/**
+	 * @brief Register a format string.
+	 *
+	 * @param format : format with {} placeholders for the arguments.
+	 * @return unsigned int : the format's id.
+	 */
+	static unsigned int Register(const char *format);
+	/**
+	 * @brief Look up a registered format.
+	 *
+	 * @param id : the format's id.
+	 * @return const std::string& : the format (empty if unknown).
+	 */
+	static const std::string& Format(const unsigned int &id);
+
+private:
+	static ecl::Mutex mutex;
+	static std::deque<std::string> formats;
+};
+
+/*****************************************************************************
+** Interface [LogRecordDecoder]
+*****************************************************************************/
+/**
+ * @brief Renders binary log records as the text a LogStream would have written.
+ *
+ * Placeholders ({}) in each entry's format are replaced, in order, by the
+ * entry's arguments.
+ *
+ * @code
+ * std::ifstream input("control.blog", std::ios::binary);
+ * LogRecordDecoder decoder;
+ * if ( !decoder.decode(input, std::cout) ) {
+ *     std::cerr << "corrupt log" << std::endl;
+ * }
+ * @endcode
+ */
+class ecl_streams_PUBLIC LogRecordDecoder {
+public:
+	LogRecordDecoder() : entries(0), skipped_entries(0) {}
+	/**
+	 * @brief Decode every record in the input.
+	 *
+	 * @param input : binary log.
+	 * @param output : where the rendered text goes.
+	 * @return bool : false if the input was corrupt or truncated.
+	 */
+	bool decode(std::istream &input, std::ostream &output);
+	/**
+	 * @brief Number of entries decoded so far.
+	 */
+	unsigned long size() const { return entries; }
+	/**
+	 * @brief Number of entries skipped because their format was lost.
+	 *
+	 * Happens when the format's definition went with a dropped flush.
+	 */
+	unsigned long skipped() const { return skipped_entries; }
+
+private:
+	bool decodeEntry(std::istream &input, std::ostream &output, bool &skipped);
+	bool renderArguments(const std::string &format, const std::string &arguments, std::ostream &output);
+
+	std::map<unsigned int, std::string> formats;
+	std::map<int, std::string> headers;
+	unsigned long entries;
+	unsigned long skipped_entries;
+};
+
+} // namespace ecl
+
+#endif /* ECL_STREAMS_LOG_RECORDS_HPP_ */
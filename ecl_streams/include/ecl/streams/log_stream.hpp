@@ -18,10 +18,12 @@
 
 #include <map>
 #include <string>
+#include <vector>
 #include <ecl/config/macros.hpp>
 #include <ecl/devices/shared_file.hpp>
 #include <ecl/exceptions/standard_exception.hpp>
 #include <ecl/time/timestamp.hpp>
+#include "log_records.hpp"
 #include "text_stream.hpp"
 #include "macros.hpp"
 
@@ -44,6 +46,31 @@
   if ( !logStream.isModeEnabled(mode) ) {} \
   else logStream.log(mode)   // << rest of stream input will fill out here
 
+/**
+ * @brief Binary logging - formatting is deferred to the offline decoder.
+ *
+ * @ingroup Macros
+ *
+ * Instead of formatting on the calling thread, this copies a format id, the raw
+ * timestamp, the mode and the raw argument bytes into the log stream. Use
+ * {} as the placeholder for each argument in the format string and
+ * render the log later with the ecl_log_decoder utility.
+ *
+ * @code
+ * LOG_BINARY(log_stream, Debug, "iteration {}, error {}\n", i, error);
+ * @endcode
+ *
+ * Arguments may be of arithmetic, const char* or std::string type.
+ *
+ * @sa @ref ecl::LogStream "LogStream", @ref ecl::LogRecordDecoder "LogRecordDecoder".
+ */
+#define LOG_BINARY(logStream,mode,format,...) \
+  if ( !logStream.isModeEnabled(mode) ) {} \
+  else { \
+    static const unsigned int ecl_log_format_id = ecl::LogFormatRegistry::Register(format); \
+    logStream.logBinary(mode, ecl_log_format_id, ##__VA_ARGS__); \
+  }
+
 /**
  * @brief Enables flushing of log streams.
  *
@@ -106,6 +133,30 @@ namespace ecl {
  *
  * By default this will automatically add header and timestamp information. You
  * can manually disable these if you prefer.
+ *
+ * <b>Asynchronous Logging</b>:
+ *
+ * Flushing normally writes to the file on the logging thread. For time critical
+ * threads, switch the stream to asynchronous writes - FLUSH then just hands
+ * the buffered text to a lock-free ring drained by a background writer.
+ *
+ * @code
+ * LogStream log_stream("control.log");
+ * log_stream.enableAsynchronousWrites(64*1024, DropOnOverflow);
+ * @endcode
+ *
+ * <b>Binary Logging</b>:
+ *
+ * Even buffered, the number to text conversions run on the logging thread. The
+ * LOG_BINARY macro copies the raw arguments instead and leaves formatting to
+ * the offline decoder (ecl_log_decoder). Binary and text logging shouldn't
+ * be mixed in the one file.
+ *
+ * @code
+ * LOG_BINARY(log_stream, Warning, "joint {} at {} rad\n", joint_id, position);
+ * @endcode
+ *
+ * @sa @ref ecl::SharedFile "SharedFile".
  */
 class ecl_streams_PUBLIC LogStream : public TextStream<SharedFile> {
 public:
@@ -115,7 +166,7 @@ public:
 	 * This must open the underlying shared file device manually
 	 * via device().open() as you would do if using a TextStream.
 	 */
-	LogStream() {};
+	LogStream() : dropped_flushes(0) {};
 	/**
 	 * @brief Convenience constructor for logstreams.
 	 *
@@ -129,7 +180,8 @@ public:
 	 */
 	LogStream(const std::string &file_name, const WriteMode &mode = New) :
 		write_header(true),
-		write_stamp(true)
+		write_stamp(true),
+		dropped_flushes(0)
 	{
 		ecl_try {
 			if ( !this->device().open(file_name, mode) ) {
@@ -169,6 +221,16 @@ public:
 	 * is in the format seconds.nanoseconds (think unix time).
 	 **/
     void disableTimeStamp();
+	/**
+	 * @brief Hand flushes to a background writer thread.
+	 *
+	 * See the underlying @ref ecl::SharedFile::enableAsynchronousWrites() "SharedFile" for details.
+	 *
+	 * @param buffer_size : size of this stream's lock-free ring.
+	 * @param policy : drop or block when the ring is full.
+	 * @return bool : false if the file is not open.
+	 **/
+    bool enableAsynchronousWrites(const unsigned long &buffer_size = 64*1024, const OverflowPolicy &policy = DropOnOverflow);
 
     /**
      * @brief Enable the given mode and associate the specified header.
@@ -212,17 +274,75 @@ public:
      * @return OutputTextStream : log stream's output streaming parent.
      **/
     LogStream& log(int mode);
+    /**
+     * @brief Binary logging function.
+     *
+     * Do not use this directly, rather it is indirectly utilised by
+     * the LOG_BINARY macro. It writes the format and mode definitions the first
+     * time they are used (and again after a dropped flush) and then a record with
+     * the raw timestamp and arguments. Records are never split across flushes.
+     *
+     * @param mode : log mode that is being logged.
+     * @param format_id : id from the LogFormatRegistry.
+     * @param arguments : values to substitute for the format's placeholders.
+     **/
+    template <typename... Arguments>
+    void logBinary(const int &mode, const unsigned int &format_id, const Arguments&... arguments);
 
     using TextStream<SharedFile>::operator<<;
 
 private:
+    void defineFormat(const unsigned int &format_id);
+    void defineMode(const int &mode);
+
     bool write_header;
     bool write_stamp;
     std::map<int,std::string> modes;
     TimeStamp timestamp;
+    std::vector<bool> defined_formats;
+    std::vector<int> defined_modes;
+    unsigned long dropped_flushes;
 
 };
 
+/*****************************************************************************
+** Implementation [LogStream][Templates]
+*****************************************************************************/
+
+template <typename... Arguments>
+void LogStream::logBinary(const int &mode, const unsigned int &format_id, const Arguments&... arguments) {
+    if ( this->device().dropped() != dropped_flushes ) {
+        // the definitions may have gone with a dropped flush, write them again
+        dropped_flushes = this->device().dropped();
+        defined_formats.clear();
+        defined_modes.clear();
+    }
+    if ( ( format_id >= defined_formats.size() ) || !defined_formats[format_id] ) {
+        defineFormat(format_id);
+    }
+    bool mode_defined = false;
+    for ( unsigned int i = 0; i < defined_modes.size(); ++i ) {
+        if ( defined_modes[i] == mode ) { mode_defined = true; break; }
+    }
+    if ( !mode_defined ) {
+        defineMode(mode);
+    }
+    unsigned char flags = 0;
+    long sec = 0, nsec = 0;
+    if ( write_stamp ) {
+        timestamp.stamp();
+        sec = timestamp.sec();
+        nsec = timestamp.nsec();
+        flags |= log_records::StampFlag;
+    }
+    if ( write_header ) {
+        flags |= log_records::HeaderFlag;
+    }
+    log_records::Encoder encoder(format_id, mode, flags, sec, nsec);
+    encoder.encode(arguments...);
+    this->device().writeRecord(encoder.data(), encoder.size());
+}
+
 } // namespace ecl
 
 #endif /* ECL_STREAMS_LOG_STREAM_HPP_ */
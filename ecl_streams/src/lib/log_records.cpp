@@ -0,0 +1,219 @@
+/**
+ * @file /src/lib/log_records.cpp
+ *
+ * @brief Binary log record registry and decoder.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <iomanip>
+#include <string>
+#include "../../include/ecl/streams/log_records.hpp"
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Static Variable Initialisation [LogFormatRegistry]
+*****************************************************************************/
+
+Mutex LogFormatRegistry::mutex;
+std::deque<std::string> LogFormatRegistry::formats;
+
+/*****************************************************************************
+** Implementation [LogFormatRegistry]
+*****************************************************************************/
+
+unsigned int LogFormatRegistry::Register(const char *format) {
+	mutex.lock();
+	formats.push_back(format); // deque, so references handed out by Format() stay valid
+	unsigned int id = formats.size() - 1;
+	mutex.unlock();
+	return id;
+}
+
+const std::string& LogFormatRegistry::Format(const unsigned int &id) {
+	static const std::string unknown;
+	mutex.lock();
+	const std::string &format = ( id < formats.size() ) ? formats[id] : unknown;
+	mutex.unlock();
+	return format;
+}
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+namespace {
+
+template <typename T>
+bool read_value(std::istream &input, T &value) {
+	return static_cast<bool>(input.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+bool read_string(std::istream &input, std::string &s) {
+	uint16_t length;
+	if ( !read_value(input, length) ) {
+		return false;
+	}
+	s.resize(length);
+	return ( length == 0 ) || static_cast<bool>(input.read(&s[0], length));
+}
+
+} // namespace
+
+/*****************************************************************************
+** Implementation [LogRecordDecoder]
+*****************************************************************************/
+
+bool LogRecordDecoder::decode(std::istream &input, std::ostream &output) {
+	for (;;) {
+		int kind = input.get();
+		if ( kind == std::char_traits<char>::eof() ) {
+			return true;
+		}
+		switch ( kind ) {
+			case ( log_records::FormatRecord ) : {
+				uint32_t id;
+				std::string format;
+				if ( !read_value(input, id) || !read_string(input, format) ) { return false; }
+				formats[id] = format;
+				break;
+			}
+			case ( log_records::ModeRecord ) : {
+				int32_t mode;
+				std::string header;
+				if ( !read_value(input, mode) || !read_string(input, header) ) { return false; }
+				headers[mode] = header;
+				break;
+			}
+			case ( log_records::EntryRecord ) : {
+				bool skipped = false;
+				if ( !decodeEntry(input, output, skipped) ) { return false; }
+				if ( skipped ) {
+					++skipped_entries;
+				} else {
+					++entries;
+				}
+				break;
+			}
+			default : {
+				return false;
+			}
+		}
+	}
+}
+
+bool LogRecordDecoder::decodeEntry(std::istream &input, std::ostream &output, bool &skipped) {
+	uint32_t id;
+	int32_t mode;
+	uint8_t flags;
+	int64_t sec;
+	int32_t nsec;
+	std::string arguments;
+	if ( !read_value(input, id) || !read_value(input, mode) || !read_value(input, flags) ||
+	     !read_value(input, sec) || !read_value(input, nsec) || !read_string(input, arguments) ) {
+		return false;
+	}
+	std::map<unsigned int, std::string>::const_iterator format = formats.find(id);
+	if ( format == formats.end() ) {
+		// its definition was in a dropped flush, streams write it again after a drop
+		skipped = true;
+		return true;
+	}
+	// same layout as LogStream::log()
+	if ( flags & log_records::StampFlag ) {
+		output << sec << "." << std::setw(9) << std::setfill('0') << nsec << std::setfill(' ') << " ";
+	}
+	if ( flags & log_records::HeaderFlag ) {
+		output << "[" << headers[mode] << "] ";
+	}
+	if ( flags & (log_records::StampFlag | log_records::HeaderFlag) ) {
+		output << ": ";
+	}
+	return renderArguments(format->second, arguments, output);
+}
+
+bool LogRecordDecoder::renderArguments(const std::string &format, const std::string &arguments, std::ostream &output) {
+	std::string::size_type position = 0;
+	std::string::size_type offset = 0;
+	for (;;) {
+		std::string::size_type placeholder = format.find("{}", position);
+		if ( ( placeholder == std::string::npos ) || ( offset >= arguments.size() ) ) {
+			output << format.substr(position);
+			return true;
+		}
+		output << format.substr(position, placeholder - position);
+		position = placeholder + 2;
+		const char *bytes = arguments.data() + offset + 1;
+		const std::string::size_type remaining = arguments.size() - offset - 1;
+		std::string::size_type n = 0;
+		switch ( arguments[offset] ) {
+			case ( log_records::BoolArgument ) : {
+				n = 1;
+				if ( remaining < n ) { return false; }
+				output << ( bytes[0] ? "true" : "false" );
+				break;
+			}
+			case ( log_records::CharArgument ) : {
+				n = 1;
+				if ( remaining < n ) { return false; }
+				output << bytes[0];
+				break;
+			}
+			case ( log_records::SignedArgument ) : {
+				int64_t value;
+				n = sizeof(value);
+				if ( remaining < n ) { return false; }
+				memcpy(&value, bytes, n);
+				output << value;
+				break;
+			}
+			case ( log_records::UnsignedArgument ) : {
+				uint64_t value;
+				n = sizeof(value);
+				if ( remaining < n ) { return false; }
+				memcpy(&value, bytes, n);
+				output << value;
+				break;
+			}
+			case ( log_records::FloatArgument ) : {
+				float value;
+				n = sizeof(value);
+				if ( remaining < n ) { return false; }
+				memcpy(&value, bytes, n);
+				output << value;
+				break;
+			}
+			case ( log_records::DoubleArgument ) : {
+				double value;
+				n = sizeof(value);
+				if ( remaining < n ) { return false; }
+				memcpy(&value, bytes, n);
+				output << value;
+				break;
+			}
+			case ( log_records::StringArgument ) : {
+				uint16_t length;
+				if ( remaining < sizeof(length) ) { return false; }
+				memcpy(&length, bytes, sizeof(length));
+				n = sizeof(length) + length;
+				if ( remaining < n ) { return false; }
+				output.write(bytes + sizeof(length), length);
+				break;
+			}
+			default : {
+				return false;
+			}
+		}
+		offset += 1 + n;
+	}
+}
+
+} // namespace ecl
@@ -10,6 +10,8 @@
 ** Includes
 *****************************************************************************/
 
+#include <algorithm>
+#include <cstring>
 #include <utility>
 #include "../../include/ecl/streams/log_stream.hpp"
 
@@ -33,6 +35,9 @@ void LogStream::enableHeader() { write_header = true; }
 void LogStream::disableHeader() { write_header = false; }
 void LogStream::enableTimeStamp() { write_stamp = true; }
 void LogStream::disableTimeStamp() { write_stamp = false; }
+bool LogStream::enableAsynchronousWrites(const unsigned long &buffer_size, const OverflowPolicy &policy) {
+    return this->device().enableAsynchronousWrites(buffer_size, policy);
+}
 
 void LogStream::enableMode(int mode, std::string header) { modes.insert( std::make_pair(mode,header) ); }
 void LogStream::disableMode(int mode) { modes.erase(mode); }
@@ -67,5 +72,35 @@ LogStream& LogStream::log(int mode) {
     return (*this);
 }
 
+void LogStream::defineFormat(const unsigned int &format_id) {
+    const std::string &format = LogFormatRegistry::Format(format_id);
+    const uint32_t id = format_id;
+    char record[log_records::max_entry_size];
+    // formats longer than a record are truncated
+    const uint16_t length = static_cast<uint16_t>(std::min<std::string::size_type>(format.size(), sizeof(record) - 7));
+    record[0] = static_cast<char>(log_records::FormatRecord);
+    memcpy(record + 1, &id, sizeof(id));
+    memcpy(record + 5, &length, sizeof(length));
+    memcpy(record + 7, format.c_str(), length);
+    this->device().writeRecord(record, 7 + length);
+    if ( format_id >= defined_formats.size() ) {
+        defined_formats.resize(format_id + 1, false);
+    }
+    defined_formats[format_id] = true;
+}
+
+void LogStream::defineMode(const int &mode) {
+    const std::string &header = modes[mode];
+    const int32_t m = mode;
+    char record[log_records::max_entry_size];
+    const uint16_t length = static_cast<uint16_t>(std::min<std::string::size_type>(header.size(), sizeof(record) - 7));
+    record[0] = static_cast<char>(log_records::ModeRecord);
+    memcpy(record + 1, &m, sizeof(m));
+    memcpy(record + 5, &length, sizeof(length));
+    memcpy(record + 7, header.c_str(), length);
+    this->device().writeRecord(record, 7 + length);
+    defined_modes.push_back(mode);
+}
+
 } // namespace ecl
 
@@ -0,0 +1,173 @@
+/**
+ * @file /src/test/log_records.cpp
+ *
+ * @brief Unit Test for binary log records.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <gtest/gtest.h>
+#include <ecl/time/sleep.hpp>
+#include "../../include/ecl/streams/log_stream.hpp"
+#include "../../include/ecl/streams/log_records.hpp"
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using std::string;
+using ecl::LogRecordDecoder;
+using ecl::LogStream;
+using ecl::New;
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+enum LogModes {
+    Warning,
+    Debug
+};
+
+string decode(const string &file_name, bool &ok, unsigned long &entries) {
+    std::ifstream input(file_name.c_str(), std::ios::binary);
+    std::ostringstream output;
+    LogRecordDecoder decoder;
+    ok = decoder.decode(input, output);
+    entries = decoder.size();
+    return output.str();
+}
+
+/*****************************************************************************
+** Tests
+*****************************************************************************/
+
+TEST(LogRecordTests,decode) {
+    std::remove("log_records.blog");
+    {
+        LogStream log_stream("log_records.blog", New);
+        log_stream.enableMode(Warning, "WARNING");
+        log_stream.enableMode(Debug, "DEBUG");
+        log_stream.disableTimeStamp();
+        for ( int i = 0; i < 3; ++i ) {
+            LOG_BINARY(log_stream, Debug, "iteration {}, error {} [{}]\n", i, 0.5*i, "ok");
+        }
+        LOG_BINARY(log_stream, Warning, "{} {} {} {}\n", 'c', true, static_cast<unsigned char>(200), string("done"));
+        LOG_BINARY(log_stream, Warning, "no arguments\n");
+        log_stream.disableHeader();
+        LOG_BINARY(log_stream, Warning, "{}, more placeholders than arguments {}\n", -7L);
+        FLUSH(log_stream);
+    }
+    bool ok = false;
+    unsigned long entries = 0;
+    string text = decode("log_records.blog", ok, entries);
+    EXPECT_TRUE(ok);
+    EXPECT_EQ(6u, entries);
+    EXPECT_EQ(
+        "[DEBUG] : iteration 0, error 0 [ok]\n"
+        "[DEBUG] : iteration 1, error 0.5 [ok]\n"
+        "[DEBUG] : iteration 2, error 1 [ok]\n"
+        "[WARNING] : c true 200 done\n"
+        "[WARNING] : no arguments\n"
+        "-7, more placeholders than arguments {}\n",
+        text);
+}
+
+TEST(LogRecordTests,timestamps) {
+    std::remove("log_records.blog");
+    {
+        LogStream log_stream("log_records.blog", New);
+        log_stream.enableMode(Debug, "DEBUG");
+        LOG_BINARY(log_stream, Debug, "stamped\n");
+        FLUSH(log_stream);
+    }
+    bool ok = false;
+    unsigned long entries = 0;
+    string text = decode("log_records.blog", ok, entries);
+    EXPECT_TRUE(ok);
+    // e.g. 1760000000.000012345 [DEBUG] : stamped
+    string::size_type dot = text.find('.');
+    ASSERT_NE(string::npos, dot);
+    EXPECT_EQ(" [DEBUG] : stamped\n", text.substr(dot + 10));
+}
+
+TEST(LogRecordTests,dropOnOverflow) {
+    // the background writer can't keep up, so whole flushes get dropped
+    std::remove("log_records.blog");
+    unsigned long dropped = 0;
+    {
+        LogStream log_stream("log_records.blog", New);
+        log_stream.enableMode(Debug, "DEBUG");
+        log_stream.enableAsynchronousWrites(16*1024, ecl::DropOnOverflow);
+        for ( int i = 0; i < 20000; ++i ) {
+            LOG_BINARY(log_stream, Debug, "iteration {} of {}, error {}\n", i, 20000, string(i % 13, 'x'));
+            if ( i % 500 == 0 ) {
+                ecl::Sleep()(ecl::Duration(0.001)); // let the writer catch up now and again
+            }
+        }
+        FLUSH(log_stream);
+        dropped = log_stream.device().dropped();
+    }
+    bool ok = false;
+    unsigned long entries = 0;
+    string text = decode("log_records.blog", ok, entries);
+    EXPECT_TRUE(ok);
+    EXPECT_GT(entries, 0u);
+    if ( dropped == 0 ) {
+        EXPECT_EQ(20000u, entries);
+    }
+    // no torn records
+    std::istringstream lines(text);
+    string line;
+    unsigned long n = 0;
+    while ( std::getline(lines, line) ) {
+        EXPECT_NE(string::npos, line.find(" of 20000, error ")) << line;
+        ++n;
+    }
+    EXPECT_EQ(entries, n);
+}
+
+TEST(LogRecordTests,sharedFile) {
+    std::remove("log_records.blog");
+    {
+        LogStream first("log_records.blog", New);
+        LogStream second("log_records.blog", New);
+        first.enableMode(Debug, "FIRST");
+        second.enableMode(Debug, "SECOND");
+        for ( int i = 0; i < 20000; ++i ) {
+            LOG_BINARY(first, Debug, "first {}\n", i);
+            LOG_BINARY(second, Debug, "second {} {}\n", i, string("interleaved"));
+        }
+        FLUSH(first);
+        FLUSH(second);
+    }
+    bool ok = false;
+    unsigned long entries = 0;
+    decode("log_records.blog", ok, entries);
+    EXPECT_TRUE(ok);
+    EXPECT_EQ(40000u, entries);
+}
+
+TEST(LogRecordTests,corrupt) {
+    std::istringstream input(string("\xE2\x01\x02", 3));
+    std::ostringstream output;
+    LogRecordDecoder decoder;
+    EXPECT_FALSE(decoder.decode(input, output));
+}
+
+/*****************************************************************************
+** Main program
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+
+    testing::InitGoogleTest(&argc,argv);
+    return RUN_ALL_TESTS();
+}
@@ -35,9 +35,12 @@
 #endif
 
 //#include "threads/barrier.hpp"
+#include "threads/condition_variable.hpp"
+#include "threads/mpmc_queue.hpp"
 #include "threads/mutex.hpp"
 #include "threads/priority.hpp"
 #include "threads/thread.hpp"
+#include "threads/thread_pool.hpp"
 #include "threads/threadable.hpp"
 
 #ifdef replace_qt_emit
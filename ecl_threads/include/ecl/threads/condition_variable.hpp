@@ -0,0 +1,29 @@
+/**
+ * @file /include/ecl/threads/condition_variable.hpp
+ *
+ * @brief Cross platform condition variable.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_THREADS_CONDITION_VARIABLE_HPP_
+#define ECL_THREADS_CONDITION_VARIABLE_HPP_
+
+/*****************************************************************************
+** Cross Platform Functionality
+*****************************************************************************/
+
+#include <ecl/config/ecl.hpp>
+
+/*************************************************************************
+ * Includes
+ ************************************************************************/
+
+#if defined(ECL_HAS_POSIX_THREADS)
+  #include "condition_variable_pos.hpp"
+#endif
+
+#endif /* ECL_THREADS_CONDITION_VARIABLE_HPP_ */
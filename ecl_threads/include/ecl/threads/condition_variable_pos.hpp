@@ -0,0 +1,104 @@
+/**
+ * @file /include/ecl/threads/condition_variable_pos.hpp
+ *
+ * @brief Posix interface for a condition variable.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_THREADS_CONDITION_VARIABLE_POS_HPP_
+#define ECL_THREADS_CONDITION_VARIABLE_POS_HPP_
+
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#include <ecl/config/ecl.hpp>
+#if defined(ECL_IS_POSIX)
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <pthread.h>
+#include <ecl/config/macros.hpp>
+#include <ecl/time/duration.hpp>
+#include "mutex_pos.hpp"
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Class ConditionVariable
+*****************************************************************************/
+/**
+ * @brief Blocks threads until signalled by another thread.
+ *
+ * A thin wrapper around the posix condition variable, used with an
+ * ecl::Mutex. Timed waits are measured against the monotonic clock, so
+ * they are unaffected by changes to the system time.
+ *
+ * As with any condition variable, wakeups may be spurious, so always
+ * wait in a loop that checks the actual condition.
+ *
+ * @code
+ * mutex.lock();
+ * while ( !ready ) {
+ *   condition.wait(mutex);
+ * }
+ * mutex.unlock();
+ * @endcode
+ *
+ * @sa Mutex.
+ **/
+class ECL_PUBLIC ConditionVariable {
+public:
+	/**
+	 * @brief Initialises the condition variable.
+	 *
+	 * @exception StandardException : throws if initialisation fails [debug mode only].
+	 */
+	ConditionVariable();
+	virtual ~ConditionVariable();
+
+	/**
+	 * @brief Wait (indefinitely) until signalled.
+	 *
+	 * @param mutex : a mutex locked by the calling thread, unlocked while waiting.
+	 *
+	 * @exception StandardException : throws if the wait fails [debug mode only].
+	 */
+	void wait(Mutex &mutex);
+	/**
+	 * @brief Wait until signalled, or the duration expires.
+	 *
+	 * @param mutex : a mutex locked by the calling thread, unlocked while waiting.
+	 * @param duration : maximum time to wait (relative).
+	 * @return bool : false if the wait timed out.
+	 *
+	 * @exception StandardException : throws if the wait fails [debug mode only].
+	 */
+	bool wait(Mutex &mutex, const Duration &duration);
+	/**
+	 * @brief Wake up one waiting thread.
+	 */
+	void notify_one();
+	/**
+	 * @brief Wake up all waiting threads.
+	 */
+	void notify_all();
+
+private:
+	pthread_cond_t condition;
+};
+
+} // namespace ecl
+
+#endif /* ECL_IS_POSIX */
+#endif /* ECL_THREADS_CONDITION_VARIABLE_POS_HPP_ */
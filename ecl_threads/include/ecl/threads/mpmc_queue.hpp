@@ -0,0 +1,363 @@
+/**
+ * @file /include/ecl/threads/mpmc_queue.hpp
+ *
+ * @brief Bounded, multi-producer multi-consumer queue.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_THREADS_MPMC_QUEUE_HPP_
+#define ECL_THREADS_MPMC_QUEUE_HPP_
+
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#include <ecl/config/ecl.hpp>
+#if defined(ECL_HAS_POSIX_THREADS)
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <atomic>
+#include <cstddef>
+#include <ecl/config/macros.hpp>
+#include <ecl/errors/compile_time_assert.hpp>
+#include <ecl/time/duration.hpp>
+#include <ecl/time/timestamp.hpp>
+#include "condition_variable.hpp"
+#include "mutex.hpp"
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+namespace threads {
+
+/**
+ * @brief Compile time rounding up to the next power of two.
+ */
+constexpr std::size_t queue_storage_size(std::size_t n)
+{
+  std::size_t power = 2;
+  while ( power < n ) { power <<= 1; }
+  return power;
+}
+
+} // namespace threads
+
+/*****************************************************************************
+** Interface [MpmcQueue]
+*****************************************************************************/
+/**
+ * @brief Bounded queue for many producing and many consuming threads.
+ *
+ * A fixed size ring of slots, each tagged with a sequence number
+ * (D. Vyukov's bounded mpmc design). Producers and consumers claim slots
+ * with a single compare-and-swap on their own (cache line separated)
+ * position counter, then publish the slot by bumping its sequence number.
+ * There is no global lock, so contention is spread across the slots.
+ *
+ * The storage is rounded up to a power of two (minimum 2), so the real
+ * capacity() can be larger than the requested Size.
+ *
+ * The interface mirrors ecl::Mutex:
+ *
+ * - trypush()/trypop() : never block, return false if full/empty.
+ * - trypush()/trypop() with a Duration : block for at most that long.
+ * - push()/pop() : block until successful.
+ *
+ * Blocking calls only fall back to a mutex and condition variable when the
+ * queue is actually full/empty. The non-blocking paths only touch that
+ * mutex if some other thread is currently blocked waiting.
+ *
+ * @code
+ * MpmcQueue<Record, 1024> records;
+ *
+ * // any number of producer threads
+ * if ( !records.trypush(record) ) { ++dropped; }
+ *
+ * // consumer thread(s)
+ * Record record;
+ * while ( records.trypop(record, Duration(0.1)) ) { write(record); }
+ * @endcode
+ *
+ * @tparam Type : element type (must be default constructible and assignable).
+ * @tparam Size : minimum number of elements that can be queued.
+ */
+template <typename Type, std::size_t Size>
+class ECL_PUBLIC MpmcQueue {
+public:
+  typedef Type        value_type; /**< Element type. **/
+  typedef std::size_t size_type;  /**< Type used to denote the length of the queue. **/
+
+  static const std::size_t cache_line_size = 64; /**< @brief Padding used to separate the positions. **/
+  static const std::size_t storage_size = threads::queue_storage_size(Size); /**< @brief Number of slots. **/
+
+  MpmcQueue() :
+    enqueue_position(0),
+    dequeue_position(0),
+    push_waiters(0),
+    pop_waiters(0)
+  {
+    ecl_compile_time_assert( Size > 0 );
+    for ( std::size_t i = 0; i < storage_size; ++i ) {
+      slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+  virtual ~MpmcQueue() {}
+
+  /*********************
+  ** Producers
+  **********************/
+  /**
+   * @brief Push an element if there is room, otherwise return immediately.
+   *
+   * @param datum : element to copy into the queue.
+   * @return bool : false if the queue was full.
+   */
+  bool trypush(const Type &datum) {
+    if ( !enqueue(datum) ) {
+      return false;
+    }
+    wake(pop_waiters, not_empty);
+    return true;
+  }
+  /**
+   * @brief Push an element, waiting at most the specified duration for room.
+   *
+   * @param datum : element to copy into the queue.
+   * @param duration : maximum time to wait.
+   * @return bool : false if it timed out.
+   */
+  bool trypush(const Type &datum, const Duration &duration) {
+    if ( trypush(datum) ) {
+      return true;
+    }
+    TimeStamp deadline;
+    deadline += duration;
+    bool result = true;
+    mutex.lock();
+    push_waiters.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while ( !enqueue(datum) ) {
+      TimeStamp now;
+      if ( now >= deadline ) {
+        result = false;
+        break;
+      }
+      not_full.wait(mutex, deadline - now);
+    }
+    push_waiters.fetch_sub(1);
+    mutex.unlock();
+    if ( result ) {
+      wake(pop_waiters, not_empty);
+    }
+    return result;
+  }
+  /**
+   * @brief Push an element, blocking until there is room.
+   *
+   * @param datum : element to copy into the queue.
+   */
+  void push(const Type &datum) {
+    if ( trypush(datum) ) {
+      return;
+    }
+    mutex.lock();
+    push_waiters.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while ( !enqueue(datum) ) {
+      not_full.wait(mutex);
+    }
+    push_waiters.fetch_sub(1);
+    mutex.unlock();
+    wake(pop_waiters, not_empty);
+  }
+
+  /*********************
+  ** Consumers
+  **********************/
+  /**
+   * @brief Pop an element if there is one, otherwise return immediately.
+   *
+   * @param datum : storage for the popped element.
+   * @return bool : false if the queue was empty.
+   */
+  bool trypop(Type &datum) {
+    if ( !dequeue(datum) ) {
+      return false;
+    }
+    wake(push_waiters, not_full);
+    return true;
+  }
+  /**
+   * @brief Pop an element, waiting at most the specified duration for one.
+   *
+   * @param datum : storage for the popped element.
+   * @param duration : maximum time to wait.
+   * @return bool : false if it timed out.
+   */
+  bool trypop(Type &datum, const Duration &duration) {
+    if ( trypop(datum) ) {
+      return true;
+    }
+    TimeStamp deadline;
+    deadline += duration;
+    bool result = true;
+    mutex.lock();
+    pop_waiters.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while ( !dequeue(datum) ) {
+      TimeStamp now;
+      if ( now >= deadline ) {
+        result = false;
+        break;
+      }
+      not_empty.wait(mutex, deadline - now);
+    }
+    pop_waiters.fetch_sub(1);
+    mutex.unlock();
+    if ( result ) {
+      wake(push_waiters, not_full);
+    }
+    return result;
+  }
+  /**
+   * @brief Pop an element, blocking until one is available.
+   *
+   * @param datum : storage for the popped element.
+   */
+  void pop(Type &datum) {
+    if ( trypop(datum) ) {
+      return;
+    }
+    mutex.lock();
+    pop_waiters.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while ( !dequeue(datum) ) {
+      not_empty.wait(mutex);
+    }
+    pop_waiters.fetch_sub(1);
+    mutex.unlock();
+    wake(push_waiters, not_full);
+  }
+
+  /*********************
+  ** Queries
+  **********************/
+  /**
+   * @brief Approximate number of queued elements.
+   *
+   * Only a snapshot when other threads are active.
+   *
+   * @return unsigned int : number of queued elements.
+   */
+  unsigned int size() const {
+    const std::size_t tail = dequeue_position.load(std::memory_order_acquire);
+    const std::size_t head = enqueue_position.load(std::memory_order_acquire);
+    return ( head > tail ) ? static_cast<unsigned int>(head - tail) : 0;
+  }
+  bool empty() const { return size() == 0; }
+  /**
+   * @brief Maximum number of elements the queue can hold.
+   *
+   * @return unsigned int : the storage size (Size rounded up to a power of two).
+   */
+  unsigned int capacity() const { return storage_size; }
+
+private:
+  static const std::size_t mask = storage_size - 1;
+
+  struct Slot {
+    std::atomic<std::size_t> sequence;
+    Type data;
+  };
+
+  bool enqueue(const Type &datum) {
+    std::size_t position = enqueue_position.load(std::memory_order_relaxed);
+    Slot *slot;
+    for (;;) {
+      slot = &slots[position & mask];
+      const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+      const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+      if ( difference == 0 ) {
+        if ( enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) ) {
+          break;
+        }
+      } else if ( difference < 0 ) {
+        return false; // full
+      } else {
+        position = enqueue_position.load(std::memory_order_relaxed);
+      }
+    }
+    slot->data = datum;
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool dequeue(Type &datum) {
+    std::size_t position = dequeue_position.load(std::memory_order_relaxed);
+    Slot *slot;
+    for (;;) {
+      slot = &slots[position & mask];
+      const std::size_t sequence = slot->sequence.load(std::memory_order_acquire);
+      const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position + 1);
+      if ( difference == 0 ) {
+        if ( dequeue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) ) {
+          break;
+        }
+      } else if ( difference < 0 ) {
+        return false; // empty
+      } else {
+        position = dequeue_position.load(std::memory_order_relaxed);
+      }
+    }
+    datum = slot->data;
+    slot->sequence.store(position + storage_size, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * Pairs with the fence after registering as a waiter - either the waiter
+   * sees our update, or we see the waiter and signal it under the mutex.
+   */
+  void wake(std::atomic<unsigned int> &waiters, ConditionVariable &condition) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if ( waiters.load(std::memory_order_relaxed) > 0 ) {
+      mutex.lock();
+      condition.notify_all();
+      mutex.unlock();
+    }
+  }
+
+  // padding rather than alignas so heap allocation needs no over-aligned new
+  char padding_front[cache_line_size];
+  std::atomic<std::size_t> enqueue_position;
+  char padding_enqueue[cache_line_size];
+  std::atomic<std::size_t> dequeue_position;
+  char padding_dequeue[cache_line_size];
+  std::atomic<unsigned int> push_waiters;
+  std::atomic<unsigned int> pop_waiters;
+  Mutex mutex;
+  ConditionVariable not_full;
+  ConditionVariable not_empty;
+  char padding_waiters[cache_line_size];
+  Slot slots[storage_size];
+};
+
+template <typename Type, std::size_t Size>
+const std::size_t MpmcQueue<Type,Size>::storage_size;
+
+template <typename Type, std::size_t Size>
+const std::size_t MpmcQueue<Type,Size>::mask;
+
+} // namespace ecl
+
+#endif /* ECL_HAS_POSIX_THREADS */
+#endif /* ECL_THREADS_MPMC_QUEUE_HPP_ */
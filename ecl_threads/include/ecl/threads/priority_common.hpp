@@ -43,6 +43,17 @@ enum Priority {
     RealTimePriority4,
 };
 
+/**
+ * @brief Scheduling policy used for the real time priority levels.
+ *
+ * - RoundRobinScheduling : threads of equal priority are time sliced (posix SCHED_RR).
+ * - FifoScheduling : a thread runs until it blocks or yields (posix SCHED_FIFO).
+ */
+enum SchedulingPolicy {
+    RoundRobinScheduling = 0,
+    FifoScheduling
+};
+
 
 } // namespace ecl
 
@@ -104,6 +104,18 @@ namespace ecl {
  * @exception StandardException : throws if configuration fails.
  */
 bool ECL_PUBLIC set_priority(Priority priority_level);
+/**
+ * @brief Sets the priority to the specified level with a chosen real time policy.
+ *
+ * As for set_priority(Priority), but the real time levels may use either
+ * SCHED_RR or SCHED_FIFO. The policy is ignored for the non real time levels.
+ *
+ * @param priority_level : the priority level requested for this process.
+ * @param policy : the real time scheduling policy.
+ * @return bool : true if success, false if failed and exceptions aren't enabled.
+ * @exception StandardException : throws if configuration fails.
+ */
+bool ECL_PUBLIC set_priority(Priority priority_level, SchedulingPolicy policy);
 /**
  * @brief Returns the process' current priority level.
  *
@@ -119,6 +131,59 @@ Priority ECL_PUBLIC get_priority();
  */
 std::string ECL_PUBLIC print_priority_diagnostics();
 
+/*****************************************************************************
+** Real Time Helpers
+*****************************************************************************/
+/**
+ * @brief Pins the calling thread to a set of cpus.
+ *
+ * Bit i of the mask enables cpu i (e.g. 0x3 allows cpus 0 and 1). Only
+ * the first 8*sizeof(unsigned long) cpus can be addressed. Linux only,
+ * elsewhere it fails with NotSupportedError.
+ *
+ * @param cpu_mask : bitmask of the cpus the thread may run on.
+ * @return bool : true if success, false if failed and exceptions aren't enabled.
+ * @exception StandardException : throws if configuration fails [debug mode only].
+ */
+bool ECL_PUBLIC set_cpu_affinity(const unsigned long &cpu_mask);
+/**
+ * @brief Retrieves the cpu mask of the calling thread.
+ *
+ * @return unsigned long : bitmask of allowed cpus (0 if unknown/not supported).
+ */
+unsigned long ECL_PUBLIC get_cpu_affinity();
+/**
+ * @brief Touches the next chunk of the calling thread's stack.
+ *
+ * Writes to every page of the requested size of stack so that later use
+ * doesn't page fault. Combine with set_process_realtime() (mlockall) to
+ * keep the pages resident. The size must be comfortably less than the
+ * thread's stack size.
+ *
+ * @param size : number of bytes of stack to pre-fault.
+ */
+void ECL_PUBLIC prefault_stack(const unsigned long &size);
+/**
+ * @brief Configures the process' memory for real time work.
+ *
+ * Usually called once at startup, before spawning the real time threads.
+ *
+ * - Locks all current and future pages into ram (mlockall).
+ * - Disables heap trimming and mmap for large allocations (glibc), so
+ *   freed memory stays with the process.
+ * - Reserves the requested heap by allocating, touching and freeing it.
+ * - Pre-faults the requested amount of the calling thread's stack.
+ *
+ * Locking memory requires CAP_IPC_LOCK or a sufficient memlock limit
+ * (cf. <i>/etc/security/limits.conf</i>).
+ *
+ * @param heap_reserve : bytes of heap to pre-fault and keep.
+ * @param stack_reserve : bytes of the calling thread's stack to pre-fault.
+ * @return bool : true if success, false if failed and exceptions aren't enabled.
+ * @exception StandardException : throws if the memory could not be locked [debug mode only].
+ */
+bool ECL_PUBLIC set_process_realtime(const unsigned long &heap_reserve = 0, const unsigned long &stack_reserve = 0);
+
 /*****************************************************************************
 ** Namespace
 *****************************************************************************/
@@ -175,6 +240,7 @@ inline StandardException ECL_LOCAL throwPriorityException(const char* loc ) {
         case ( ESRCH  ) : return StandardException(loc, ecl::InvalidInputError, "The process specified could not be found.");
         case ( EPERM  ) : return StandardException(loc, ecl::PermissionsError, "The caller does not have the appropriate privileges for realtime scheduling (http://snorriheim.dnsdojo.com/doku/doku.php/en:linux:admin:priorities).");
         case ( EACCES ) : return StandardException(loc, ecl::PermissionsError, "The caller does not have the appropriate privileges for elevating the process priority by reducing the niceness value (http://snorriheim.dnsdojo.com/doku/doku.php/en:linux:admin:priorities).");
+        case ( ENOMEM ) : return StandardException(loc, ecl::MemoryError, "The memory lock limit (RLIMIT_MEMLOCK) was exceeded or not enough memory could be locked.");
 		default         :
 		{
 			std::ostringstream ostream;
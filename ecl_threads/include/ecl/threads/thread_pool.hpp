@@ -0,0 +1,214 @@
+/**
+ * @file /include/ecl/threads/thread_pool.hpp
+ *
+ * @brief Pool of long lived worker threads.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_THREADS_THREAD_POOL_HPP_
+#define ECL_THREADS_THREAD_POOL_HPP_
+
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#include <ecl/config/ecl.hpp>
+#if defined(ECL_HAS_POSIX_THREADS)
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <atomic>
+#include <vector>
+#include <ecl/config/macros.hpp>
+#include <ecl/concepts/nullary_function.hpp>
+#include <ecl/utilities/function_objects.hpp>
+#include <ecl/utilities/references.hpp>
+#include <ecl/utilities/void.hpp>
+#include "condition_variable.hpp"
+#include "mpmc_queue.hpp"
+#include "mutex.hpp"
+#include "priority.hpp"
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+namespace threads {
+
+/*****************************************************************************
+** Interface [PoolTask]
+*****************************************************************************/
+/**
+ * @brief Abstract parent for the type erased pool tasks.
+ */
+class ECL_LOCAL PoolTaskBase {
+public:
+	virtual ~PoolTaskBase() {}
+	virtual void run() = 0;
+};
+
+/**
+ * @brief Pool task wrapping a copy of a nullary function object.
+ *
+ * @tparam F : the nullary function object type.
+ * @tparam IsReferenceWrapper : flag indicating if the function object is a reference wrapper.
+ */
+template <typename F, bool IsReferenceWrapper = false>
+class ECL_LOCAL PoolTask : public PoolTaskBase {
+public:
+	PoolTask(const F &f) : function(f) {
+		ecl_compile_time_concept_check(ecl::NullaryFunction<F>);
+	}
+	virtual ~PoolTask() {}
+	void run() { function(); }
+private:
+	F function;
+};
+
+/**
+ * @brief Pool task wrapping a reference to a nullary function object.
+ *
+ * @tparam F : the reference wrapper type.
+ */
+template <typename F>
+class ECL_LOCAL PoolTask<F, true> : public PoolTaskBase {
+public:
+	PoolTask(const F &f) : function(f.reference()) {
+		ecl_compile_time_concept_check(ecl::NullaryFunction<typename F::type>);
+	}
+	virtual ~PoolTask() {}
+	void run() { function(); }
+private:
+	typename F::type &function;
+};
+
+} // namespace threads
+
+/*****************************************************************************
+** Interface [ThreadPool]
+*****************************************************************************/
+/**
+ * @brief Executes nullary function objects on a set of long lived workers.
+ *
+ * Creating an ecl::Thread per short piece of work pays for pthread_create,
+ * the stack allocation and the scheduler setup every time. The pool keeps
+ * its workers alive and just hands them tasks.
+ *
+ * Tasks accept the same callables as ecl::Thread - free functions, member
+ * functions, nullary function objects (ecl_utilities' function_objects.hpp)
+ * and ecl::ref() wrapped function objects.
+ *
+ * Scheduling is work stealing. Every worker owns a lock-free deque and
+ * tasks submitted from within a worker land on its own deque. Tasks
+ * submitted from other threads go through a shared mpmc queue. Idle
+ * workers steal from the top of their siblings' deques before sleeping.
+ *
+ * @code
+ * ThreadPool pool(4, RealTimePriority2);
+ * for ( unsigned int i = 0; i < jobs.size(); ++i ) {
+ *     pool.submit(generateFunctionObject(&Job::run, jobs[i]));
+ * }
+ * pool.wait(); // block until they're all done
+ * @endcode
+ *
+ * The destructor waits for all outstanding tasks before joining the workers.
+ *
+ * @sa Thread, Priority.
+ */
+class ECL_PUBLIC ThreadPool {
+public:
+	static const unsigned int queue_size = 1024; /**< @brief Capacity of the shared and per-worker task queues. **/
+
+	/**
+	 * @brief Spawn the worker threads.
+	 *
+	 * @param number_of_workers : number of worker threads to spawn.
+	 * @param priority : priority for the workers (including the real time levels).
+	 * @param stack_size : stack size for each worker (-1 for the system default).
+	 * @param cpu_affinity : bitmask of cpus (bit i = cpu i) the workers may run on, 0 for no restriction [linux only].
+	 *
+	 * @exception StandardException : throws if a worker could not be spawned [debug mode only].
+	 */
+	ThreadPool(const unsigned int &number_of_workers,
+	           const Priority &priority = DefaultPriority,
+	           const long &stack_size = -1,
+	           const unsigned long &cpu_affinity = 0);
+	virtual ~ThreadPool();
+
+	/**
+	 * @brief Queue a free function for execution.
+	 *
+	 * @param function : the function to execute.
+	 */
+	void submit(VoidFunction function);
+	/**
+	 * @brief Queue a member function for execution.
+	 *
+	 * The class instance must outlive the task.
+	 *
+	 * @param function : the member function to execute.
+	 * @param c : the class instance to execute it on.
+	 */
+	template <typename C>
+	void submit(void (C::*function)(), C &c);
+	/**
+	 * @brief Queue a nullary function object (or a reference wrapper to one).
+	 *
+	 * @param function : the function object (copied unless reference wrapped).
+	 */
+	template <typename F>
+	void submit(const F &function);
+
+	/**
+	 * @brief Block until every submitted task has finished.
+	 */
+	void wait();
+
+	unsigned int size() const { return workers.size(); } /**< @brief Number of workers. **/
+	unsigned int pending() const { return number_pending.load(std::memory_order_relaxed); } /**< @brief Tasks submitted but not yet finished. **/
+
+private:
+	class Worker;
+
+	void enqueue(threads::PoolTaskBase *task);
+	bool findTask(Worker *worker, threads::PoolTaskBase *&task);
+	void execute(threads::PoolTaskBase *task);
+	void work(Worker *worker);
+
+	static thread_local Worker *current_worker; /**< Lets tasks submitted from within a worker go onto its own deque. **/
+
+	std::vector<Worker*> workers;
+	MpmcQueue<threads::PoolTaskBase*, queue_size> shared_tasks;
+	std::atomic<unsigned int> number_pending;
+	std::atomic<unsigned int> number_sleeping;
+	std::atomic<bool> shutdown_requested;
+	Mutex mutex;
+	ConditionVariable work_available;
+	ConditionVariable all_done;
+};
+
+/*****************************************************************************
+** Template Implementation
+*****************************************************************************/
+
+template <typename C>
+void ThreadPool::submit(void (C::*function)(), C &c) {
+	enqueue(new threads::PoolTask< BoundNullaryMemberFunction<C,void> >(generateFunctionObject(function, c)));
+}
+
+template <typename F>
+void ThreadPool::submit(const F &function) {
+	enqueue(new threads::PoolTask<F, is_reference_wrapper<F>::value>(function));
+}
+
+} // namespace ecl
+
+#endif /* ECL_HAS_POSIX_THREADS */
+#endif /* ECL_THREADS_THREAD_POOL_HPP_ */
@@ -53,8 +53,24 @@ public:
 	virtual ~ThreadTaskBase() {};
 
 protected:
-	ThreadTaskBase(const Priority& priority) : priority_level(priority) {}; /**< This constructor is only enabled for child ThreadTask classes. **/
+	ThreadTaskBase(const Priority& priority, const unsigned long &cpu_affinity, const SchedulingPolicy &policy, const long &prefault_size) :
+		priority_level(priority), cpu_affinity(cpu_affinity), policy(policy), prefault_size(prefault_size) {}; /**< This constructor is only enabled for child ThreadTask classes. **/
+	/**
+	 * @brief Configures the calling (newly spawned) thread before the task runs.
+	 */
+	void configure() {
+	    ecl::set_priority(priority_level, policy);
+	    if ( cpu_affinity != 0 ) {
+	        ecl::set_cpu_affinity(cpu_affinity);
+	    }
+	    if ( prefault_size > 0 ) {
+	        ecl::prefault_stack(prefault_size);
+	    }
+	}
 	ecl::Priority priority_level;
+	unsigned long cpu_affinity;
+	ecl::SchedulingPolicy policy;
+	long prefault_size;
 };
 /**
  * @brief The thread task template family.
@@ -75,8 +91,12 @@ public:
 	 *
 	 * @param f : the nullary function.
 	 * @param priority : the priority level for the thread task.
+	 * @param cpu_affinity : bitmask of cpus the thread may run on (0 for no restriction).
+	 * @param policy : scheduling policy for the real time priority levels.
+	 * @param prefault_size : no. of bytes of stack to prefault (0 to skip).
 	 */
-	ThreadTask(const F &f, const Priority &priority) : ThreadTaskBase(priority), function(f) {
+	ThreadTask(const F &f, const Priority &priority, const unsigned long &cpu_affinity = 0, const SchedulingPolicy &policy = RoundRobinScheduling, const long &prefault_size = 0) :
+		ThreadTaskBase(priority, cpu_affinity, policy, prefault_size), function(f) {
 		ecl_compile_time_concept_check(ecl::NullaryFunction<F>);
 	};
 	virtual ~ThreadTask() {}; /**< @brief This ensures any children objects are deleted correctly. **/
@@ -93,7 +113,7 @@ public:
 	 */
 	static void* EntryPoint(void *ptr_this) {
 	    ThreadTask< F, false > *ptr = static_cast< ThreadTask< F, false > * >(ptr_this);
-	    ecl::set_priority(ptr->priority_level);
+	    ptr->configure();
 	    (ptr->function)();
 	    delete ptr;
 	    ptr_this = NULL;
@@ -123,8 +143,12 @@ public:
 	 *
 	 * @param f : the nullary function.
 	 * @param priority : the priority level for the thread task.
+	 * @param cpu_affinity : bitmask of cpus the thread may run on (0 for no restriction).
+	 * @param policy : scheduling policy for the real time priority levels.
+	 * @param prefault_size : no. of bytes of stack to prefault (0 to skip).
 	 */
-	ThreadTask(const F &f, const Priority &priority) : ThreadTaskBase(priority), function(f.reference()) {
+	ThreadTask(const F &f, const Priority &priority, const unsigned long &cpu_affinity = 0, const SchedulingPolicy &policy = RoundRobinScheduling, const long &prefault_size = 0) :
+		ThreadTaskBase(priority, cpu_affinity, policy, prefault_size), function(f.reference()) {
 		ecl_compile_time_concept_check(ecl::NullaryFunction< typename F::type>);
 	};
 	virtual ~ThreadTask() {}; /**< @brief This ensures any children objects are deleted correctly. **/
@@ -141,7 +165,7 @@ public:
 	 */
 	static void* EntryPoint(void *ptr_this) {
 	    ThreadTask< F, true > *ptr = static_cast< ThreadTask< F, true > * >(ptr_this);
-	    ecl::set_priority(ptr->priority_level);
+	    ptr->configure();
 	    (ptr->function)();
 	    delete ptr;
 	    ptr_this = NULL;
@@ -263,19 +287,25 @@ public:
 	 * @param function : a void function pointer, void (*)().
 	 * @param priority : set the priority level for the thread.
 	 * @param stack_size : no. of bytes to allocate on the stack (default is to use the system value, usually 8k).
+	 * @param cpu_affinity : bitmask of cpus (bit i = cpu i) the thread may run on, 0 for no restriction [linux only].
+	 * @param policy : scheduling policy used for the real time priority levels.
+	 * @param prefault_size : no. of bytes of stack to touch before running the function (0 to skip).
 	 * @exception StandardException : throws if thread creation fails [debug mode only].
 	 */
-	Thread(VoidFunction function, const Priority &priority = DefaultPriority, const long &stack_size = -1 );
+	Thread(VoidFunction function, const Priority &priority = DefaultPriority, const long &stack_size = -1, const unsigned long &cpu_affinity = 0, const SchedulingPolicy &policy = RoundRobinScheduling, const long &prefault_size = 0);
 	/**
 	 * @brief Starts the thread if not already started.
 	 *
 	 * @param function : a void function pointer, void (*)().
 	 * @param priority : set the priority level for the thread.
 	 * @param stack_size : no. of bytes to allocate on the stack (default is to use the system value, usually 8k).
+	 * @param cpu_affinity : bitmask of cpus (bit i = cpu i) the thread may run on, 0 for no restriction [linux only].
+	 * @param policy : scheduling policy used for the real time priority levels.
+	 * @param prefault_size : no. of bytes of stack to touch before running the function (0 to skip).
 	 * @exception StandardException : throws if thread creation fails [debug mode only].
 	 * @return Error : error result, fallback for when exceptions aren't available.
 	 */
-	Error start(VoidFunction function, const Priority &priority = DefaultPriority, const long &stack_size = -1 );
+	Error start(VoidFunction function, const Priority &priority = DefaultPriority, const long &stack_size = -1, const unsigned long &cpu_affinity = 0, const SchedulingPolicy &policy = RoundRobinScheduling, const long &prefault_size = 0);
 	/**
 	 * @brief Convenience method that starts a new thread utilising a void member function.
 	 *
@@ -297,10 +327,13 @@ public:
 	 * @param c : the member function's class instance.
 	 * @param priority : set the priority level for the thread.
 	 * @param stack_size : no. of bytes to allocate on the stack (default is to use the system value, usually 8k).
+	 * @param cpu_affinity : bitmask of cpus (bit i = cpu i) the thread may run on, 0 for no restriction [linux only].
+	 * @param policy : scheduling policy used for the real time priority levels.
+	 * @param prefault_size : no. of bytes of stack to touch before running the function (0 to skip).
 	 * @exception StandardException : throws if thread creation fails [debug mode only].
 	 */
 	template <typename C>
-	Thread(void (C::*function)(), C &c, const Priority &priority = DefaultPriority,  const long &stack_size = -1 );
+	Thread(void (C::*function)(), C &c, const Priority &priority = DefaultPriority,  const long &stack_size = -1, const unsigned long &cpu_affinity = 0, const SchedulingPolicy &policy = RoundRobinScheduling, const long &prefault_size = 0);
 	/**
 	 * @brief Starts the thread if not already started.
 	 *
@@ -308,11 +341,14 @@ public:
 	 * @param c : the member function's class instance.
 	 * @param priority : set the priority level for the thread.
 	 * @param stack_size : no. of bytes to allocate on the stack (default is to use the system value, usually 8k).
+	 * @param cpu_affinity : bitmask of cpus (bit i = cpu i) the thread may run on, 0 for no restriction [linux only].
+	 * @param policy : scheduling policy used for the real time priority levels.
+	 * @param prefault_size : no. of bytes of stack to touch before running the function (0 to skip).
 	 * @exception StandardException : throws if thread creation fails [debug mode only].
 	 * @return Error : error result, fallback for when exceptions aren't available.
 	 */
 	template <typename C>
-	Error start(void (C::*function)(), C &c, const Priority &priority = DefaultPriority,  const long &stack_size = -1 );
+	Error start(void (C::*function)(), C &c, const Priority &priority = DefaultPriority,  const long &stack_size = -1, const unsigned long &cpu_affinity = 0, const SchedulingPolicy &policy = RoundRobinScheduling, const long &prefault_size = 0);
 
 	/**
 	 * @brief Starts a new thread utilising a nullary function object.
@@ -350,21 +386,27 @@ public:
 	 * @param function : the nullary function object.
 	 * @param priority : set the priority level for the thread.
 	 * @param stack_size : no. of bytes to allocate on the stack (default is to use the system value, usually 8k).
+	 * @param cpu_affinity : bitmask of cpus (bit i = cpu i) the thread may run on, 0 for no restriction [linux only].
+	 * @param policy : scheduling policy used for the real time priority levels.
+	 * @param prefault_size : no. of bytes of stack to touch before running the function (0 to skip).
 	 * @exception StandardException : throws if thread creation fails [debug mode only].
 	 */
 	template <typename F>
-	Thread(const F &function, const Priority &priority = DefaultPriority,  const long &stack_size = -1 );
+	Thread(const F &function, const Priority &priority = DefaultPriority,  const long &stack_size = -1, const unsigned long &cpu_affinity = 0, const SchedulingPolicy &policy = RoundRobinScheduling, const long &prefault_size = 0);
 	/**
 	 * @brief Starts a new thread utilising a nullary function object.
 	 *
 	 * @param function : the nullary function object.
 	 * @param priority : set the priority level for the thread.
 	 * @param stack_size : no. of bytes to allocate on the stack (default is to use the system value, usually 8k).
+	 * @param cpu_affinity : bitmask of cpus (bit i = cpu i) the thread may run on, 0 for no restriction [linux only].
+	 * @param policy : scheduling policy used for the real time priority levels.
+	 * @param prefault_size : no. of bytes of stack to touch before running the function (0 to skip).
 	 * @exception StandardException : throws if thread creation fails [debug mode only].
 	 * @return Error : error result, fallback for when exceptions aren't available.
 	 */
 	template <typename F>
-	Error start(const F &function, const Priority &priority = DefaultPriority,  const long &stack_size = -1 );
+	Error start(const F &function, const Priority &priority = DefaultPriority,  const long &stack_size = -1, const unsigned long &cpu_affinity = 0, const SchedulingPolicy &policy = RoundRobinScheduling, const long &prefault_size = 0);
 
 	/**
 	 * @brief Cleans up the resources allocated to the thread.
@@ -433,26 +475,26 @@ private:
 *****************************************************************************/
 
 template <typename C>
-Thread::Thread(void (C::*function)(), C &c, const Priority &priority, const long &stack_size) :
+Thread::Thread(void (C::*function)(), C &c, const Priority &priority, const long &stack_size, const unsigned long &cpu_affinity, const SchedulingPolicy &policy, const long &prefault_size) :
 	thread_task(NULL),
 	has_started(false),
 	join_requested(false)
 {
-	start<C>(function, c, priority, stack_size);
+	start<C>(function, c, priority, stack_size, cpu_affinity, policy, prefault_size);
 
 }
 
 template <typename F>
-Thread::Thread(const F &function, const Priority &priority, const long &stack_size) :
+Thread::Thread(const F &function, const Priority &priority, const long &stack_size, const unsigned long &cpu_affinity, const SchedulingPolicy &policy, const long &prefault_size) :
 	thread_task(NULL),
 	has_started(false),
 	join_requested(false)
 {
-	start<F>(function, priority, stack_size);
+	start<F>(function, priority, stack_size, cpu_affinity, policy, prefault_size);
 }
 
 template <typename C>
-Error Thread::start(void (C::*function)(), C &c, const Priority &priority, const long &stack_size)
+Error Thread::start(void (C::*function)(), C &c, const Priority &priority, const long &stack_size, const unsigned long &cpu_affinity, const SchedulingPolicy &policy, const long &prefault_size)
 {
 	if ( has_started ) {
 		ecl_debug_throw(StandardException(LOC,BusyError,"The thread has already been started."));
@@ -461,7 +503,7 @@ Error Thread::start(void (C::*function)(), C &c, const Priority &priority, const
 		has_started = true;
 	}
 	initialise(stack_size);
-	thread_task = new threads::ThreadTask< BoundNullaryMemberFunction<C,void> >(generateFunctionObject( function, c ), priority);
+	thread_task = new threads::ThreadTask< BoundNullaryMemberFunction<C,void> >(generateFunctionObject( function, c ), priority, cpu_affinity, policy, prefault_size);
     int result = pthread_create(&(this->thread_handle), &(this->attrs), threads::ThreadTask< BoundNullaryMemberFunction<C,void> >::EntryPoint, thread_task);
 	pthread_attr_destroy(&attrs);
     if ( result != 0 ) {
@@ -474,7 +516,7 @@ Error Thread::start(void (C::*function)(), C &c, const Priority &priority, const
 }
 
 template <typename F>
-Error Thread::start(const F &function, const Priority &priority, const long &stack_size)
+Error Thread::start(const F &function, const Priority &priority, const long &stack_size, const unsigned long &cpu_affinity, const SchedulingPolicy &policy, const long &prefault_size)
 {
 	if ( has_started ) {
 		ecl_debug_throw(StandardException(LOC,BusyError,"The thread has already been started."));
@@ -483,7 +525,7 @@ Error Thread::start(const F &function, const Priority &priority, const long &sta
 		has_started = true;
 	}
 	initialise(stack_size);
-	thread_task = new threads::ThreadTask<F, is_reference_wrapper<F>::value >(function, priority);
+	thread_task = new threads::ThreadTask<F, is_reference_wrapper<F>::value >(function, priority, cpu_affinity, policy, prefault_size);
     int result = pthread_create(&(this->thread_handle), &(this->attrs), threads::ThreadTask<F, is_reference_wrapper<F>::value>::EntryPoint, thread_task);
 	pthread_attr_destroy(&attrs);
     if ( result != 0 ) {
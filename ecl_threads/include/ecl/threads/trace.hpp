@@ -0,0 +1,309 @@
+/**
+ * @file /include/ecl/threads/trace.hpp
+ *
+ * @brief Scoped tracing of threads to a chrome trace timeline.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_THREADS_TRACE_HPP_
+#define ECL_THREADS_TRACE_HPP_
+
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#include <ecl/config/ecl.hpp>
+#if defined(ECL_HAS_POSIX_THREADS)
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <atomic>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <ecl/config/macros.hpp>
+#include <ecl/time/cycle_clock.hpp>
+#include <ecl/time/duration.hpp>
+#include "condition_variable.hpp"
+#include "mutex.hpp"
+#include "priority.hpp"
+#include "thread.hpp"
+
+/*****************************************************************************
+** Macros
+*****************************************************************************/
+/*
+ * The tracing macros only do anything if ECL_TRACING_ENABLED is defined when
+ * compiling the code using them, otherwise they compile down to nothing.
+ */
+#if defined(ECL_TRACING_ENABLED)
+  #define ECL_TRACE_CONCATENATE_IMPL(a, b) a##b
+  #define ECL_TRACE_CONCATENATE(a, b) ECL_TRACE_CONCATENATE_IMPL(a, b)
+  /**
+   * @brief Trace the enclosing scope (name must be a string literal).
+   */
+  #define ECL_TRACE_SCOPE(name) ecl::TraceScope ECL_TRACE_CONCATENATE(ecl_trace_scope_, __LINE__)(name)
+  #define ECL_TRACE_BEGIN(name) ecl::Tracer::begin(name)      /**< @brief Start of a traced section (string literal). **/
+  #define ECL_TRACE_END(name) ecl::Tracer::end(name)          /**< @brief End of a traced section (string literal). **/
+  #define ECL_TRACE_INSTANT(name) ecl::Tracer::instant(name)  /**< @brief A point in time (string literal). **/
+  #define ECL_TRACE_THREAD(name) ecl::Tracer::nameThread(name) /**< @brief Label the calling thread on the timeline. **/
+#else
+  #define ECL_TRACE_SCOPE(name)
+  #define ECL_TRACE_BEGIN(name)
+  #define ECL_TRACE_END(name)
+  #define ECL_TRACE_INSTANT(name)
+  #define ECL_TRACE_THREAD(name)
+#endif
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+namespace threads {
+
+/*****************************************************************************
+** Interface [TraceEvent]
+*****************************************************************************/
+/**
+ * @brief A single event as it is stored in a thread's buffer.
+ */
+struct TraceEvent {
+	enum Type {
+		Begin,
+		End,
+		Instant
+	};
+	const char *name; // string literal, never copied
+	uint64_t ticks;   // cycle clock
+	Type type;
+};
+
+/*****************************************************************************
+** Interface [TraceBuffer]
+*****************************************************************************/
+/**
+ * @brief Lock-free ring of trace events for a single thread.
+ *
+ * Single producer (the owning thread), single consumer (whoever is
+ * collecting). When full, new events are dropped and counted.
+ */
+class ECL_PUBLIC TraceBuffer {
+public:
+	TraceBuffer(const unsigned int &capacity);
+
+	void push(const char *name, const TraceEvent::Type &type) {
+		const uint64_t head = write_index.load(std::memory_order_relaxed);
+		if ( head - read_index.load(std::memory_order_acquire) > mask ) {
+			dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		TraceEvent &event = events[head & mask];
+		event.name = name;
+		event.ticks = CycleClock::ticks();
+		event.type = type;
+		write_index.store(head + 1, std::memory_order_release);
+	}
+	/**
+	 * @brief Move all events into the vector (consumer side).
+	 */
+	void drain(std::vector<TraceEvent> &drained);
+
+	// guarded by the tracer's registry mutex
+	std::string name;
+	Priority priority;
+	long thread_id;
+	unsigned int renamed;     // bumped on every rename, the metadata is...
+	unsigned int described;   // ...rewritten when this falls behind
+	bool retired;             // owning thread has exited
+
+	std::atomic<unsigned long> dropped;
+
+private:
+	std::vector<TraceEvent> events;
+	uint64_t mask;
+	std::atomic<uint64_t> write_index;
+	std::atomic<uint64_t> read_index;
+};
+
+} // namespace threads
+
+/*****************************************************************************
+** Interface [Tracer]
+*****************************************************************************/
+/**
+ * @brief Collects scoped begin/end events from many threads into one timeline.
+ *
+ * Each thread records into its own lock-free buffer (registered on its first
+ * event), so recording is a couple of relaxed stores and a cycle counter
+ * read - cheap enough to leave in control and driver loops. Every thread is
+ * tagged with its name and its ecl::Priority, so the timeline shows which
+ * real time threads are using up the budget.
+ *
+ * The events are written out in the chrome trace event format (json), load
+ * it with chrome://tracing or https://ui.perfetto.dev. Either write them all
+ * at once with write(), or have a TraceFlusher drain the buffers to a file in
+ * the background.
+ *
+ * The recording is usually done via the macros, which disappear entirely
+ * unless ECL_TRACING_ENABLED is defined. Names must be string literals
+ * (or otherwise outlive the tracer), only their pointers are stored.
+ *
+ * <b>Usage:</b>
+ *
+ * @code
+ * // compile with -DECL_TRACING_ENABLED
+ * void ControlLoop::run() {
+ *   ECL_TRACE_THREAD("control");
+ *   while ( running ) {
+ *     {
+ *       ECL_TRACE_SCOPE("sense");
+ *       sense();
+ *     }
+ *     ECL_TRACE_SCOPE("act");
+ *     act();
+ *   }
+ * }
+ *
+ * // main, anytime later
+ * ecl::Tracer::write("control.json");
+ * @endcode
+ *
+ * @sa TraceFlusher, TraceScope, CycleClock.
+ */
+class ECL_PUBLIC Tracer {
+public:
+	static void begin(const char *name) { buffer().push(name, threads::TraceEvent::Begin); }
+	static void end(const char *name) { buffer().push(name, threads::TraceEvent::End); }
+	static void instant(const char *name) { buffer().push(name, threads::TraceEvent::Instant); }
+	/**
+	 * @brief Name the calling thread (and refresh its priority tag).
+	 */
+	static void nameThread(const std::string &name);
+	/**
+	 * @brief Events each thread's buffer can hold until drained.
+	 *
+	 * Only applies to threads that haven't recorded anything yet.
+	 *
+	 * @param capacity : events, rounded up to a power of two (default 16384).
+	 */
+	static void bufferCapacity(const unsigned int &capacity);
+	/**
+	 * @brief Events dropped on full buffers, summed over all threads.
+	 */
+	static unsigned long dropped();
+
+	/*********************
+	** Output
+	**********************/
+	/**
+	 * @brief Drain every buffer into a complete chrome trace json document.
+	 *
+	 * @param ostream : stream to write to.
+	 */
+	static void write(std::ostream &ostream);
+	/**
+	 * @brief Drain every buffer into a chrome trace json file.
+	 *
+	 * @param file_name : file to (over)write.
+	 * @return bool : false if the file couldn't be opened.
+	 */
+	static bool write(const std::string &file_name);
+	/**
+	 * @brief Drain every buffer, writing its events as a comma separated json fragment.
+	 *
+	 * Building block for streaming traces (as TraceFlusher does). Thread
+	 * metadata is written once per thread (and again if renamed).
+	 *
+	 * @param ostream : stream to write to.
+	 * @param first : true if nothing has been written to the array yet, updated.
+	 */
+	static void writeEvents(std::ostream &ostream, bool &first);
+
+private:
+	static threads::TraceBuffer& buffer() {
+		threads::TraceBuffer *current = thread_buffer;
+		return ( current != NULL ) ? *current : registerThread();
+	}
+	static threads::TraceBuffer& registerThread();
+
+	static thread_local threads::TraceBuffer *thread_buffer;
+};
+
+/*****************************************************************************
+** Interface [TraceScope]
+*****************************************************************************/
+/**
+ * @brief Traces the lifetime of a scope (RAII), see ECL_TRACE_SCOPE.
+ */
+class ECL_PUBLIC TraceScope {
+public:
+	TraceScope(const char *name) : name(name) { Tracer::begin(name); }
+	~TraceScope() { Tracer::end(name); }
+private:
+	const char *name;
+};
+
+/*****************************************************************************
+** Interface [TraceFlusher]
+*****************************************************************************/
+/**
+ * @brief Streams the tracer's events to a chrome trace file in the background.
+ *
+ * Wakes up periodically and drains every thread's buffer into the file, so
+ * long runs don't overflow them. The json array is terminated when the
+ * flusher is destroyed (chrome and perfetto both cope with a missing
+ * terminator if the process dies first).
+ *
+ * <b>Usage:</b>
+ *
+ * @code
+ * int main() {
+ *   ecl::TraceFlusher flusher("trace.json");
+ *   // spin up the traced threads
+ * }
+ * @endcode
+ */
+class ECL_PUBLIC TraceFlusher {
+public:
+	/**
+	 * @brief Open the file and start the background thread.
+	 *
+	 * @param file_name : file to (over)write.
+	 * @param period : how often to drain the buffers.
+	 * @exception StandardException : throws if the file couldn't be opened.
+	 */
+	TraceFlusher(const std::string &file_name, const Duration &period = Duration(0,100000000));
+	/**
+	 * @brief Drain whatever is left and close the file.
+	 */
+	~TraceFlusher();
+	/**
+	 * @brief Drain the buffers to the file now.
+	 */
+	void flush();
+
+private:
+	void run();
+
+	std::ofstream file;
+	Duration period;
+	bool first;
+	bool shutdown;
+	Mutex mutex;
+	ConditionVariable condition;
+	Thread thread;
+};
+
+} // namespace ecl
+
+#endif /* ECL_HAS_POSIX_THREADS */
+#endif /* ECL_THREADS_TRACE_HPP_ */
@@ -0,0 +1,149 @@
+/**
+ * @file /include/ecl/threads/work_stealing_deque.hpp
+ *
+ * @brief Fixed size, lock-free work stealing deque.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_THREADS_WORK_STEALING_DEQUE_HPP_
+#define ECL_THREADS_WORK_STEALING_DEQUE_HPP_
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <atomic>
+#include <cstddef>
+#include <ecl/config/macros.hpp>
+#include <ecl/errors/compile_time_assert.hpp>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+namespace threads {
+
+/*****************************************************************************
+** Interface [WorkStealingDeque]
+*****************************************************************************/
+/**
+ * @brief Chase-Lev work stealing deque of fixed capacity.
+ *
+ * The owning thread pushes and pops at the bottom (lifo, cache friendly
+ * for recursively spawned work) while any other thread may steal from the
+ * top (fifo). This is the fixed capacity variant of the algorithm as
+ * formulated for the C11 memory model by Le, Pop, Cohen and Zappa Nardelli
+ * (PPoPP'13) - it never reallocates, push() just fails when full.
+ *
+ * - push(), pop() : owner thread only.
+ * - steal() : any thread.
+ *
+ * @tparam Type : element type, must be trivially copyable (typically a pointer).
+ * @tparam Size : capacity, must be a power of two.
+ */
+template <typename Type, std::size_t Size>
+class ECL_PUBLIC WorkStealingDeque {
+public:
+	static const std::size_t cache_line_size = 64; /**< @brief Padding used to separate the indices. **/
+
+	WorkStealingDeque() : top(0), bottom(0) {
+		ecl_compile_time_assert( (Size >= 2) && ((Size & (Size - 1)) == 0) );
+	}
+
+	/**
+	 * @brief Push onto the bottom [owner only].
+	 *
+	 * @param datum : element to push.
+	 * @return bool : false if the deque is full.
+	 */
+	bool push(const Type &datum) {
+		const long b = bottom.load(std::memory_order_relaxed);
+		const long t = top.load(std::memory_order_acquire);
+		if ( b - t >= static_cast<long>(Size) ) {
+			return false;
+		}
+		buffer[b & mask].store(datum, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		bottom.store(b + 1, std::memory_order_relaxed);
+		return true;
+	}
+	/**
+	 * @brief Pop from the bottom [owner only].
+	 *
+	 * @param datum : storage for the popped element.
+	 * @return bool : false if the deque was empty (or the last element was stolen).
+	 */
+	bool pop(Type &datum) {
+		const long b = bottom.load(std::memory_order_relaxed) - 1;
+		bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		long t = top.load(std::memory_order_relaxed);
+		bool result = false;
+		if ( t <= b ) {
+			datum = buffer[b & mask].load(std::memory_order_relaxed);
+			result = true;
+			if ( t == b ) {
+				// last element, race any thieves for it
+				if ( !top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed) ) {
+					result = false;
+				}
+				bottom.store(b + 1, std::memory_order_relaxed);
+			}
+		} else {
+			bottom.store(b + 1, std::memory_order_relaxed);
+		}
+		return result;
+	}
+	/**
+	 * @brief Steal from the top [any thread].
+	 *
+	 * @param datum : storage for the stolen element.
+	 * @return bool : false if empty or it lost a race with another thread.
+	 */
+	bool steal(Type &datum) {
+		long t = top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const long b = bottom.load(std::memory_order_acquire);
+		if ( t < b ) {
+			Type candidate = buffer[t & mask].load(std::memory_order_relaxed);
+			if ( top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed) ) {
+				datum = candidate;
+				return true;
+			}
+		}
+		return false;
+	}
+	/**
+	 * @brief Approximate number of elements (snapshot only).
+	 */
+	unsigned int size() const {
+		const long b = bottom.load(std::memory_order_relaxed);
+		const long t = top.load(std::memory_order_relaxed);
+		return ( b > t ) ? static_cast<unsigned int>(b - t) : 0;
+	}
+	bool empty() const { return size() == 0; }
+
+private:
+	static const long mask = static_cast<long>(Size) - 1;
+
+	// padding rather than alignas so heap allocation needs no over-aligned new
+	char padding_front[cache_line_size];
+	std::atomic<long> top;
+	char padding_top[cache_line_size];
+	std::atomic<long> bottom;
+	char padding_bottom[cache_line_size];
+	std::atomic<Type> buffer[Size];
+};
+
+template <typename Type, std::size_t Size>
+const long WorkStealingDeque<Type,Size>::mask;
+
+} // namespace threads
+} // namespace ecl
+
+#endif /* ECL_THREADS_WORK_STEALING_DEQUE_HPP_ */
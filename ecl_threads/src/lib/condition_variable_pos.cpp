@@ -0,0 +1,96 @@
+/**
+ * @file /src/lib/condition_variable_pos.cpp
+ *
+ * @brief Posix condition variable implementation.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+ ** Platform Check
+ *****************************************************************************/
+
+#include <ecl/config/ecl.hpp>
+#if defined(ECL_IS_POSIX)
+
+/*****************************************************************************
+ ** Includes
+ *****************************************************************************/
+
+#include <errno.h>
+#include <time.h>
+#include <ecl/exceptions/standard_exception.hpp>
+#include "../../include/ecl/threads/condition_variable.hpp"
+
+/*****************************************************************************
+ ** Namespaces
+ *****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+ * ConditionVariable Class Methods
+ *****************************************************************************/
+
+ConditionVariable::ConditionVariable()
+{
+  pthread_condattr_t attr;
+  int result = pthread_condattr_init(&attr);
+  ecl_assert_throw(result == 0, StandardException(LOC, ConfigurationError, "Failed to initialise the condition variable attributes."));
+  #if !defined(ECL_IS_APPLE)
+    // timed waits are measured against the monotonic clock
+    result = pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    ecl_assert_throw(result == 0, StandardException(LOC, ConfigurationError, "Failed to set the condition variable clock."));
+  #endif
+  result = pthread_cond_init(&condition, &attr);
+  ecl_assert_throw(result == 0, StandardException(LOC, ConstructorError, "Failed to initialise the condition variable."));
+  pthread_condattr_destroy(&attr);
+  (void) result;
+}
+
+ConditionVariable::~ConditionVariable()
+{
+  pthread_cond_destroy(&condition);
+}
+
+void ConditionVariable::wait(Mutex &mutex)
+{
+  int result = pthread_cond_wait(&condition, &mutex.rawType());
+  ecl_assert_throw(result == 0, StandardException(LOC, UnknownError, "Failed to wait on the condition variable."));
+  (void) result;
+}
+
+bool ConditionVariable::wait(Mutex &mutex, const Duration &duration)
+{
+  timespec deadline;
+  #if defined(ECL_IS_APPLE)
+    clock_gettime(CLOCK_REALTIME, &deadline);
+  #else
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+  #endif
+  deadline.tv_sec += duration.sec();
+  deadline.tv_nsec += duration.nsec();
+  if ( deadline.tv_nsec >= 1000000000L ) {
+    deadline.tv_sec += 1;
+    deadline.tv_nsec -= 1000000000L;
+  }
+  int result = pthread_cond_timedwait(&condition, &mutex.rawType(), &deadline);
+  if ( result == ETIMEDOUT ) {
+    return false;
+  }
+  ecl_assert_throw(result == 0, StandardException(LOC, UnknownError, "Failed to wait on the condition variable."));
+  return true;
+}
+
+void ConditionVariable::notify_one()
+{
+  pthread_cond_signal(&condition);
+}
+
+void ConditionVariable::notify_all()
+{
+  pthread_cond_broadcast(&condition);
+}
+
+} // namespace ecl
+
+#endif /* ECL_IS_POSIX */
@@ -17,7 +17,15 @@
 *****************************************************************************/
 
 #include <iostream>
+#include <alloca.h>
+#include <cstdlib>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
 #include <unistd.h>
+#if defined(__GLIBC__)
+  #include <malloc.h>
+#endif
 #include <ecl/errors/handlers.hpp>
 #include "../../include/ecl/threads/priority_pos.hpp"
 
@@ -38,12 +46,17 @@ using std::ostringstream;
 *****************************************************************************/
 
 bool set_priority(Priority priority_level)
+{
+    return set_priority(priority_level, RoundRobinScheduling);
+}
+
+bool set_priority(Priority priority_level, SchedulingPolicy policy)
 {
     /*************************************************************************
      * Real time priority exception. Run this with absolute priority rather
-     * than the 'niceness' values. We use Round Robin scheduling here, the
-     * alternative is Fifo so we can get some automatic scheduling if we
-     * want it.
+     * than the 'niceness' values. Round Robin scheduling is the default, Fifo
+     * can be requested for threads that should only give up the cpu when
+     * they block.
      *
      * Priority levels usually range from 1 to 99, but we map them virtually
      * to system built-ins just in case. The virtual map only uses a few
@@ -57,14 +70,15 @@ bool set_priority(Priority priority_level)
     *************************************************************************/
     if ( priority_level >= RealTimePriority1 ) {
         #if _POSIX_PRIORITY_SCHEDULING > 0
-            int rr_min = sched_get_priority_min(SCHED_RR); int rr_max = sched_get_priority_max(SCHED_RR);
+            int posix_policy = ( policy == FifoScheduling ) ? SCHED_FIFO : SCHED_RR;
+            int rr_min = sched_get_priority_min(posix_policy); int rr_max = sched_get_priority_max(posix_policy);
             if ( ( rr_min == -1 ) || (rr_max == -1) ) {
-                ecl_throw(StandardException(LOC,NotSupportedError,"The posix SCHED_RR policy is not available on this system [sched_get_priority_min/max]."));
+                ecl_throw(StandardException(LOC,NotSupportedError,"The posix real time policy is not available on this system [sched_get_priority_min/max]."));
                 return false;
             }
             ecl_try {
             	// usually exception will put it into a catch, otherwise we return false if it fails.
-                if ( !threads::set_real_time_priority(SCHED_RR,rr_min+(priority_level - RealTimePriority1)*(rr_max - rr_min)/10) ) {
+                if ( !threads::set_real_time_priority(posix_policy,rr_min+(priority_level - RealTimePriority1)*(rr_max - rr_min)/10) ) {
                 	return false;
                 }
             } ecl_catch(StandardException &e ) {
@@ -135,6 +149,7 @@ Priority get_priority()
                 // We just want the niceness, get it outside of this switch.
                 break;
             }
+            case ( SCHED_FIFO ) :
             case ( SCHED_RR ) : { // Realtime priorities.
                 /******************************************
                 ** Check RealTime Priority Level
@@ -144,10 +159,10 @@ Priority get_priority()
                     ecl_debug_throw(threads::throwPriorityException(LOC));
                     return UnknownPriority;
                 }
-                int rr_min = sched_get_priority_min(SCHED_RR);
-                int rr_max = sched_get_priority_max(SCHED_RR);
+                int rr_min = sched_get_priority_min(scheduler);
+                int rr_max = sched_get_priority_max(scheduler);
                 if ( ( rr_min == -1 ) || (rr_max == -1) ) {
-                    ecl_throw(StandardException(LOC,NotSupportedError,"The posix SCHED_RR policy is not available on this system [sched_get_priority_min/max]."));
+                    ecl_throw(StandardException(LOC,NotSupportedError,"The posix real time policy is not available on this system [sched_get_priority_min/max]."));
                     return UnknownPriority;
                 }
                 if ( param.sched_priority >= rr_min + 3*(rr_max-rr_min)/10 ) {
@@ -161,7 +176,6 @@ Priority get_priority()
                 }
                 break;
             }
-            case ( SCHED_FIFO ) : { return UnknownPriority; } // We dont use this one.
 			#if defined(SCHED_BATCH) // Didn't turn up on an old gcc3 with an arm pax270 board.
             	case ( SCHED_BATCH ) : { return UnknownPriority; } // We dont use this one.
 			#endif
@@ -291,6 +305,96 @@ std::string print_priority_diagnostics() {
 }
 
 
+/*****************************************************************************
+** Implementation [Real Time Helpers]
+*****************************************************************************/
+
+bool set_cpu_affinity(const unsigned long &cpu_mask)
+{
+    #if defined(__linux__)
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        for ( unsigned int cpu = 0; cpu < 8*sizeof(unsigned long); ++cpu ) {
+            if ( cpu_mask & (1UL << cpu) ) {
+                CPU_SET(cpu, &cpus);
+            }
+        }
+        int result = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpus);
+        if ( result != 0 ) {
+            ecl_debug_throw(StandardException(LOC,InvalidInputError,"Could not set the cpu affinity (no permitted cpus in the mask?)."));
+            return false;
+        }
+        return true;
+    #else
+        (void) cpu_mask;
+        ecl_debug_throw(StandardException(LOC,NotSupportedError,"Cpu affinity is not supported on this platform."));
+        return false;
+    #endif
+}
+
+unsigned long get_cpu_affinity()
+{
+    unsigned long cpu_mask = 0;
+    #if defined(__linux__)
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        if ( pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpus) == 0 ) {
+            for ( unsigned int cpu = 0; cpu < 8*sizeof(unsigned long); ++cpu ) {
+                if ( CPU_ISSET(cpu, &cpus) ) {
+                    cpu_mask |= (1UL << cpu);
+                }
+            }
+        }
+    #endif
+    return cpu_mask;
+}
+
+void prefault_stack(const unsigned long &size)
+{
+    if ( size == 0 ) {
+        return;
+    }
+    // volatile so the compiler can't elide the writes
+    volatile unsigned char *stack = static_cast<volatile unsigned char*>(alloca(size));
+    const long page_size = sysconf(_SC_PAGESIZE);
+    for ( unsigned long i = 0; i < size; i += page_size ) {
+        stack[i] = 0;
+    }
+    stack[size - 1] = 0;
+}
+
+bool set_process_realtime(const unsigned long &heap_reserve, const unsigned long &stack_reserve)
+{
+    #if defined(_POSIX_MEMLOCK) && (_POSIX_MEMLOCK > 0)
+        if ( mlockall(MCL_CURRENT | MCL_FUTURE) == -1 ) {
+            ecl_debug_throw(threads::throwPriorityException(LOC));
+            return false;
+        }
+    #else
+        ecl_debug_throw(StandardException(LOC,NotSupportedError,"Your version of posix does not support locking process memory."));
+        return false;
+    #endif
+    #if defined(__GLIBC__)
+        // keep freed memory with the process and don't hand big allocations to mmap
+        mallopt(M_TRIM_THRESHOLD, -1);
+        mallopt(M_MMAP_MAX, 0);
+    #endif
+    if ( heap_reserve > 0 ) {
+        volatile unsigned char *heap = static_cast<volatile unsigned char*>(malloc(heap_reserve));
+        if ( heap == NULL ) {
+            ecl_debug_throw(StandardException(LOC,MemoryError,"Could not reserve the requested heap."));
+            return false;
+        }
+        const long page_size = sysconf(_SC_PAGESIZE);
+        for ( unsigned long i = 0; i < heap_reserve; i += page_size ) {
+            heap[i] = 0;
+        }
+        free(const_cast<unsigned char*>(heap));
+    }
+    prefault_stack(stack_reserve);
+    return true;
+}
+
 /*****************************************************************************
 ** Hidden Implementations
 *****************************************************************************/
@@ -0,0 +1,161 @@
+/**
+ * @file /src/lib/thread_pool_pos.cpp
+ *
+ * @brief Posix thread pool implementation.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#include <ecl/config/ecl.hpp>
+#if defined(ECL_IS_POSIX)
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <ecl/exceptions/standard_exception.hpp>
+#include "../../include/ecl/threads/thread.hpp"
+#include "../../include/ecl/threads/thread_pool.hpp"
+#include "../../include/ecl/threads/work_stealing_deque.hpp"
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Worker
+*****************************************************************************/
+
+class ThreadPool::Worker {
+public:
+	Worker(ThreadPool &pool, const unsigned int &index) : pool(pool), index(index) {}
+	void run() { pool.work(this); }
+
+	ThreadPool &pool;
+	unsigned int index;
+	threads::WorkStealingDeque<threads::PoolTaskBase*, ThreadPool::queue_size> tasks;
+	Thread thread;
+};
+
+/*****************************************************************************
+** ThreadPool
+*****************************************************************************/
+
+thread_local ThreadPool::Worker *ThreadPool::current_worker = NULL;
+
+ThreadPool::ThreadPool(const unsigned int &number_of_workers, const Priority &priority, const long &stack_size, const unsigned long &cpu_affinity) :
+	number_pending(0),
+	number_sleeping(0),
+	shutdown_requested(false)
+{
+	for ( unsigned int i = 0; i < number_of_workers; ++i ) {
+		workers.push_back(new Worker(*this, i));
+	}
+	for ( unsigned int i = 0; i < workers.size(); ++i ) {
+		workers[i]->thread.start(&Worker::run, *workers[i], priority, stack_size, cpu_affinity);
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	wait();
+	mutex.lock();
+	shutdown_requested.store(true);
+	work_available.notify_all();
+	mutex.unlock();
+	for ( unsigned int i = 0; i < workers.size(); ++i ) {
+		workers[i]->thread.join();
+		delete workers[i];
+	}
+}
+
+void ThreadPool::submit(VoidFunction function) {
+	enqueue(new threads::PoolTask< NullaryFreeFunction<void> >(generateFunctionObject(function)));
+}
+
+void ThreadPool::wait() {
+	mutex.lock();
+	while ( number_pending.load() > 0 ) {
+		all_done.wait(mutex);
+	}
+	mutex.unlock();
+}
+
+void ThreadPool::enqueue(threads::PoolTaskBase *task) {
+	number_pending.fetch_add(1);
+	Worker *worker = current_worker;
+	if ( ( worker == NULL ) || ( &(worker->pool) != this ) ) {
+		shared_tasks.push(task);
+	} else if ( !worker->tasks.push(task) && !shared_tasks.trypush(task) ) {
+		// a worker blocking on a full queue could deadlock the pool, run it here instead
+		execute(task);
+		return;
+	}
+	// pairs with the fence in work() before a worker goes to sleep
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	if ( number_sleeping.load(std::memory_order_relaxed) > 0 ) {
+		mutex.lock();
+		work_available.notify_one();
+		mutex.unlock();
+	}
+}
+
+bool ThreadPool::findTask(Worker *worker, threads::PoolTaskBase *&task) {
+	if ( worker->tasks.pop(task) ) {
+		return true;
+	}
+	if ( shared_tasks.trypop(task) ) {
+		return true;
+	}
+	const unsigned int n = workers.size();
+	for ( unsigned int i = 1; i < n; ++i ) {
+		if ( workers[(worker->index + i) % n]->tasks.steal(task) ) {
+			return true;
+		}
+	}
+	return false;
+}
+
+void ThreadPool::execute(threads::PoolTaskBase *task) {
+	task->run();
+	delete task;
+	if ( number_pending.fetch_sub(1) == 1 ) {
+		mutex.lock();
+		all_done.notify_all();
+		mutex.unlock();
+	}
+}
+
+void ThreadPool::work(Worker *worker) {
+	current_worker = worker;
+	threads::PoolTaskBase *task = NULL;
+	for (;;) {
+		if ( findTask(worker, task) ) {
+			execute(task);
+			continue;
+		}
+		mutex.lock();
+		number_sleeping.fetch_add(1);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		bool found = false;
+		while ( !shutdown_requested.load() && !(found = findTask(worker, task)) ) {
+			work_available.wait(mutex);
+		}
+		number_sleeping.fetch_sub(1);
+		mutex.unlock();
+		if ( found ) {
+			execute(task);
+		} else {
+			break;
+		}
+	}
+	current_worker = NULL;
+}
+
+} // namespace ecl
+
+#endif /* ECL_IS_POSIX */
@@ -30,15 +30,15 @@ namespace ecl {
 * Thread Class Methods
 *****************************************************************************/
 
-Thread::Thread(VoidFunction function, const Priority &priority, const long &stack_size) :
+Thread::Thread(VoidFunction function, const Priority &priority, const long &stack_size, const unsigned long &cpu_affinity, const SchedulingPolicy &policy, const long &prefault_size) :
   thread_task(NULL),
   has_started(false),
   join_requested(false)
 {
-  start(function, priority, stack_size);
+  start(function, priority, stack_size, cpu_affinity, policy, prefault_size);
 }
 
-Error Thread::start(VoidFunction function, const Priority &priority, const long &stack_size)
+Error Thread::start(VoidFunction function, const Priority &priority, const long &stack_size, const unsigned long &cpu_affinity, const SchedulingPolicy &policy, const long &prefault_size)
 {
   if ( has_started ) {
     ecl_debug_throw(StandardException(LOC,BusyError,"The thread has already been started."));
@@ -48,7 +48,7 @@ Error Thread::start(VoidFunction function, const Priority &priority, const long
   }
   initialise(stack_size);
   NullaryFreeFunction<void> nullary_function_object = generateFunctionObject(function);
-  thread_task = new threads::ThreadTask< NullaryFreeFunction<void> >(nullary_function_object, priority);
+  thread_task = new threads::ThreadTask< NullaryFreeFunction<void> >(nullary_function_object, priority, cpu_affinity, policy, prefault_size);
     int result = pthread_create(&(this->thread_handle), &(this->attrs), threads::ThreadTask< NullaryFreeFunction<void> >::EntryPoint, thread_task);
   pthread_attr_destroy(&attrs);
     if ( result != 0 ) {
@@ -0,0 +1,370 @@
+/**
+ * @file /src/lib/trace.cpp
+ *
+ * @brief Scoped tracing of threads to a chrome trace timeline.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include "../../include/ecl/threads/trace.hpp"
+
+#if defined(ECL_HAS_POSIX_THREADS)
+
+#include <cstdio>
+#include <sstream>
+#include <unistd.h>
+#if defined(__linux__)
+  #include <sys/syscall.h>
+#endif
+#include <ecl/exceptions/macros.hpp>
+#include <ecl/exceptions/standard_exception.hpp>
+#include <ecl/time/timestamp.hpp>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using threads::TraceBuffer;
+using threads::TraceEvent;
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+namespace {
+
+/**
+ * Function local statics, so threads traced during static
+ * initialisation don't find an unconstructed registry.
+ */
+struct Registry {
+	Registry() : capacity(16384), next_thread_id(1), retired_dropped(0), discard(2) {
+		// full from the start, so any number of threads can share it (pushes only count)
+		discard.push("", TraceEvent::Instant);
+		discard.push("", TraceEvent::Instant);
+	}
+	Mutex mutex;
+	std::vector<TraceBuffer*> buffers;
+	unsigned int capacity;
+	long next_thread_id;
+	unsigned long retired_dropped; // by buffers since deleted
+	TraceBuffer discard; // for events from threads whose buffer has been retired
+};
+
+Registry& registry() {
+	static Registry instance;
+	return instance;
+}
+
+/**
+ * Retires the thread's buffer when the thread exits. The collector deletes
+ * it once it has drained the last of its events, so the thread's cached
+ * pointer is reset first. Events from thread_local destructors that run
+ * later are dropped.
+ */
+struct ThreadExitGuard {
+	ThreadExitGuard() : buffer(NULL), owner(NULL), exited(false) {}
+	~ThreadExitGuard() {
+		exited = true;
+		if ( owner != NULL ) {
+			*owner = NULL;
+		}
+		if ( buffer != NULL ) {
+			Registry &instance = registry();
+			instance.mutex.lock();
+			buffer->retired = true;
+			instance.mutex.unlock();
+		}
+	}
+	TraceBuffer *buffer;
+	TraceBuffer **owner; // the thread's Tracer::thread_buffer
+	bool exited;
+};
+
+thread_local ThreadExitGuard thread_exit_guard;
+
+Priority current_priority() {
+	Priority priority = UnknownPriority;
+	ecl_try {
+		priority = get_priority();
+	} ecl_catch( StandardException &e ) {}
+	return priority;
+}
+
+const char* priority_name(const Priority &priority) {
+	switch ( priority ) {
+		case ( DefaultPriority ) : { return "DefaultPriority"; }
+		case ( BackgroundPriority ) : { return "BackgroundPriority"; }
+		case ( LowPriority ) : { return "LowPriority"; }
+		case ( NormalPriority ) : { return "NormalPriority"; }
+		case ( HighPriority ) : { return "HighPriority"; }
+		case ( CriticalPriority ) : { return "CriticalPriority"; }
+		case ( RealTimePriority1 ) : { return "RealTimePriority1"; }
+		case ( RealTimePriority2 ) : { return "RealTimePriority2"; }
+		case ( RealTimePriority3 ) : { return "RealTimePriority3"; }
+		case ( RealTimePriority4 ) : { return "RealTimePriority4"; }
+		default : { return "UnknownPriority"; }
+	}
+}
+
+std::string escape(const std::string &text) {
+	std::string escaped;
+	for ( std::string::size_type i = 0; i < text.size(); ++i ) {
+		const char c = text[i];
+		if ( ( c == '"' ) || ( c == '\\' ) ) {
+			escaped += '\\';
+			escaped += c;
+		} else if ( static_cast<unsigned char>(c) < 0x20 ) {
+			escaped += ' ';
+		} else {
+			escaped += c;
+		}
+	}
+	return escaped;
+}
+
+/**
+ * Chrome wants microseconds, keep the nanoseconds as decimals.
+ */
+void write_timestamp(std::ostream &ostream, const uint64_t &ticks) {
+	TimeStamp time = CycleClock::timestamp(ticks);
+	char buffer[32];
+	snprintf(buffer, sizeof(buffer), "%lld.%03ld",
+	         static_cast<long long>(time.sec())*1000000LL + time.nsec()/1000, time.nsec() % 1000);
+	ostream << buffer;
+}
+
+void separate(std::ostream &ostream, bool &first) {
+	if ( !first ) {
+		ostream << ",\n";
+	}
+	first = false;
+}
+
+} // namespace
+
+/*****************************************************************************
+** Implementation [TraceBuffer]
+*****************************************************************************/
+
+namespace threads {
+
+TraceBuffer::TraceBuffer(const unsigned int &capacity) :
+	priority(UnknownPriority),
+	thread_id(0),
+	renamed(1),
+	described(0),
+	retired(false),
+	dropped(0),
+	mask(0),
+	write_index(0),
+	read_index(0)
+{
+	uint64_t size = 2;
+	while ( size < capacity ) { size <<= 1; }
+	events.resize(size);
+	mask = size - 1;
+}
+
+void TraceBuffer::drain(std::vector<TraceEvent> &drained) {
+	const uint64_t tail = read_index.load(std::memory_order_relaxed);
+	const uint64_t head = write_index.load(std::memory_order_acquire);
+	for ( uint64_t i = tail; i < head; ++i ) {
+		drained.push_back(events[i & mask]);
+	}
+	read_index.store(head, std::memory_order_release);
+}
+
+} // namespace threads
+
+/*****************************************************************************
+** Static Variables [Tracer]
+*****************************************************************************/
+
+thread_local TraceBuffer* Tracer::thread_buffer = NULL;
+
+/*****************************************************************************
+** Implementation [Tracer]
+*****************************************************************************/
+
+TraceBuffer& Tracer::registerThread() {
+	Registry &instance = registry();
+	if ( thread_exit_guard.exited ) {
+		return instance.discard; // not cached, the guard won't be around to retire another buffer
+	}
+	instance.mutex.lock();
+	TraceBuffer *buffer = new TraceBuffer(instance.capacity);
+	#if defined(__linux__)
+	buffer->thread_id = syscall(SYS_gettid);
+	#else
+	buffer->thread_id = instance.next_thread_id++;
+	#endif
+	buffer->priority = current_priority();
+	instance.buffers.push_back(buffer);
+	instance.mutex.unlock();
+	thread_exit_guard.buffer = buffer;
+	thread_exit_guard.owner = &thread_buffer;
+	thread_buffer = buffer;
+	return *buffer;
+}
+
+void Tracer::nameThread(const std::string &name) {
+	TraceBuffer &current = buffer();
+	Priority priority = current_priority();
+	Registry &instance = registry();
+	instance.mutex.lock();
+	current.name = name;
+	current.priority = priority;
+	++current.renamed;
+	instance.mutex.unlock();
+}
+
+void Tracer::bufferCapacity(const unsigned int &capacity) {
+	Registry &instance = registry();
+	instance.mutex.lock();
+	instance.capacity = capacity;
+	instance.mutex.unlock();
+}
+
+unsigned long Tracer::dropped() {
+	Registry &instance = registry();
+	instance.mutex.lock();
+	unsigned long total = instance.retired_dropped + instance.discard.dropped.load(std::memory_order_relaxed);
+	for ( unsigned int i = 0; i < instance.buffers.size(); ++i ) {
+		total += instance.buffers[i]->dropped.load(std::memory_order_relaxed);
+	}
+	instance.mutex.unlock();
+	return total;
+}
+
+void Tracer::writeEvents(std::ostream &ostream, bool &first) {
+	Registry &instance = registry();
+	const long pid = getpid();
+	std::vector<TraceEvent> events;
+	instance.mutex.lock();
+	std::vector<TraceBuffer*>::iterator iter = instance.buffers.begin();
+	while ( iter != instance.buffers.end() ) {
+		TraceBuffer &buffer = **iter;
+		const bool retired = buffer.retired; // before draining, so nothing is left behind
+		if ( buffer.described != buffer.renamed ) {
+			std::ostringstream name;
+			if ( buffer.name.empty() ) {
+				name << "thread " << buffer.thread_id;
+			} else {
+				name << escape(buffer.name);
+			}
+			name << " [" << priority_name(buffer.priority) << "]";
+			separate(ostream, first);
+			ostream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << buffer.thread_id;
+			ostream << ",\"args\":{\"name\":\"" << name.str() << "\",\"priority\":\"" << priority_name(buffer.priority) << "\"}}";
+			// real time threads first
+			separate(ostream, first);
+			ostream << "{\"name\":\"thread_sort_index\",\"ph\":\"M\",\"pid\":" << pid << ",\"tid\":" << buffer.thread_id;
+			ostream << ",\"args\":{\"sort_index\":" << -static_cast<int>(buffer.priority) << "}}";
+			buffer.described = buffer.renamed;
+		}
+		events.clear();
+		buffer.drain(events);
+		for ( unsigned int i = 0; i < events.size(); ++i ) {
+			const TraceEvent &event = events[i];
+			separate(ostream, first);
+			ostream << "{\"name\":\"" << escape(event.name) << "\",\"ph\":\"";
+			switch ( event.type ) {
+				case ( TraceEvent::Begin ) : { ostream << "B"; break; }
+				case ( TraceEvent::End ) : { ostream << "E"; break; }
+				default : { ostream << "i\",\"s\":\"t"; break; }
+			}
+			ostream << "\",\"ts\":";
+			write_timestamp(ostream, event.ticks);
+			ostream << ",\"pid\":" << pid << ",\"tid\":" << buffer.thread_id << "}";
+		}
+		if ( retired ) {
+			instance.retired_dropped += buffer.dropped.load(std::memory_order_relaxed);
+			delete *iter;
+			iter = instance.buffers.erase(iter);
+		} else {
+			++iter;
+		}
+	}
+	instance.mutex.unlock();
+}
+
+void Tracer::write(std::ostream &ostream) {
+	bool first = true;
+	ostream << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+	writeEvents(ostream, first);
+	ostream << "\n]}\n";
+	ostream.flush();
+}
+
+bool Tracer::write(const std::string &file_name) {
+	std::ofstream file(file_name.c_str(), std::ios::out | std::ios::trunc);
+	if ( !file.is_open() ) {
+		return false;
+	}
+	write(file);
+	return file.good();
+}
+
+/*****************************************************************************
+** Implementation [TraceFlusher]
+*****************************************************************************/
+
+TraceFlusher::TraceFlusher(const std::string &file_name, const Duration &period) :
+	file(file_name.c_str(), std::ios::out | std::ios::trunc),
+	period(period),
+	first(true),
+	shutdown(false)
+{
+	if ( !file.is_open() ) {
+		ecl_throw(StandardException(LOC,OpenError,std::string("Could not open the trace file [") + file_name + "]."));
+		return;
+	}
+	file << "[\n";
+	thread.start(&TraceFlusher::run, *this);
+}
+
+TraceFlusher::~TraceFlusher() {
+	mutex.lock();
+	shutdown = true;
+	condition.notify_one();
+	mutex.unlock();
+	thread.join();
+	if ( file.is_open() ) {
+		Tracer::writeEvents(file, first);
+		file << "\n]\n";
+		file.close();
+	}
+}
+
+void TraceFlusher::flush() {
+	mutex.lock();
+	Tracer::writeEvents(file, first);
+	file.flush();
+	mutex.unlock();
+}
+
+void TraceFlusher::run() {
+	mutex.lock();
+	while ( !shutdown ) {
+		condition.wait(mutex, period);
+		if ( !shutdown ) {
+			Tracer::writeEvents(file, first);
+			file.flush();
+		}
+	}
+	mutex.unlock();
+}
+
+} // namespace ecl
+
+#endif /* ECL_HAS_POSIX_THREADS */
@@ -0,0 +1,181 @@
+/**
+ * @file /src/test/mpmc_queue.cpp
+ *
+ * @brief Unit Test for the @ref ecl::MpmcQueue "MpmcQueue" class.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#include <iostream>
+#include <ecl/config/ecl.hpp>
+#if defined(ECL_IS_POSIX)
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <gtest/gtest.h>
+#include <ecl/time/duration.hpp>
+#include <ecl/time/stopwatch.hpp>
+#include "../../include/ecl/threads/mpmc_queue.hpp"
+#include "../../include/ecl/threads/thread.hpp"
+
+/*****************************************************************************
+** Doxygen
+*****************************************************************************/
+/**
+ * @cond DO_NOT_DOXYGEN
+ */
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::Duration;
+using ecl::MpmcQueue;
+using ecl::StopWatch;
+using ecl::Thread;
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+namespace threads {
+namespace tests {
+
+/*****************************************************************************
+** Classes
+*****************************************************************************/
+
+typedef MpmcQueue<unsigned int, 16> TestQueue;
+
+static const unsigned int items_per_producer = 5000;
+
+class Producer {
+public:
+	Producer(TestQueue &queue, const unsigned int &id) : queue(queue), id(id) {}
+	void run() {
+		for ( unsigned int i = 0; i < items_per_producer; ++i ) {
+			queue.push(id*items_per_producer + i);
+		}
+	}
+	TestQueue &queue;
+	unsigned int id;
+};
+
+class Consumer {
+public:
+	Consumer(TestQueue &queue) : queue(queue), count(0), sum(0) {}
+	void run() {
+		unsigned int value;
+		// stop once the producers have gone quiet
+		while ( queue.trypop(value, Duration(0.5)) ) {
+			++count;
+			sum += value;
+		}
+	}
+	TestQueue &queue;
+	unsigned int count;
+	unsigned long sum;
+};
+
+} // namespace tests
+} // namespace threads
+} // namespace ecl
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using namespace ecl::threads::tests;
+
+/*****************************************************************************
+** Doxygen
+*****************************************************************************/
+
+/**
+ * @endcond
+ */
+
+/*****************************************************************************
+** Tests
+*****************************************************************************/
+
+TEST(MpmcQueueTests,nonBlocking) {
+	MpmcQueue<int, 3> queue;
+	EXPECT_EQ(4U, queue.capacity());
+	EXPECT_TRUE(queue.empty());
+	int value = -1;
+	EXPECT_FALSE(queue.trypop(value));
+	for ( int i = 0; i < 4; ++i ) {
+		EXPECT_TRUE(queue.trypush(i));
+	}
+	EXPECT_FALSE(queue.trypush(4));
+	EXPECT_EQ(4U, queue.size());
+	for ( int i = 0; i < 4; ++i ) {
+		EXPECT_TRUE(queue.trypop(value));
+		EXPECT_EQ(i, value);
+	}
+	EXPECT_TRUE(queue.empty());
+}
+
+TEST(MpmcQueueTests,timeouts) {
+	MpmcQueue<int, 2> queue;
+	int value;
+	StopWatch stopwatch;
+	EXPECT_FALSE(queue.trypop(value, Duration(0.05)));
+	EXPECT_GE(static_cast<double>(stopwatch.split()), 0.05);
+	EXPECT_TRUE(queue.trypush(1, Duration(0.05)));
+	EXPECT_TRUE(queue.trypush(2, Duration(0.05)));
+	stopwatch.restart();
+	EXPECT_FALSE(queue.trypush(3, Duration(0.05)));
+	EXPECT_GE(static_cast<double>(stopwatch.split()), 0.05);
+	EXPECT_TRUE(queue.trypop(value, Duration(0.05)));
+	EXPECT_EQ(1, value);
+}
+
+TEST(MpmcQueueTests,producersAndConsumers) {
+	TestQueue queue;
+	Producer producer_0(queue, 0), producer_1(queue, 1), producer_2(queue, 2);
+	Consumer consumer_0(queue), consumer_1(queue);
+	Thread consumer_thread_0(&Consumer::run, consumer_0);
+	Thread consumer_thread_1(&Consumer::run, consumer_1);
+	Thread producer_thread_0(&Producer::run, producer_0);
+	Thread producer_thread_1(&Producer::run, producer_1);
+	Thread producer_thread_2(&Producer::run, producer_2);
+	producer_thread_0.join();
+	producer_thread_1.join();
+	producer_thread_2.join();
+	consumer_thread_0.join();
+	consumer_thread_1.join();
+	const unsigned int n = 3*items_per_producer;
+	EXPECT_EQ(n, consumer_0.count + consumer_1.count);
+	EXPECT_EQ(static_cast<unsigned long>(n)*(n-1)/2, consumer_0.sum + consumer_1.sum);
+	EXPECT_TRUE(queue.empty());
+}
+
+/*****************************************************************************
+** Main program
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+
+    testing::InitGoogleTest(&argc,argv);
+    return RUN_ALL_TESTS();
+}
+
+#else
+
+/*****************************************************************************
+** Alternative main
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+	std::cout << "Currently not supported on your platform (posix only)." << std::endl;
+}
+
+#endif /* ECL_IS_POSIX */
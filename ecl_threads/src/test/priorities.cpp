@@ -19,6 +19,7 @@
 
 #include <gtest/gtest.h>
 #include "../../include/ecl/threads/priority.hpp"
+#include "../../include/ecl/threads/thread.hpp"
 #include <ecl/exceptions/standard_exception.hpp>
 
 /*****************************************************************************
@@ -36,6 +37,8 @@ using ecl::RealTimePriority3;
 using ecl::RealTimePriority2;
 using ecl::RealTimePriority1;
 using ecl::StandardException;
+using ecl::FifoScheduling;
+using ecl::Thread;
 
 /*****************************************************************************
 ** Tests
@@ -76,6 +79,54 @@ TEST(PriorityTest,setPosixRealTimePriorities) {
 	}
 }
 
+TEST(PriorityTest,setPosixFifoPriorities) {
+	try {
+		set_priority(RealTimePriority1, FifoScheduling);
+		EXPECT_EQ(RealTimePriority1, ecl::get_priority());
+		set_priority(NormalPriority);
+	} catch ( const StandardException &e ) {
+		SUCCEED();
+		std::cout << "Do not have permission for fifo scheduling priorities." << std::endl;
+	}
+}
+
+TEST(PriorityTest,cpuAffinity) {
+	unsigned long original = ecl::get_cpu_affinity();
+	if ( original == 0 ) {
+		std::cout << "Cpu affinity is not available on this platform." << std::endl;
+		return;
+	}
+	// pin to the lowest permitted cpu and back again
+	unsigned long lowest = original & (~original + 1);
+	EXPECT_TRUE(ecl::set_cpu_affinity(lowest));
+	EXPECT_EQ(lowest, ecl::get_cpu_affinity());
+	EXPECT_TRUE(ecl::set_cpu_affinity(original));
+	EXPECT_EQ(original, ecl::get_cpu_affinity());
+}
+
+TEST(PriorityTest,prefaultStack) {
+	ecl::prefault_stack(64*1024);
+	SUCCEED();
+}
+
+unsigned long thread_affinity = 0;
+
+void recordAffinity() {
+	thread_affinity = ecl::get_cpu_affinity();
+}
+
+TEST(PriorityTest,threadAffinity) {
+	unsigned long original = ecl::get_cpu_affinity();
+	if ( original == 0 ) {
+		return;
+	}
+	unsigned long lowest = original & (~original + 1);
+	Thread thread(recordAffinity, ecl::DefaultPriority, -1, lowest, ecl::RoundRobinScheduling, 16*1024);
+	thread.join();
+	EXPECT_EQ(lowest, thread_affinity);
+	EXPECT_EQ(original, ecl::get_cpu_affinity()); // caller is untouched
+}
+
 /*****************************************************************************
 ** Main program
 *****************************************************************************/
@@ -0,0 +1,180 @@
+/**
+ * @file /src/test/thread_pool.cpp
+ *
+ * @brief Unit Test for the @ref ecl::ThreadPool "ThreadPool" class.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#include <iostream>
+#include <ecl/config/ecl.hpp>
+#if defined(ECL_IS_POSIX)
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <atomic>
+#include <gtest/gtest.h>
+#include <ecl/utilities/function_objects.hpp>
+#include <ecl/utilities/references.hpp>
+#include "../../include/ecl/threads/thread_pool.hpp"
+
+/*****************************************************************************
+** Doxygen
+*****************************************************************************/
+/**
+ * @cond DO_NOT_DOXYGEN
+ */
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::ThreadPool;
+using ecl::generateFunctionObject;
+using ecl::ref;
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+namespace threads {
+namespace tests {
+
+/*****************************************************************************
+** Globals
+*****************************************************************************/
+
+static std::atomic<unsigned int> free_function_count(0);
+
+/*****************************************************************************
+** Classes
+*****************************************************************************/
+
+class Counter {
+public:
+	Counter() : count(0) {}
+	void increment() { count.fetch_add(1); }
+	void add(int i) { count.fetch_add(i); }
+	std::atomic<unsigned int> count;
+};
+
+class CountingFunction {
+public:
+	typedef void result_type;
+	CountingFunction() : count(0) {}
+	void operator()() { count.fetch_add(1); }
+	std::atomic<unsigned int> count;
+};
+
+/**
+ * Spawns more work from inside a worker (exercises the per-worker deques).
+ */
+class Spawner {
+public:
+	Spawner(ThreadPool &pool, Counter &counter) : pool(pool), counter(counter) {}
+	void spawn() {
+		for ( int i = 0; i < 100; ++i ) {
+			pool.submit(&Counter::increment, counter);
+		}
+	}
+	ThreadPool &pool;
+	Counter &counter;
+};
+
+/*****************************************************************************
+** Functions
+*****************************************************************************/
+
+void f() {
+	free_function_count.fetch_add(1);
+}
+
+} // namespace tests
+} // namespace threads
+} // namespace ecl
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using namespace ecl::threads::tests;
+
+/*****************************************************************************
+** Doxygen
+*****************************************************************************/
+
+/**
+ * @endcond
+ */
+
+/*****************************************************************************
+** Tests
+*****************************************************************************/
+
+TEST(ThreadPoolTests,functionTypes) {
+	ThreadPool pool(2);
+	EXPECT_EQ(2U, pool.size());
+	Counter counter;
+	CountingFunction function_object;
+	for ( int i = 0; i < 10; ++i ) {
+		pool.submit(f);
+		pool.submit(&Counter::increment, counter);
+		pool.submit(generateFunctionObject(&Counter::add, counter, 2));
+		pool.submit(ref(function_object));
+	}
+	pool.wait();
+	EXPECT_EQ(0U, pool.pending());
+	EXPECT_EQ(10U, free_function_count.load());
+	EXPECT_EQ(30U, counter.count.load());
+	EXPECT_EQ(10U, function_object.count.load());
+}
+
+TEST(ThreadPoolTests,manyTasks) {
+	Counter counter;
+	{
+		ThreadPool pool(4);
+		for ( int i = 0; i < 5000; ++i ) {
+			pool.submit(&Counter::increment, counter);
+		}
+	} // destructor waits for the outstanding tasks
+	EXPECT_EQ(5000U, counter.count.load());
+}
+
+TEST(ThreadPoolTests,nestedTasks) {
+	ThreadPool pool(3);
+	Counter counter;
+	Spawner spawner(pool, counter);
+	for ( int i = 0; i < 20; ++i ) {
+		pool.submit(&Spawner::spawn, spawner);
+	}
+	pool.wait();
+	EXPECT_EQ(2000U, counter.count.load());
+}
+
+/*****************************************************************************
+** Main program
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+
+    testing::InitGoogleTest(&argc,argv);
+    return RUN_ALL_TESTS();
+}
+
+#else
+
+/*****************************************************************************
+** Alternative main
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+	std::cout << "Currently not supported on your platform (posix only)." << std::endl;
+}
+
+#endif /* ECL_IS_POSIX */
@@ -0,0 +1,188 @@
+/**
+ * @file /src/test/trace.cpp
+ *
+ * @brief Unit Test for the tracer.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#include <iostream>
+#include <ecl/config/ecl.hpp>
+#if defined(ECL_IS_POSIX)
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#define ECL_TRACING_ENABLED
+
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unistd.h>
+#include <gtest/gtest.h>
+#include "../../include/ecl/threads/thread.hpp"
+#include "../../include/ecl/threads/trace.hpp"
+
+/*****************************************************************************
+** Doxygen
+*****************************************************************************/
+/**
+ * @cond DO_NOT_DOXYGEN
+ */
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::Thread;
+using ecl::TraceFlusher;
+using ecl::Tracer;
+
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+unsigned int occurrences(const std::string &text, const std::string &pattern) {
+	unsigned int count = 0;
+	for ( std::string::size_type i = text.find(pattern); i != std::string::npos; i = text.find(pattern, i + 1) ) {
+		++count;
+	}
+	return count;
+}
+
+void worker() {
+	ECL_TRACE_THREAD("worker");
+	for ( unsigned int i = 0; i < 10; ++i ) {
+		ECL_TRACE_SCOPE("cycle");
+		ECL_TRACE_BEGIN("compute");
+		ECL_TRACE_END("compute");
+	}
+	ECL_TRACE_INSTANT("done");
+}
+
+std::atomic<bool> exiting(false), drained(false);
+
+/**
+ * Constructed before the thread's first trace, so destroyed after the
+ * tracer has retired the thread's buffer.
+ */
+struct TraceOnExit {
+	void touch() {}
+	~TraceOnExit() {
+		exiting = true;
+		while ( !drained ) {
+			usleep(1000);
+		}
+		ECL_TRACE_INSTANT("exiting");
+	}
+};
+
+thread_local TraceOnExit trace_on_exit;
+
+/*****************************************************************************
+** Tests
+*****************************************************************************/
+
+TEST(TraceTests,threads) {
+	Thread first(worker);
+	Thread second(worker);
+	first.join();
+	second.join();
+	{
+		ECL_TRACE_SCOPE("main");
+	}
+	std::ostringstream trace;
+	Tracer::write(trace);
+	const std::string json = trace.str();
+	EXPECT_EQ(0u, json.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+	EXPECT_EQ(2u, occurrences(json, "\"name\":\"worker ["));
+	EXPECT_EQ(3u, occurrences(json, "\"thread_name\""));
+	EXPECT_EQ(2u*20u + 1u, occurrences(json, "\"ph\":\"B\""));
+	EXPECT_EQ(2u*20u + 1u, occurrences(json, "\"ph\":\"E\""));
+	EXPECT_EQ(2u, occurrences(json, "\"ph\":\"i\""));
+	// drained, the exited workers are gone, main is described already
+	std::ostringstream again;
+	Tracer::write(again);
+	EXPECT_EQ(0u, occurrences(again.str(), "\"ph\""));
+}
+
+TEST(TraceTests,dropped) {
+	Tracer::bufferCapacity(16);
+	Thread thread([]() {
+		for ( unsigned int i = 0; i < 20; ++i ) {
+			ECL_TRACE_INSTANT("tick");
+		}
+	});
+	thread.join();
+	Tracer::bufferCapacity(16384);
+	std::ostringstream trace;
+	Tracer::write(trace);
+	EXPECT_EQ(16u, occurrences(trace.str(), "\"ph\":\"i\""));
+	EXPECT_EQ(4u, Tracer::dropped());
+}
+
+TEST(TraceTests,flusher) {
+	const std::string file_name("ecl_test_trace.json");
+	{
+		TraceFlusher flusher(file_name, ecl::Duration(0,1000000));
+		Thread thread(worker);
+		thread.join();
+		flusher.flush();
+		ECL_TRACE_INSTANT("after");
+	}
+	std::ifstream file(file_name.c_str());
+	std::stringstream contents;
+	contents << file.rdbuf();
+	const std::string json = contents.str();
+	EXPECT_EQ(0u, json.find("["));
+	EXPECT_EQ(json.size() - 3, json.rfind("\n]\n"));
+	EXPECT_EQ(20u, occurrences(json, "\"ph\":\"B\""));
+	EXPECT_EQ(2u, occurrences(json, "\"ph\":\"i\""));
+	std::remove(file_name.c_str());
+}
+
+TEST(TraceTests,tracingAfterExit) {
+	Thread thread([]() {
+		trace_on_exit.touch();
+		ECL_TRACE_INSTANT("running");
+	});
+	while ( !exiting ) {
+		usleep(1000);
+	}
+	// deletes the retired buffer before the thread traces again
+	std::ostringstream trace;
+	Tracer::write(trace);
+	EXPECT_EQ(1u, occurrences(trace.str(), "\"name\":\"running\""));
+	const unsigned long dropped = Tracer::dropped();
+	drained = true;
+	thread.join();
+	EXPECT_EQ(dropped + 1, Tracer::dropped()); // too late to be recorded, but safely
+}
+
+/*****************************************************************************
+** Main program
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+
+    testing::InitGoogleTest(&argc,argv);
+    return RUN_ALL_TESTS();
+}
+
+#else
+
+/*****************************************************************************
+** Alternative main
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+	std::cout << "Currently not supported on your platform (posix only)." << std::endl;
+}
+
+#endif /* ECL_IS_POSIX */
@@ -25,6 +25,8 @@
   // monotonic clock, cpu clock -> clock_gettime; clock_selection -> clock_nanosleep
   #if defined(_POSIX_MONOTONIC_CLOCK) && (_POSIX_MONOTONIC_CLOCK) >= 0L && defined(_POSIX_CLOCK_SELECTION) && (_POSIX_CLOCK_SELECTION) >= 0L
 
+#define ECL_HAS_CPUWATCH
+
 /*****************************************************************************
 ** Includes
 *****************************************************************************/
@@ -0,0 +1,159 @@
+/**
+ * @file /include/ecl/time/cycle_clock.hpp
+ *
+ * @brief Low overhead timestamps from the cpu's cycle counter.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_TIME_CYCLE_CLOCK_HPP_
+#define ECL_TIME_CYCLE_CLOCK_HPP_
+
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#include <ecl/config.hpp>
+#include "timestamp.hpp"
+
+#ifdef ECL_HAS_TIMESTAMP
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+  #define ECL_CYCLE_CLOCK_TSC
+  #include <x86intrin.h>
+#elif defined(_MSC_VER) && ( defined(_M_X64) || defined(_M_IX86) )
+  #define ECL_CYCLE_CLOCK_TSC
+  #include <intrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__)
+  #define ECL_CYCLE_CLOCK_CNTVCT
+#elif defined(ECL_IS_POSIX)
+  #include <time.h> // no counter, fall back to the monotonic clock
+#else
+  #error "No cycle counter or monotonic clock available for ecl::CycleClock."
+#endif
+
+/*****************************************************************************
+** Ecl Functionality Defines
+*****************************************************************************/
+
+#ifndef ECL_HAS_CYCLE_CLOCK
+  #define ECL_HAS_CYCLE_CLOCK
+#endif
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <stdint.h>
+#include <ecl/config/macros.hpp>
+#include "duration.hpp"
+#include "macros.hpp"
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Interface [CycleClock]
+*****************************************************************************/
+/**
+ * @brief Timestamps from the cpu's cycle counter.
+ *
+ * Reading the time with clock_gettime (TimeStamp, StopWatch, CpuWatch) and
+ * then normalising the sec/nsec pair costs tens of nanoseconds, too much to
+ * instrument sections that themselves only take a hundred. This reads the
+ * raw cycle counter instead (rdtsc on x86, cntvct_el0 on arm64) - a few
+ * nanoseconds - and only converts to nanoseconds or a TimeStamp later, off
+ * the hot path.
+ *
+ * Conversions use a calibration against CLOCK_MONOTONIC. It is made lazily
+ * on the first conversion (busy waiting ~10ms), call calibrate() at startup
+ * to keep that off the hot path too.
+ *
+ * Caveats:
+ *
+ * - On x86 this relies on an invariant tsc (constant rate, synchronised
+ *   across cores), which every x86 cpu of the last decade has.
+ * - The counter isn't serialising, i.e. the cpu may reorder it with
+ *   neighbouring instructions by a few cycles.
+ * - Platforms without a supported counter fall back to the monotonic
+ *   clock, with ticks in nanoseconds.
+ *
+ * <b>Usage:</b>
+ *
+ * @code
+ * CycleClock::calibrate(); // at startup
+ *
+ * uint64_t start = CycleClock::ticks();
+ * section();
+ * uint64_t finish = CycleClock::ticks();
+ * std::cout << CycleClock::nanoseconds(finish - start) << std::endl;
+ * std::cout << CycleClock::timestamp(start) << std::endl; // comparable with TimeStamp()
+ * @endcode
+ *
+ * @sa FastStopWatch.
+ */
+class ecl_time_PUBLIC CycleClock {
+public:
+	/**
+	 * @brief Read the cycle counter.
+	 *
+	 * @return uint64_t : raw counter value.
+	 */
+	static uint64_t ticks() {
+		#if defined(ECL_CYCLE_CLOCK_TSC)
+		return __rdtsc();
+		#elif defined(ECL_CYCLE_CLOCK_CNTVCT)
+		uint64_t value;
+		__asm__ __volatile__ ("mrs %0, cntvct_el0" : "=r" (value));
+		return value;
+		#else
+		timespec time;
+		clock_gettime(CLOCK_MONOTONIC, &time);
+		return static_cast<uint64_t>(time.tv_sec)*1000000000ULL + time.tv_nsec;
+		#endif
+	}
+	/**
+	 * @brief Convert an interval in ticks to nanoseconds.
+	 */
+	static int64_t nanoseconds(const int64_t &ticks) {
+		return static_cast<int64_t>(ticks*nanosecondsPerTick());
+	}
+	/**
+	 * @brief Convert an interval in ticks to a duration.
+	 */
+	static Duration duration(const uint64_t &ticks);
+	/**
+	 * @brief Convert a counter value to a (monotonic clock) timestamp.
+	 *
+	 * @param ticks : a value returned by ticks().
+	 * @return TimeStamp : as TimeStamp() would have returned at that moment.
+	 */
+	static TimeStamp timestamp(const uint64_t &ticks);
+	/**
+	 * @brief Counter frequency [Hz].
+	 */
+	static double frequency() { return 1.0e9/nanosecondsPerTick(); }
+	/**
+	 * @brief Calibrate the counter against the monotonic clock.
+	 *
+	 * Busy waits for the calibration window. It isn't safe to call while
+	 * other threads are converting ticks, do so at startup.
+	 *
+	 * @param window : longer is more accurate, 10ms gives a few parts per million.
+	 */
+	static void calibrate(const Duration &window = Duration(0,10000000));
+
+private:
+	static double nanosecondsPerTick();
+};
+
+} // namespace ecl
+
+#endif /* ECL_HAS_TIMESTAMP */
+#endif /* ECL_TIME_CYCLE_CLOCK_HPP_ */
@@ -0,0 +1,106 @@
+/**
+ * @file /include/ecl/time/fast_stopwatch.hpp
+ *
+ * @brief A stopwatch running on the cpu's cycle counter.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_TIME_FAST_STOPWATCH_HPP_
+#define ECL_TIME_FAST_STOPWATCH_HPP_
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <ecl/config/macros.hpp>
+#include "cycle_clock.hpp"
+#include "macros.hpp"
+
+#ifdef ECL_HAS_CYCLE_CLOCK
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Classes
+*****************************************************************************/
+/**
+ * @brief A stopwatch running on the cpu's cycle counter.
+ *
+ * The same interface as StopWatch, but it only reads the cycle counter
+ * (CycleClock) when started or split, so it can time sections of a hundred
+ * nanoseconds without swamping them. Use the *Ticks() methods on the hot
+ * path and convert later, the TimeStamp returning methods convert on the
+ * spot.
+ *
+ * Note that the stopwatch starts automatically, just use restart() if you
+ * wish to reset and start again.
+ *
+ * <b>Usage:</b>
+ * @code
+ * FastStopWatch stopwatch;
+ * section();
+ * uint64_t ticks = stopwatch.splitTicks(); // hot path
+ * // ...
+ * std::cout << CycleClock::nanoseconds(ticks) << std::endl;
+ * std::cout << stopwatch.elapsed() << std::endl;
+ * @endcode
+ *
+ * @sa CycleClock, StopWatch.
+ **/
+class ecl_time_PUBLIC FastStopWatch
+{
+    public:
+        /**
+         * Initialises the stopwatch with the current counter value.
+         **/
+        FastStopWatch() : start_ticks(CycleClock::ticks()), split_ticks(start_ticks) {}
+
+        virtual ~FastStopWatch() {}
+        /**
+         * @brief Restarts the stopwatch.
+         **/
+        void restart() {
+            start_ticks = CycleClock::ticks();
+            split_ticks = start_ticks;
+        }
+        /**
+         * @brief Ticks elapsed since (re)started.
+         **/
+        uint64_t elapsedTicks() const { return CycleClock::ticks() - start_ticks; }
+        /**
+         * @brief Ticks elapsed since the last split.
+         **/
+        uint64_t splitTicks() {
+            const uint64_t last_ticks = split_ticks;
+            split_ticks = CycleClock::ticks();
+            return split_ticks - last_ticks;
+        }
+        /**
+         * @brief Calculates the total elapsed time.
+         *
+         * @return TimeStamp : the total elapsed time since (re)started.
+         **/
+        TimeStamp elapsed() const { return CycleClock::duration(elapsedTicks()); }
+        /**
+         * @brief Calculates the current split.
+         *
+         * @return TimeStamp : the elapsed time since the last split.
+         **/
+        TimeStamp split() { return CycleClock::duration(splitTicks()); }
+
+    private:
+        uint64_t start_ticks, split_ticks;
+};
+
+} // namespace ecl
+
+#endif /* ECL_HAS_CYCLE_CLOCK */
+#endif /* ECL_TIME_FAST_STOPWATCH_HPP_ */
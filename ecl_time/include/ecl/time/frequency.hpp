@@ -12,6 +12,12 @@
 ** Includes
 *****************************************************************************/
 
+#include <atomic>
+#include <vector>
+#include <stdint.h>
+#include "cycle_clock.hpp"
+#include "latency_histogram.hpp"
+#include "macros.hpp"
 #include "timestamp.hpp"
 
 /*****************************************************************************
@@ -123,6 +129,149 @@ protected:
   ecl::TimeStamp last_incoming;
 };
 
+#ifdef ECL_HAS_CYCLE_CLOCK
+
+/**
+ * @brief Windowed frequency and latency statistics of an incoming stream.
+ *
+ * Intervals and jitter are in nanoseconds, percentiles are resolved to
+ * within ~3% (see LatencyHistogram).
+ */
+struct FrequencyStatistics {
+
+  FrequencyStatistics()
+  : has_connection(false)
+  , count(0)
+  , hz(0.0)
+  , window(0.0)
+  , minimum_interval(0)
+  , median_interval(0)
+  , p99_interval(0)
+  , p999_interval(0)
+  , maximum_interval(0)
+  , median_jitter(0)
+  , p99_jitter(0)
+  , p999_jitter(0)
+  , maximum_jitter(0)
+  , last_incoming(-1.0)
+  {}
+
+  bool has_connection;      /**< @brief Something arrived in the window. **/
+  unsigned long count;      /**< @brief Arrivals in the window. **/
+  double hz;
+  double window;            /**< @brief Actual length of the window [s]. **/
+  int64_t minimum_interval;
+  int64_t median_interval;
+  int64_t p99_interval;
+  int64_t p999_interval;
+  int64_t maximum_interval;
+  int64_t median_jitter;    /**< @brief Deviation of the intervals from the expected period. **/
+  int64_t p99_jitter;
+  int64_t p999_jitter;
+  int64_t maximum_jitter;
+  double last_incoming;     /**< @brief Seconds since the last arrival (negative if nothing arrived yet). **/
+};
+
+/**
+ * @brief Lock-free frequency monitor with windowed percentile statistics.
+ *
+ * For monitoring high rate streams (kHz) from a diagnostics thread. Every
+ * arrival's inter-arrival interval and jitter (its deviation from the
+ * expected period) are recorded into log bucketed histograms with atomic
+ * counters, so update() never locks and costs a few tens of nanoseconds.
+ * It may be called from any number of threads.
+ *
+ * The diagnostics thread calls analyse(). Once a window has elapsed, it
+ * diffs the (cumulative) histograms against those at the previous window
+ * boundary to produce that window's statistics - the producers are never
+ * paused or reset.
+ *
+ * If no expected period is given, jitter is measured against the mean
+ * interval of the previous window.
+ *
+ * Timing is via the CycleClock, which is calibrated on construction if it
+ * hasn't been already.
+ *
+ * <b>Usage:</b>
+ *
+ * @code
+ * WindowedFrequencyMonitor monitor(Duration(1.0), Duration(0,1000000)); // 1s windows, expecting 1kHz
+ *
+ * void callback() {
+ *   monitor.update();
+ * }
+ *
+ * void diagnostics() {
+ *   const FrequencyStatistics &statistics = monitor.analyse();
+ *   std::cout << statistics.hz << " " << statistics.p999_interval << std::endl;
+ * }
+ * @endcode
+ *
+ * @sa FrequencyMonitor, LatencyHistogram.
+ */
+class ecl_time_PUBLIC WindowedFrequencyMonitor {
+public:
+  /**
+   * @brief Configure the monitor.
+   *
+   * @param window : time interval over which statistics are gathered.
+   * @param expected_period : nominal interval to measure jitter against (zero to use the measured mean).
+   */
+  WindowedFrequencyMonitor(
+      const Duration& window = Duration(1.0),
+      const Duration& expected_period = Duration(0,0)
+      );
+  /**
+   * @brief Let the monitor know that new data has arrived (lock-free).
+   */
+  void update() {
+    const uint64_t now = CycleClock::ticks();
+    const uint64_t previous = last_incoming.exchange(now, std::memory_order_relaxed);
+    if ( previous == 0 ) {
+      return; // first arrival, no interval yet
+    }
+    const int64_t interval = CycleClock::nanoseconds(static_cast<int64_t>(now - previous));
+    intervals.record(interval);
+    const int64_t expected = expected_interval.load(std::memory_order_relaxed);
+    if ( expected > 0 ) {
+      jitters.record( ( interval > expected ) ? ( interval - expected ) : ( expected - interval ) );
+    }
+  }
+  /**
+   * @brief Generate the statistics for the last window, if it has elapsed.
+   *
+   * Call from one (diagnostics) thread only.
+   *
+   * @return FrequencyStatistics : statistics of the most recently completed window.
+   */
+  const FrequencyStatistics& analyse();
+  /**
+   * @brief Statistics of the most recently completed window.
+   */
+  const FrequencyStatistics& statistics() const { return current_statistics; }
+  /**
+   * @brief Cumulative histogram of all the intervals so far [ns].
+   */
+  const LatencyHistogram& intervalHistogram() const { return intervals; }
+
+private:
+  WindowedFrequencyMonitor(const WindowedFrequencyMonitor&); // not copyable
+  WindowedFrequencyMonitor& operator=(const WindowedFrequencyMonitor&);
+
+  LatencyHistogram intervals;
+  LatencyHistogram jitters;
+  std::atomic<uint64_t> last_incoming; // ticks, zero until something arrives
+  std::atomic<int64_t> expected_interval; // ns
+  bool fixed_expectation;
+  int64_t window_ticks;
+  uint64_t window_start;
+  std::vector<uint64_t> interval_counts; // at the start of the window
+  std::vector<uint64_t> jitter_counts;
+  FrequencyStatistics current_statistics;
+};
+
+#endif /* ECL_HAS_CYCLE_CLOCK */
+
 /*****************************************************************************
 ** Trailers
 *****************************************************************************/
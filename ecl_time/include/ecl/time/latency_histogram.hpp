@@ -0,0 +1,155 @@
+/**
+ * @file /include/ecl/time/latency_histogram.hpp
+ *
+ * @brief Lock-free, log bucketed histogram for latencies.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_TIME_LATENCY_HISTOGRAM_HPP_
+#define ECL_TIME_LATENCY_HISTOGRAM_HPP_
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <atomic>
+#include <stdint.h>
+#include <ecl/config/macros.hpp>
+#include "macros.hpp"
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Interface [LatencyHistogram]
+*****************************************************************************/
+/**
+ * @brief Lock-free histogram of latencies (nanoseconds).
+ *
+ * Buckets are log-linear (in the style of HDR histograms): each power of
+ * two is split into 32 linear sub-buckets, so a recorded value is resolved
+ * to within ~3% of itself from 32ns all the way up to ~18 minutes, in a
+ * fixed ~9kB table.
+ *
+ * Recording is a handful of relaxed atomic increments, so any number of
+ * threads can record while another reads the statistics. Readers see a
+ * consistent enough view for diagnostics, not an atomic snapshot.
+ *
+ * <b>Usage:</b>
+ *
+ * @code
+ * LatencyHistogram histogram;
+ * histogram.record(latency_ns); // hot path
+ *
+ * // diagnostics thread
+ * std::cout << histogram.percentile(99.0) << std::endl;
+ * @endcode
+ */
+class ecl_time_PUBLIC LatencyHistogram {
+public:
+	static const unsigned int sub_bucket_bits = 5;
+	static const unsigned int sub_buckets = 1 << sub_bucket_bits;
+	static const unsigned int maximum_magnitude = 40; /**< @brief Values from 2^41 ns upwards share the last bucket. **/
+	static const unsigned int number_of_buckets = ( maximum_magnitude - sub_bucket_bits + 2 )*sub_buckets;
+
+	LatencyHistogram() { reset(); }
+
+	/**
+	 * @brief Record a value (negative values are recorded as zero).
+	 *
+	 * @param value : latency [ns].
+	 */
+	void record(const int64_t &value) {
+		const uint64_t v = ( value < 0 ) ? 0 : static_cast<uint64_t>(value);
+		buckets[index(v)].fetch_add(1, std::memory_order_relaxed);
+		total.fetch_add(v, std::memory_order_relaxed);
+		uint64_t current = max.load(std::memory_order_relaxed);
+		while ( ( v > current ) && !max.compare_exchange_weak(current, v, std::memory_order_relaxed) ) {}
+		current = min.load(std::memory_order_relaxed);
+		while ( ( v < current ) && !min.compare_exchange_weak(current, v, std::memory_order_relaxed) ) {}
+		counter.fetch_add(1, std::memory_order_release);
+	}
+	/**
+	 * @brief Clear all statistics.
+	 *
+	 * Not atomic with respect to concurrent recording, values recorded
+	 * meanwhile may be partially lost.
+	 */
+	void reset();
+
+	/*********************
+	** Statistics
+	**********************/
+	uint64_t count() const { return counter.load(std::memory_order_acquire); } /**< @brief Number of recorded values. **/
+	int64_t minimum() const; /**< @brief Smallest recorded value, zero if empty. **/
+	int64_t maximum() const { return max.load(std::memory_order_relaxed); } /**< @brief Largest recorded value, zero if empty. **/
+	double mean() const; /**< @brief Mean of the recorded values, zero if empty. **/
+	/**
+	 * @brief Value below which the given percentage of recorded values lie.
+	 *
+	 * Resolved to the upper end of the bucket (and never above the maximum).
+	 *
+	 * @param percentage : in [0,100], e.g. 99.9.
+	 * @return int64_t : latency [ns], zero if empty.
+	 */
+	int64_t percentile(const double &percentage) const;
+
+	/*********************
+	** Buckets
+	**********************/
+	/**
+	 * @brief Bucket that a value is counted in.
+	 */
+	static unsigned int index(const uint64_t &value) {
+		if ( value < sub_buckets ) {
+			return static_cast<unsigned int>(value);
+		}
+		// floor(log2(value)), >= sub_bucket_bits
+		#if defined(__GNUC__)
+		unsigned int magnitude = 63 - __builtin_clzll(value);
+		#else
+		unsigned int magnitude = sub_bucket_bits;
+		while ( value >> ( magnitude + 1 ) ) { ++magnitude; }
+		#endif
+		if ( magnitude > maximum_magnitude ) {
+			return number_of_buckets - 1;
+		}
+		const unsigned int shift = magnitude - sub_bucket_bits;
+		return ( shift + 1 )*sub_buckets + static_cast<unsigned int>( ( value >> shift ) - sub_buckets );
+	}
+	/**
+	 * @brief Smallest value counted in a bucket.
+	 */
+	static uint64_t lowest(const unsigned int &bucket) {
+		if ( bucket < sub_buckets ) {
+			return bucket;
+		}
+		const unsigned int shift = bucket/sub_buckets - 1;
+		return static_cast<uint64_t>( bucket % sub_buckets + sub_buckets ) << shift;
+	}
+	/**
+	 * @brief Number of values counted in a bucket.
+	 */
+	uint64_t bucketCount(const unsigned int &bucket) const { return buckets[bucket].load(std::memory_order_relaxed); }
+
+private:
+	LatencyHistogram(const LatencyHistogram &); // not copyable
+	LatencyHistogram& operator=(const LatencyHistogram &);
+
+	std::atomic<uint64_t> buckets[number_of_buckets];
+	std::atomic<uint64_t> counter;
+	std::atomic<uint64_t> total;
+	std::atomic<uint64_t> min;
+	std::atomic<uint64_t> max;
+};
+
+} // namespace ecl
+
+#endif /* ECL_TIME_LATENCY_HISTOGRAM_HPP_ */
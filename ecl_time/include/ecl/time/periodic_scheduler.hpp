@@ -0,0 +1,32 @@
+/**
+ * @file /include/ecl/time/periodic_scheduler.hpp
+ *
+ * @brief Drift free periodic scheduling for control loops.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_TIME_PERIODIC_SCHEDULER_HPP_
+#define ECL_TIME_PERIODIC_SCHEDULER_HPP_
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <ecl/config.hpp>
+
+// Needs absolute sleeps on the monotonic clock.
+#if defined(ECL_IS_POSIX)
+  #include <unistd.h>
+  // monotonic clock -> clock_gettime; clock_selection -> clock_nanosleep
+  #if defined(_POSIX_MONOTONIC_CLOCK) && (_POSIX_MONOTONIC_CLOCK) >= 0L && defined(_POSIX_CLOCK_SELECTION) && (_POSIX_CLOCK_SELECTION) >= 0L
+    #include "periodic_scheduler_pos.hpp"
+  #else
+    // No fallback available, use Snooze
+  #endif
+#endif
+
+#endif /* ECL_TIME_PERIODIC_SCHEDULER_HPP_ */
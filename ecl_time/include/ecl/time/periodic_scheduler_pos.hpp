@@ -0,0 +1,195 @@
+/**
+ * @file /include/ecl/time/periodic_scheduler_pos.hpp
+ *
+ * @brief Drift free periodic scheduling on the posix monotonic clock.
+ *
+ * Constrained to platforms with a monotonic clock and clock_nanosleep by
+ * the selection made in periodic_scheduler.hpp.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Ifdefs
+*****************************************************************************/
+
+#ifndef ECL_TIME_PERIODIC_SCHEDULER_POS_HPP_
+#define ECL_TIME_PERIODIC_SCHEDULER_POS_HPP_
+
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#include <ecl/config.hpp>
+#if defined(ECL_IS_POSIX)
+#include <unistd.h>
+#if defined(_POSIX_MONOTONIC_CLOCK) && (_POSIX_MONOTONIC_CLOCK) >= 0L && defined(_POSIX_CLOCK_SELECTION) && (_POSIX_CLOCK_SELECTION) >= 0L
+
+/*****************************************************************************
+** Ecl Functionality Defines
+*****************************************************************************/
+
+#ifndef ECL_HAS_PERIODIC_SCHEDULER
+  #define ECL_HAS_PERIODIC_SCHEDULER
+#endif
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <atomic>
+#include <stdint.h>
+#include <ecl/config/macros.hpp>
+#include "duration.hpp"
+#include "latency_histogram.hpp"
+#include "macros.hpp"
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Enums
+*****************************************************************************/
+/**
+ * @brief What a periodic scheduler does when a cycle overruns its deadline.
+ */
+enum CatchUpPolicy {
+	SkipMissedCycles,  /**< @brief Start the late cycle immediately, drop any further deadlines already past, stay on the original grid. **/
+	BurstMissedCycles, /**< @brief Run every missed cycle back to back until caught up with the original grid. **/
+	ReanchorOnOverrun  /**< @brief Start the late cycle immediately and shift the grid to start from now (like Snooze's validation). **/
+};
+
+/*****************************************************************************
+** Interface [PeriodicScheduler]
+*****************************************************************************/
+/**
+ * @brief Drift free periodic loop timing with overrun accounting.
+ *
+ * A replacement for Snooze in control loops. Deadlines lie on a fixed grid
+ * (anchor + n*period) and the thread sleeps with absolute clock_nanosleep
+ * calls on the monotonic clock, so neither the time spent working nor the
+ * wakeup latency accumulates into drift.
+ *
+ * Unlike Snooze, overruns are never silently absorbed:
+ *
+ * - every cycle's wakeup latency (how late it started relative to its
+ *   deadline) and execution time (from its start to the next call) are
+ *   recorded into lock-free histograms,
+ * - cycles that finish after their deadline are counted as overruns, and
+ *   what happens next is decided by the configured CatchUpPolicy,
+ * - deadlines dropped by the SkipMissedCycles policy are counted too.
+ *
+ * The statistics may be read from another (e.g. diagnostics) thread while
+ * the loop runs.
+ *
+ * The kernel's wakeup latency is typically tens of microseconds (and
+ * worse without real time scheduling). For tighter jitter, configure a spin
+ * interval - the scheduler then sleeps until that long before the deadline
+ * and busy waits on the clock for the rest. This burns a core for the spin
+ * interval every cycle, so keep it just above the worst case wakeup latency
+ * of the system.
+ *
+ * <b>Usage:</b>
+ *
+ * @code
+ * PeriodicScheduler scheduler(Duration(0,1000000), SkipMissedCycles, Duration(0,20000)); // 1kHz, spin the last 20us
+ * scheduler.initialise();
+ * while ( running ) {
+ *   control();
+ *   if ( !scheduler() ) {
+ *     // overran, deadline missed
+ *   }
+ * }
+ * std::cout << scheduler.wakeupLatencies().percentile(99.9) << std::endl;
+ * std::cout << scheduler.overruns() << std::endl;
+ * @endcode
+ *
+ * @sa Snooze, LatencyHistogram.
+ */
+class ecl_time_PUBLIC PeriodicScheduler {
+public:
+	/*********************
+	** C&D's
+	**********************/
+	/**
+	 * @brief Configure and anchor the scheduler to the current time.
+	 *
+	 * @param period : the period of the loop.
+	 * @param policy : what to do when a cycle overruns.
+	 * @param spin : busy wait for this long before each deadline (zero to only sleep).
+	 */
+	PeriodicScheduler(const Duration &period,
+	                  const CatchUpPolicy &policy = SkipMissedCycles,
+	                  const Duration &spin = Duration(0,0));
+	virtual ~PeriodicScheduler() {}
+
+	/*********************
+	** Configuration
+	**********************/
+	/**
+	 * @brief Reconfigure the period (re-anchors to the current time).
+	 */
+	void period(const Duration &period);
+	Duration period() const { return Duration(period_ns/1000000000L, period_ns%1000000000L); }
+	void policy(const CatchUpPolicy &policy) { catch_up_policy = policy; }
+	CatchUpPolicy policy() const { return catch_up_policy; }
+	void spin(const Duration &spin) { spin_ns = spin.sec()*1000000000LL + spin.nsec(); }
+	Duration spin() const { return Duration(spin_ns/1000000000L, spin_ns%1000000000L); }
+
+	/*********************
+	** Usage
+	**********************/
+	/**
+	 * @brief Anchor the grid so the first deadline is a period from now.
+	 *
+	 * Use this immediately before starting to loop. Statistics are kept.
+	 */
+	void initialise();
+	/**
+	 * @brief End the current cycle and wait for the start of the next.
+	 *
+	 * Records the execution time of the cycle that just finished. If its
+	 * deadline hasn't passed, sleeps (and spins) until it arrives, otherwise
+	 * counts an overrun and applies the catch up policy. Finally records how
+	 * late the next cycle started.
+	 *
+	 * @return bool : true if the deadline was met, false on an overrun.
+	 */
+	bool operator()();
+
+	/*********************
+	** Statistics
+	**********************/
+	const LatencyHistogram& wakeupLatencies() const { return wakeup_latencies; } /**< @brief Cycle start minus deadline [ns]. **/
+	const LatencyHistogram& executionTimes() const { return execution_times; } /**< @brief Cycle start to end [ns]. **/
+	unsigned long cycles() const { return number_of_cycles.load(std::memory_order_relaxed); } /**< @brief Completed cycles. **/
+	unsigned long overruns() const { return number_of_overruns.load(std::memory_order_relaxed); } /**< @brief Cycles that ended after their deadline. **/
+	unsigned long skippedCycles() const { return number_of_skipped_cycles.load(std::memory_order_relaxed); } /**< @brief Deadlines dropped by SkipMissedCycles. **/
+	/**
+	 * @brief Clear the histograms and counters.
+	 */
+	void resetStatistics();
+
+private:
+	static int64_t now();
+	void waitUntil(const int64_t &deadline_ns);
+
+	int64_t period_ns;
+	int64_t spin_ns;
+	CatchUpPolicy catch_up_policy;
+	int64_t deadline;    // start of the next cycle [ns on the monotonic clock]
+	int64_t cycle_start; // start of the current cycle
+	LatencyHistogram wakeup_latencies;
+	LatencyHistogram execution_times;
+	std::atomic<unsigned long> number_of_cycles;
+	std::atomic<unsigned long> number_of_overruns;
+	std::atomic<unsigned long> number_of_skipped_cycles;
+};
+
+} // namespace ecl
+
+#endif /* _POSIX_MONOTONIC_CLOCK && _POSIX_CLOCK_SELECTION */
+#endif /* ECL_IS_POSIX */
+#endif /* ECL_TIME_PERIODIC_SCHEDULER_POS_HPP_ */
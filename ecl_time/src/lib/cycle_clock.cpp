@@ -0,0 +1,118 @@
+/**
+ * @file /src/lib/cycle_clock.cpp
+ *
+ * @brief Calibration and conversions for the cycle clock.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include "../../include/ecl/time/cycle_clock.hpp"
+
+#ifdef ECL_HAS_CYCLE_CLOCK
+
+#include <atomic>
+#include <limits>
+#include <mutex>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Calibration
+*****************************************************************************/
+
+namespace {
+
+struct Calibration {
+	uint64_t ticks;             // a counter reading...
+	int64_t nanoseconds;        // ...and the monotonic time it was taken at
+	double nanoseconds_per_tick;
+};
+
+Calibration calibration = { 0, 0, 1.0 };
+std::atomic<bool> calibrated(false);
+std::mutex calibration_mutex;
+
+int64_t monotonic_nanoseconds() {
+	TimeStamp now;
+	return static_cast<int64_t>(now.sec())*1000000000LL + now.nsec();
+}
+
+/**
+ * Bracket a counter reading between two clock readings, keeping the
+ * tightest bracket of a few attempts (so a preemption can't skew it).
+ */
+void sample(uint64_t &ticks, int64_t &nanoseconds) {
+	int64_t tightest = std::numeric_limits<int64_t>::max();
+	for ( unsigned int i = 0; i < 10; ++i ) {
+		const int64_t before = monotonic_nanoseconds();
+		const uint64_t reading = CycleClock::ticks();
+		const int64_t after = monotonic_nanoseconds();
+		if ( after - before < tightest ) {
+			tightest = after - before;
+			ticks = reading;
+			nanoseconds = before + ( after - before )/2;
+		}
+	}
+}
+
+void calibrate_unguarded(const Duration &window) {
+	const int64_t window_ns = static_cast<int64_t>(window.sec())*1000000000LL + window.nsec();
+	uint64_t start_ticks = 0, finish_ticks = 0;
+	int64_t start_ns = 0, finish_ns = 0;
+	sample(start_ticks, start_ns);
+	while ( monotonic_nanoseconds() - start_ns < window_ns ) {}
+	sample(finish_ticks, finish_ns);
+	calibration.ticks = finish_ticks;
+	calibration.nanoseconds = finish_ns;
+	if ( finish_ticks > start_ticks ) {
+		calibration.nanoseconds_per_tick = static_cast<double>(finish_ns - start_ns)/( finish_ticks - start_ticks );
+	}
+	calibrated.store(true, std::memory_order_release);
+}
+
+} // namespace
+
+/*****************************************************************************
+** Implementation [CycleClock]
+*****************************************************************************/
+
+void CycleClock::calibrate(const Duration &window) {
+	std::lock_guard<std::mutex> lock(calibration_mutex);
+	calibrate_unguarded(window);
+}
+
+double CycleClock::nanosecondsPerTick() {
+	if ( !calibrated.load(std::memory_order_acquire) ) {
+		std::lock_guard<std::mutex> lock(calibration_mutex);
+		if ( !calibrated.load(std::memory_order_relaxed) ) {
+			calibrate_unguarded(Duration(0,10000000));
+		}
+	}
+	return calibration.nanoseconds_per_tick;
+}
+
+Duration CycleClock::duration(const uint64_t &ticks) {
+	const int64_t interval = static_cast<int64_t>(ticks*nanosecondsPerTick());
+	return Duration(interval/1000000000LL, interval%1000000000LL);
+}
+
+TimeStamp CycleClock::timestamp(const uint64_t &ticks) {
+	const double nanoseconds_per_tick = nanosecondsPerTick();
+	const int64_t offset = static_cast<int64_t>(ticks - calibration.ticks); // may be negative
+	int64_t time = calibration.nanoseconds + static_cast<int64_t>(offset*nanoseconds_per_tick);
+	if ( time < 0 ) {
+		time = 0;
+	}
+	return TimeStamp(time/1000000000LL, time%1000000000LL);
+}
+
+} // namespace ecl
+
+#endif /* ECL_HAS_CYCLE_CLOCK */
@@ -5,6 +5,7 @@
 ** Includes
 *****************************************************************************/
 
+#include <algorithm>
 #include "../../include/ecl/time/frequency.hpp"
 
 /*****************************************************************************
@@ -88,6 +89,112 @@ const FrequencyDiagnostics& FrequencyMonitor::analyse() {
   return current_diagnostics;
 }
 
+/*****************************************************************************
+** Helpers
+*****************************************************************************/
+
+#ifdef ECL_HAS_CYCLE_CLOCK
+
+namespace {
+
+/**
+ * Statistics of what was recorded since the previous call (whose bucket
+ * counts are kept in previous).
+ *
+ * @return unsigned long : number of values recorded since.
+ */
+unsigned long window_statistics(const LatencyHistogram &histogram, std::vector<uint64_t> &previous,
+                                int64_t &minimum, int64_t &median, int64_t &p99, int64_t &p999, int64_t &maximum)
+{
+  std::vector<uint64_t> window(LatencyHistogram::number_of_buckets);
+  uint64_t count = 0;
+  for ( unsigned int i = 0; i < LatencyHistogram::number_of_buckets; ++i ) {
+    const uint64_t current = histogram.bucketCount(i);
+    window[i] = current - previous[i];
+    previous[i] = current;
+    count += window[i];
+  }
+  minimum = median = p99 = p999 = maximum = 0;
+  if ( count == 0 ) {
+    return 0;
+  }
+  const int64_t largest = histogram.maximum(); // over all windows, but it caps the last bucket
+  const uint64_t ranks[3] = {
+    std::max<uint64_t>(1, static_cast<uint64_t>(0.5*count + 0.5)),
+    std::max<uint64_t>(1, static_cast<uint64_t>(0.99*count + 0.5)),
+    std::max<uint64_t>(1, static_cast<uint64_t>(0.999*count + 0.5))
+  };
+  int64_t *percentiles[3] = { &median, &p99, &p999 };
+  unsigned int next_rank = 0;
+  uint64_t seen = 0;
+  bool first = true;
+  for ( unsigned int i = 0; i < LatencyHistogram::number_of_buckets; ++i ) {
+    if ( window[i] == 0 ) {
+      continue;
+    }
+    const int64_t upper = std::min<int64_t>(largest, ( i + 1 < LatencyHistogram::number_of_buckets ) ? static_cast<int64_t>(LatencyHistogram::lowest(i + 1)) - 1 : largest);
+    if ( first ) {
+      minimum = LatencyHistogram::lowest(i);
+      first = false;
+    }
+    seen += window[i];
+    while ( ( next_rank < 3 ) && ( seen >= ranks[next_rank] ) ) {
+      *percentiles[next_rank++] = upper;
+    }
+    maximum = upper;
+  }
+  return count;
+}
+
+} // namespace
+
+/*****************************************************************************
+** Implementation [WindowedFrequencyMonitor]
+*****************************************************************************/
+
+WindowedFrequencyMonitor::WindowedFrequencyMonitor(
+    const Duration& window,
+    const Duration& expected_period
+)
+: last_incoming(0)
+, expected_interval(static_cast<int64_t>(expected_period.sec())*1000000000LL + expected_period.nsec())
+, fixed_expectation(expected_interval.load() > 0)
+, window_ticks(static_cast<int64_t>(static_cast<double>(window)*CycleClock::frequency())) // calibrates if necessary
+, window_start(CycleClock::ticks())
+, interval_counts(LatencyHistogram::number_of_buckets, 0)
+, jitter_counts(LatencyHistogram::number_of_buckets, 0)
+, current_statistics()
+{
+}
+
+const FrequencyStatistics& WindowedFrequencyMonitor::analyse() {
+  const uint64_t now = CycleClock::ticks();
+  const uint64_t last = last_incoming.load(std::memory_order_relaxed);
+  // always update this one
+  current_statistics.last_incoming = ( last == 0 ) ? -1.0 : 1.0e-9*CycleClock::nanoseconds(static_cast<int64_t>(now - last));
+  if ( static_cast<int64_t>(now - window_start) < window_ticks ) {
+    return current_statistics;
+  }
+  const int64_t window_ns = CycleClock::nanoseconds(static_cast<int64_t>(now - window_start));
+  window_start = now;
+  FrequencyStatistics &statistics = current_statistics;
+  statistics.window = 1.0e-9*window_ns;
+  statistics.count = window_statistics(intervals, interval_counts,
+      statistics.minimum_interval, statistics.median_interval, statistics.p99_interval,
+      statistics.p999_interval, statistics.maximum_interval);
+  int64_t minimum_jitter;
+  window_statistics(jitters, jitter_counts, minimum_jitter, statistics.median_jitter,
+      statistics.p99_jitter, statistics.p999_jitter, statistics.maximum_jitter);
+  statistics.has_connection = ( statistics.count > 0 );
+  statistics.hz = ( window_ns > 0 ) ? 1.0e9*statistics.count/window_ns : 0.0;
+  if ( !fixed_expectation && ( statistics.count > 0 ) ) {
+    expected_interval.store(window_ns/statistics.count, std::memory_order_relaxed);
+  }
+  return current_statistics;
+}
+
+#endif /* ECL_HAS_CYCLE_CLOCK */
+
 /*****************************************************************************
  ** Trailers
  *****************************************************************************/
@@ -0,0 +1,71 @@
+/**
+ * @file /src/lib/latency_histogram.cpp
+ *
+ * @brief Implementation of the lock-free latency histogram.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <limits>
+#include "../../include/ecl/time/latency_histogram.hpp"
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Implementation [LatencyHistogram]
+*****************************************************************************/
+
+void LatencyHistogram::reset() {
+	counter.store(0, std::memory_order_relaxed);
+	total.store(0, std::memory_order_relaxed);
+	min.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+	max.store(0, std::memory_order_relaxed);
+	for ( unsigned int i = 0; i < number_of_buckets; ++i ) {
+		buckets[i].store(0, std::memory_order_relaxed);
+	}
+}
+
+int64_t LatencyHistogram::minimum() const {
+	const uint64_t value = min.load(std::memory_order_relaxed);
+	return ( value == std::numeric_limits<uint64_t>::max() ) ? 0 : value;
+}
+
+double LatencyHistogram::mean() const {
+	const uint64_t n = count();
+	return ( n == 0 ) ? 0.0 : static_cast<double>(total.load(std::memory_order_relaxed))/n;
+}
+
+int64_t LatencyHistogram::percentile(const double &percentage) const {
+	// count the buckets rather than trusting counter, a writer may be midway
+	uint64_t n = 0;
+	for ( unsigned int i = 0; i < number_of_buckets; ++i ) {
+		n += bucketCount(i);
+	}
+	if ( n == 0 ) {
+		return 0;
+	}
+	double fraction = ( percentage < 0.0 ) ? 0.0 : ( ( percentage > 100.0 ) ? 1.0 : percentage/100.0 );
+	uint64_t rank = static_cast<uint64_t>(fraction*n + 0.5);
+	if ( rank == 0 ) {
+		rank = 1;
+	}
+	const int64_t largest = maximum();
+	uint64_t seen = 0;
+	for ( unsigned int i = 0; i < number_of_buckets; ++i ) {
+		seen += bucketCount(i);
+		if ( seen >= rank ) {
+			const int64_t upper = ( i + 1 < number_of_buckets ) ? static_cast<int64_t>(lowest(i + 1)) - 1 : largest;
+			return ( upper < largest ) ? upper : largest;
+		}
+	}
+	return largest;
+}
+
+} // namespace ecl
@@ -0,0 +1,135 @@
+/**
+ * @file /src/lib/periodic_scheduler_pos.cpp
+ *
+ * @brief Implementation of the periodic scheduler.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include "../../include/ecl/time/periodic_scheduler_pos.hpp"
+
+#ifdef ECL_HAS_PERIODIC_SCHEDULER
+
+#include <errno.h>
+#include <time.h>
+
+/*****************************************************************************
+** Namespaces
+*****************************************************************************/
+
+namespace ecl {
+
+/*****************************************************************************
+** Implementation [PeriodicScheduler][C&D]
+*****************************************************************************/
+
+PeriodicScheduler::PeriodicScheduler(const Duration &period, const CatchUpPolicy &policy, const Duration &spin) :
+	period_ns(0),
+	spin_ns(0),
+	catch_up_policy(policy),
+	deadline(0),
+	cycle_start(0),
+	number_of_cycles(0),
+	number_of_overruns(0),
+	number_of_skipped_cycles(0)
+{
+	this->spin(spin);
+	this->period(period);
+}
+
+/*****************************************************************************
+** Implementation [PeriodicScheduler][Usage]
+*****************************************************************************/
+
+void PeriodicScheduler::period(const Duration &period) {
+	period_ns = period.sec()*1000000000LL + period.nsec();
+	if ( period_ns <= 0 ) {
+		period_ns = 1;
+	}
+	initialise();
+}
+
+void PeriodicScheduler::initialise() {
+	cycle_start = now();
+	deadline = cycle_start + period_ns;
+}
+
+bool PeriodicScheduler::operator()() {
+	int64_t current = now();
+	execution_times.record(current - cycle_start);
+	number_of_cycles.fetch_add(1, std::memory_order_relaxed);
+	bool on_time = true;
+	int64_t latency = 0;
+	if ( current <= deadline ) {
+		waitUntil(deadline);
+		current = now();
+		latency = current - deadline;
+	} else {
+		on_time = false;
+		number_of_overruns.fetch_add(1, std::memory_order_relaxed);
+		switch ( catch_up_policy ) {
+			case ( SkipMissedCycles ) : {
+				// move up to the last deadline already past, the next is in the future
+				const int64_t missed = ( current - deadline )/period_ns;
+				if ( missed > 0 ) {
+					deadline += missed*period_ns;
+					number_of_skipped_cycles.fetch_add(missed, std::memory_order_relaxed);
+				}
+				latency = current - deadline;
+				break;
+			}
+			case ( ReanchorOnOverrun ) : {
+				latency = current - deadline;
+				deadline = current;
+				break;
+			}
+			case ( BurstMissedCycles ) :
+			default : {
+				latency = current - deadline;
+				break; // keep the deadline, subsequent cycles run without sleeping until caught up
+			}
+		}
+	}
+	wakeup_latencies.record(latency);
+	cycle_start = current;
+	deadline += period_ns;
+	return on_time;
+}
+
+void PeriodicScheduler::resetStatistics() {
+	wakeup_latencies.reset();
+	execution_times.reset();
+	number_of_cycles.store(0, std::memory_order_relaxed);
+	number_of_overruns.store(0, std::memory_order_relaxed);
+	number_of_skipped_cycles.store(0, std::memory_order_relaxed);
+}
+
+/*****************************************************************************
+** Implementation [PeriodicScheduler][Private]
+*****************************************************************************/
+
+int64_t PeriodicScheduler::now() {
+	timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec*1000000000LL + time.tv_nsec;
+}
+
+void PeriodicScheduler::waitUntil(const int64_t &deadline_ns) {
+	const int64_t wake = deadline_ns - spin_ns;
+	if ( ( spin_ns <= 0 ) || ( wake > now() ) ) {
+		timespec time;
+		time.tv_sec = wake/1000000000LL;
+		time.tv_nsec = wake%1000000000LL;
+		while ( clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &time, NULL) == EINTR ) {}
+	}
+	if ( spin_ns > 0 ) {
+		while ( now() < deadline_ns ) {}
+	}
+}
+
+} // namespace ecl
+
+#endif /* ECL_HAS_PERIODIC_SCHEDULER */
@@ -0,0 +1,90 @@
+/**
+ * @file /src/test/cycle_clock.cpp
+ *
+ * @brief Unit Test for the CycleClock and FastStopWatch classes.
+ *
+ * @date October 2026
+ **/
+
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <gtest/gtest.h>
+#include "../../include/ecl/time/cycle_clock.hpp"
+#include "../../include/ecl/time/fast_stopwatch.hpp"
+#include "../../include/ecl/time/timestamp.hpp"
+
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#ifdef ECL_HAS_CYCLE_CLOCK
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::CycleClock;
+using ecl::Duration;
+using ecl::FastStopWatch;
+using ecl::TimeStamp;
+
+/*****************************************************************************
+** Tests
+*****************************************************************************/
+
+TEST(CycleClockTests,calibration) {
+	CycleClock::calibrate(Duration(0,20000000));
+	EXPECT_GT(CycleClock::frequency(), 1.0e6);
+	EXPECT_LT(CycleClock::frequency(), 1.0e11);
+	uint64_t first = CycleClock::ticks();
+	uint64_t second = CycleClock::ticks();
+	EXPECT_GE(second, first);
+}
+
+TEST(CycleClockTests,conversions) {
+	// measure the same interval with both clocks
+	TimeStamp start;
+	uint64_t start_ticks = CycleClock::ticks();
+	TimeStamp finish;
+	while ( double(finish - start) < 0.05 ) {
+		finish.stamp();
+	}
+	uint64_t finish_ticks = CycleClock::ticks();
+	TimeStamp finish_again;
+	EXPECT_NEAR(double(finish - start), 1.0e-9*CycleClock::nanoseconds(finish_ticks - start_ticks), 0.001);
+	EXPECT_NEAR(double(finish - start), double(CycleClock::duration(finish_ticks - start_ticks)), 0.001);
+	// absolute conversions land between the monotonic stamps either side
+	TimeStamp converted = CycleClock::timestamp(finish_ticks);
+	EXPECT_GT(double(converted), double(finish) - 0.001);
+	EXPECT_LT(double(converted), double(finish_again) + 0.001);
+}
+
+TEST(CycleClockTests,stopwatch) {
+	FastStopWatch stopwatch;
+	TimeStamp start;
+	TimeStamp now;
+	while ( double(now - start) < 0.02 ) {
+		now.stamp();
+	}
+	uint64_t split = stopwatch.splitTicks();
+	EXPECT_NEAR(0.02, 1.0e-9*CycleClock::nanoseconds(split), 0.005);
+	EXPECT_LT(double(stopwatch.split()), 0.005);
+	EXPECT_NEAR(0.02, double(stopwatch.elapsed()), 0.005);
+	EXPECT_GE(stopwatch.elapsedTicks(), split);
+	stopwatch.restart();
+	EXPECT_LT(double(stopwatch.elapsed()), 0.005);
+}
+
+#endif /* ECL_HAS_CYCLE_CLOCK */
+
+/*****************************************************************************
+** Main program
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+
+    testing::InitGoogleTest(&argc,argv);
+    return RUN_ALL_TESTS();
+}
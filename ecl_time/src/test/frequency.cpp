@@ -9,7 +9,9 @@
 *****************************************************************************/
 
 #include <gtest/gtest.h>
+#include <atomic>
 #include <iostream>
+#include <thread>
 #include "../../include/ecl/time/frequency.hpp"
 #include "../../include/ecl/time/sleep.hpp"
 #include "../../include/ecl/time/timestamp.hpp"
@@ -67,6 +69,75 @@ TEST(FrequencyMonitorTests,silent) {
   SUCCEED();
 }
 
+#ifdef ECL_HAS_CYCLE_CLOCK
+
+void busy_wait(const double &seconds) {
+  ecl::TimeStamp start, now;
+  while ( double(now - start) < seconds ) {
+    now.stamp();
+  }
+}
+
+TEST(FrequencyMonitorTests,windowed) {
+  ecl::WindowedFrequencyMonitor monitor(ecl::Duration(0.1), ecl::Duration(0,500000));
+  EXPECT_FALSE(monitor.analyse().has_connection);
+  EXPECT_GT(0.0, monitor.statistics().last_incoming);
+  busy_wait(0.1); // let the first (empty) window pass
+  monitor.analyse();
+  for ( unsigned int i = 0; i < 300; ++i ) { // ~2kHz for 0.15s
+    monitor.update();
+    busy_wait(0.0005);
+  }
+  const ecl::FrequencyStatistics &statistics = monitor.analyse();
+  EXPECT_TRUE(statistics.has_connection);
+  EXPECT_EQ(299u, statistics.count);
+  EXPECT_NEAR(2000.0, statistics.hz, 400.0);
+  EXPECT_NEAR(500000.0, statistics.median_interval, 50000.0);
+  EXPECT_LE(statistics.minimum_interval, statistics.median_interval);
+  EXPECT_LE(statistics.median_interval, statistics.p99_interval);
+  EXPECT_LE(statistics.p99_interval, statistics.p999_interval);
+  EXPECT_LE(statistics.p999_interval, statistics.maximum_interval);
+  EXPECT_LE(statistics.median_jitter, statistics.maximum_jitter);
+  EXPECT_LT(statistics.last_incoming, 0.01);
+  // nothing arrives in the next window
+  busy_wait(0.11);
+  EXPECT_FALSE(monitor.analyse().has_connection);
+  EXPECT_EQ(0u, monitor.statistics().count);
+  EXPECT_GT(monitor.statistics().last_incoming, 0.1);
+  EXPECT_EQ(299u, monitor.intervalHistogram().count());
+}
+
+TEST(FrequencyMonitorTests,windowedConcurrent) {
+  ecl::WindowedFrequencyMonitor monitor(ecl::Duration(0.01));
+  std::atomic<bool> running(true);
+  const unsigned int updates = 200000;
+  std::thread producer([&monitor, &running]() {
+    for ( unsigned int i = 0; i < updates; ++i ) {
+      monitor.update();
+    }
+    running = false;
+  });
+  unsigned long counted = 0;
+  while ( running ) {
+    ecl::FrequencyStatistics before = monitor.statistics();
+    const ecl::FrequencyStatistics &after = monitor.analyse();
+    if ( after.window != before.window ) {
+      counted += after.count;
+    }
+  }
+  producer.join();
+  busy_wait(0.011);
+  counted += monitor.analyse().count;
+  EXPECT_EQ(updates - 1, counted);
+  ecl::TimeStamp start;
+  for ( unsigned int i = 0; i < updates; ++i ) {
+    monitor.update();
+  }
+  ecl::TimeStamp finish;
+  std::cout << "WindowedFrequencyMonitor::update() [ns]: " << 1.0e9*double(finish - start)/updates << std::endl;
+}
+
+#endif /* ECL_HAS_CYCLE_CLOCK */
 #endif /* ECL_HAS_TIMESTAMP */
 
 /*****************************************************************************
@@ -0,0 +1,89 @@
+/**
+ * @file /src/test/latency_histogram.cpp
+ *
+ * @brief Unit Test for the lock-free latency histogram.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "../../include/ecl/time/latency_histogram.hpp"
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::LatencyHistogram;
+
+/*****************************************************************************
+** Tests
+*****************************************************************************/
+
+TEST(LatencyHistogramTests,buckets) {
+	// small values are exact, larger ones resolved to within 1/32
+	for ( uint64_t value = 0; value < 64; ++value ) {
+		EXPECT_EQ(value, LatencyHistogram::lowest(LatencyHistogram::index(value)));
+	}
+	for ( uint64_t value = 64; value < 100000000ULL; value = value*3/2 + 1 ) {
+		const unsigned int bucket = LatencyHistogram::index(value);
+		EXPECT_LE(LatencyHistogram::lowest(bucket), value);
+		EXPECT_GT(LatencyHistogram::lowest(bucket + 1), value);
+		EXPECT_LT(static_cast<double>(value - LatencyHistogram::lowest(bucket))/value, 1.0/32.0);
+	}
+	EXPECT_EQ(LatencyHistogram::number_of_buckets - 1, LatencyHistogram::index(~0ULL));
+}
+
+TEST(LatencyHistogramTests,statistics) {
+	LatencyHistogram histogram;
+	EXPECT_EQ(0u, histogram.count());
+	EXPECT_EQ(0, histogram.percentile(50.0));
+	for ( int64_t i = 1; i <= 1000; ++i ) {
+		histogram.record(i*1000); // 1us..1ms
+	}
+	histogram.record(-5); // clamped
+	EXPECT_EQ(1001u, histogram.count());
+	EXPECT_EQ(0, histogram.minimum());
+	EXPECT_EQ(1000000, histogram.maximum());
+	EXPECT_NEAR(500000.0, histogram.mean(), 1000.0);
+	EXPECT_NEAR(500000.0, histogram.percentile(50.0), 500000.0/32);
+	EXPECT_NEAR(990000.0, histogram.percentile(99.0), 990000.0/32);
+	EXPECT_EQ(1000000, histogram.percentile(100.0));
+	histogram.reset();
+	EXPECT_EQ(0u, histogram.count());
+	EXPECT_EQ(0, histogram.maximum());
+}
+
+TEST(LatencyHistogramTests,concurrent) {
+	LatencyHistogram histogram;
+	const unsigned int number_of_threads = 4;
+	const unsigned int records_per_thread = 100000;
+	std::vector<std::thread> threads;
+	for ( unsigned int t = 0; t < number_of_threads; ++t ) {
+		threads.push_back(std::thread([&histogram, t]() {
+			for ( unsigned int i = 0; i < records_per_thread; ++i ) {
+				histogram.record(t*1000 + i % 100);
+			}
+		}));
+	}
+	for ( unsigned int t = 0; t < number_of_threads; ++t ) {
+		threads[t].join();
+	}
+	EXPECT_EQ(number_of_threads*records_per_thread, histogram.count());
+	EXPECT_EQ(0, histogram.minimum());
+	EXPECT_EQ(3099, histogram.maximum());
+}
+
+/*****************************************************************************
+** Main program
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+
+	testing::InitGoogleTest(&argc,argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,140 @@
+/**
+ * @file /src/test/periodic_scheduler.cpp
+ *
+ * @brief Unit Test for the periodic scheduler.
+ *
+ * @date October 2026
+ **/
+/*****************************************************************************
+** Includes
+*****************************************************************************/
+
+#include <iostream>
+#include <gtest/gtest.h>
+#include "../../include/ecl/time/periodic_scheduler.hpp"
+#include "../../include/ecl/time/sleep.hpp"
+#include "../../include/ecl/time/timestamp.hpp"
+
+/*****************************************************************************
+** Platform Check
+*****************************************************************************/
+
+#ifdef ECL_HAS_PERIODIC_SCHEDULER
+
+/*****************************************************************************
+** Using
+*****************************************************************************/
+
+using ecl::Duration;
+using ecl::MilliSleep;
+using ecl::PeriodicScheduler;
+using ecl::TimeStamp;
+
+/*****************************************************************************
+** Tests
+*****************************************************************************/
+
+TEST(PeriodicSchedulerTests,configuration) {
+	PeriodicScheduler scheduler(Duration(0,5000000), ecl::BurstMissedCycles, Duration(0,20000));
+	EXPECT_FLOAT_EQ(0.005, scheduler.period());
+	EXPECT_FLOAT_EQ(0.00002, scheduler.spin());
+	EXPECT_EQ(ecl::BurstMissedCycles, scheduler.policy());
+	scheduler.period(Duration(0.5));
+	EXPECT_FLOAT_EQ(0.5, scheduler.period());
+}
+
+TEST(PeriodicSchedulerTests,noDrift) {
+	// work takes a variable amount of the period, the grid shouldn't move
+	PeriodicScheduler scheduler(Duration(0,10000000));
+	MilliSleep sleep_ms;
+	TimeStamp start;
+	scheduler.initialise();
+	for ( unsigned int i = 0; i < 20; ++i ) {
+		sleep_ms(i % 5);
+		scheduler();
+	}
+	TimeStamp finish;
+	double elapsed = finish - start;
+	EXPECT_GT(elapsed, 0.2);
+	EXPECT_LT(elapsed, 0.2 + 0.008); // only the last wakeup's latency
+	EXPECT_EQ(20u, scheduler.cycles());
+	EXPECT_EQ(0u, scheduler.overruns());
+	EXPECT_EQ(20u, scheduler.wakeupLatencies().count());
+	EXPECT_EQ(20u, scheduler.executionTimes().count());
+	EXPECT_GE(scheduler.executionTimes().maximum(), 4000000);
+}
+
+TEST(PeriodicSchedulerTests,skip) {
+	PeriodicScheduler scheduler(Duration(0,10000000), ecl::SkipMissedCycles);
+	MilliSleep sleep_ms;
+	scheduler.initialise();
+	sleep_ms(35); // misses the deadline at 10ms, drops those at 20, 30ms
+	EXPECT_FALSE(scheduler());
+	EXPECT_EQ(1u, scheduler.overruns());
+	EXPECT_EQ(2u, scheduler.skippedCycles());
+	EXPECT_LT(scheduler.wakeupLatencies().maximum(), 10000000); // relative to 30ms, not 10ms
+	TimeStamp before;
+	EXPECT_TRUE(scheduler()); // back on the grid at 40ms
+	TimeStamp after;
+	EXPECT_LT(after - before, 0.008);
+	EXPECT_EQ(1u, scheduler.overruns());
+}
+
+TEST(PeriodicSchedulerTests,burst) {
+	PeriodicScheduler scheduler(Duration(0,10000000), ecl::BurstMissedCycles);
+	MilliSleep sleep_ms;
+	scheduler.initialise();
+	sleep_ms(35);
+	// the deadlines at 10, 20, 30ms are all serviced immediately
+	TimeStamp before;
+	EXPECT_FALSE(scheduler());
+	EXPECT_FALSE(scheduler());
+	EXPECT_FALSE(scheduler());
+	TimeStamp after;
+	EXPECT_LT(after - before, 0.004);
+	EXPECT_TRUE(scheduler()); // then waits for 40ms
+	EXPECT_EQ(3u, scheduler.overruns());
+	EXPECT_EQ(0u, scheduler.skippedCycles());
+	EXPECT_GE(scheduler.wakeupLatencies().maximum(), 25000000);
+}
+
+TEST(PeriodicSchedulerTests,reanchor) {
+	PeriodicScheduler scheduler(Duration(0,10000000), ecl::ReanchorOnOverrun);
+	MilliSleep sleep_ms;
+	scheduler.initialise();
+	sleep_ms(35);
+	EXPECT_FALSE(scheduler());
+	TimeStamp before;
+	EXPECT_TRUE(scheduler()); // a whole period from the late start
+	TimeStamp after;
+	EXPECT_GT(after - before, 0.009);
+	EXPECT_EQ(1u, scheduler.overruns());
+	scheduler.resetStatistics();
+	EXPECT_EQ(0u, scheduler.cycles());
+	EXPECT_EQ(0u, scheduler.overruns());
+	EXPECT_EQ(0u, scheduler.wakeupLatencies().count());
+}
+
+TEST(PeriodicSchedulerTests,spin) {
+	PeriodicScheduler scheduler(Duration(0,2000000), ecl::SkipMissedCycles, Duration(0,500000));
+	scheduler.initialise();
+	for ( unsigned int i = 0; i < 50; ++i ) {
+		scheduler();
+	}
+	EXPECT_EQ(50u, scheduler.cycles());
+	EXPECT_GE(scheduler.wakeupLatencies().minimum(), 0);
+	std::cout << "Spin wakeup latency [ns] - median: " << scheduler.wakeupLatencies().percentile(50.0);
+	std::cout << ", max: " << scheduler.wakeupLatencies().maximum() << std::endl;
+}
+
+#endif /* ECL_HAS_PERIODIC_SCHEDULER */
+
+/*****************************************************************************
+** Main program
+*****************************************************************************/
+
+int main(int argc, char **argv) {
+
+	testing::InitGoogleTest(&argc,argv);
+	return RUN_ALL_TESTS();
+}